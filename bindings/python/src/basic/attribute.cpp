@@ -25,6 +25,42 @@
 
 #include <geode/basic/attribute.h>
 
+namespace
+{
+    template < typename T >
+    pybind11::buffer_info variable_attribute_buffer(
+        geode::VariableAttribute< T >& attribute )
+    {
+        const auto values = attribute.values();
+        // Exposed as a read-only buffer, values are modified with set_values.
+        // The buffer is reallocated when the attribute is resized: views on
+        // it must not be used after the attribute elements change.
+        return pybind11::buffer_info( const_cast< T* >( values.data() ),
+            sizeof( T ), pybind11::format_descriptor< T >::format(), 1,
+            { static_cast< pybind11::ssize_t >( values.size() ) },
+            { static_cast< pybind11::ssize_t >( sizeof( T ) ) }, true );
+    }
+
+    template < typename T >
+    void set_variable_attribute_values(
+        geode::VariableAttribute< T >& attribute,
+        geode::index_t first_element,
+        pybind11::buffer buffer )
+    {
+        const auto info = buffer.request();
+        OPENGEODE_EXCEPTION(
+            info.format == pybind11::format_descriptor< T >::format()
+                && info.ndim == 1
+                && info.strides[0]
+                       == static_cast< pybind11::ssize_t >( sizeof( T ) ),
+            "[VariableAttribute::set_values] Given buffer should be a "
+            "contiguous one dimensional array of the attribute type" );
+        attribute.set_values( first_element,
+            absl::MakeConstSpan( static_cast< const T* >( info.ptr ),
+                static_cast< size_t >( info.shape[0] ) ) );
+    }
+} // namespace
+
 #define PYTHON_ATTRIBUTE_CLASS( type, name )                                   \
     const auto read##name = std::string{ "ReadOnlyAttribute" } + #name;        \
     pybind11::class_< ReadOnlyAttribute< type >, AttributeBase,                \
@@ -43,8 +79,11 @@
     const auto variable##name = std::string{ "VariableAttribute" } + #name;    \
     pybind11::class_< VariableAttribute< type >, ReadOnlyAttribute< type >,    \
         std::shared_ptr< VariableAttribute< type > > >(                        \
-        module, variable##name.c_str() )                                       \
+        module, variable##name.c_str(), pybind11::buffer_protocol() )          \
+        .def_buffer( &variable_attribute_buffer< type > )                      \
         .def( "set_value", &VariableAttribute< type >::set_value )             \
+        .def( "set_values", &set_variable_attribute_values< type > )           \
+        .def( "fill", &VariableAttribute< type >::fill )                       \
         .def( "default_value", &VariableAttribute< type >::default_value );    \
     const auto sparse##name = std::string{ "SparseAttribute" } + #name;        \
     pybind11::class_< SparseAttribute< type >, ReadOnlyAttribute< type >,      \
@@ -23,6 +23,7 @@
 
 #include "../common.h"
 
+#include <geode/geometry/colocation.h>
 #include <geode/geometry/nn_search.h>
 
 #define PYTHON_NN_SEARCH( dimension )                                          \
@@ -34,8 +35,14 @@
         .def( "nb_points", &NNSearch##dimension##D::nb_points )                \
         .def( "point", &NNSearch##dimension##D::point )                        \
         .def( "closest_neighbor", &NNSearch##dimension##D::closest_neighbor )  \
-        .def( "radius_neighbors", &NNSearch##dimension##D::radius_neighbors )  \
-        .def( "neighbors", &NNSearch##dimension##D::neighbors )                \
+        .def( "radius_neighbors",                                              \
+            ( std::vector< index_t >( NNSearch##dimension##D::* )(             \
+                const Point< dimension >&, double ) const )                    \
+                & NNSearch##dimension##D::radius_neighbors )                   \
+        .def( "neighbors",                                                     \
+            ( std::vector< index_t >( NNSearch##dimension##D::* )(             \
+                const Point< dimension >&, index_t ) const )                   \
+                & NNSearch##dimension##D::neighbors )                          \
         .def( "colocated_index_mapping",                                       \
             &NNSearch##dimension##D::colocated_index_mapping );                \
                                                                                \
@@ -58,5 +65,10 @@ namespace geode
     {
         PYTHON_NN_SEARCH( 2 );
         PYTHON_NN_SEARCH( 3 );
+
+        pybind11::enum_< ColocationMethod >( module, "ColocationMethod" )
+            .value( "nn_search", ColocationMethod::nn_search )
+            .value( "grid_hashing", ColocationMethod::grid_hashing )
+            .export_values();
     }
 } // namespace geode
@@ -23,12 +23,55 @@
 
 #include "../../common.h"
 
+#include <geode/basic/range.h>
+
 #include <geode/geometry/point.h>
 
 #include <geode/mesh/builder/coordinate_reference_system_manager_builder.h>
 #include <geode/mesh/builder/coordinate_reference_system_managers_builder.h>
+#include <geode/mesh/core/attribute_coordinate_reference_system.h>
 #include <geode/mesh/core/coordinate_reference_system_managers.h>
 
+namespace
+{
+    template < geode::index_t dimension >
+    void set_points_from_array(
+        geode::CoordinateReferenceSystemManagersBuilder< dimension >& builder,
+        pybind11::buffer buffer )
+    {
+        const auto info = buffer.request();
+        OPENGEODE_EXCEPTION(
+            info.format == pybind11::format_descriptor< double >::format()
+                && info.ndim == 2
+                && info.shape[1]
+                       == static_cast< pybind11::ssize_t >( dimension ),
+            "[set_points_from_array] Given buffer should be a "
+            "(nb_points x dimension) array of double" );
+        const auto nb_points = static_cast< geode::index_t >( info.shape[0] );
+        if( const auto* crs = dynamic_cast<
+                const geode::AttributeCoordinateReferenceSystem< dimension >* >(
+                &builder.main_coordinate_reference_system_manager_builder()
+                     .active_coordinate_reference_system() ) )
+        {
+            OPENGEODE_EXCEPTION( nb_points <= crs->nb_points(),
+                "[set_points_from_array] Given buffer has more points than "
+                "mesh vertices" );
+        }
+        const auto* data = static_cast< const char* >( info.ptr );
+        for( const auto p : geode::Range{ nb_points } )
+        {
+            geode::Point< dimension > point;
+            for( const auto d : geode::LRange{ dimension } )
+            {
+                point.set_value( d, *reinterpret_cast< const double* >(
+                                        data + p * info.strides[0]
+                                        + d * info.strides[1] ) );
+            }
+            builder.set_point( p, std::move( point ) );
+        }
+    }
+} // namespace
+
 #define PYTHON_CRS_MANAGERS_BUILDER( dimension )                               \
     const auto name##dimension = "CoordinateReferenceSystemManagersBuilder"    \
                                  + std::to_string( dimension ) + "D";          \
@@ -51,7 +94,8 @@
                 main_coordinate_reference_system_manager_builder )             \
         .def( "set_point",                                                     \
             &CoordinateReferenceSystemManagersBuilder##dimension##D::          \
-                set_point )
+                set_point )                                                    \
+        .def( "set_points_from_array", &set_points_from_array< dimension > )
 
 namespace geode
 {
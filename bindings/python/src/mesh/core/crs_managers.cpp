@@ -23,10 +23,49 @@
 
 #include "../../common.h"
 
+#include <geode/basic/attribute_manager.h>
+
 #include <geode/geometry/point.h>
 
+#include <geode/mesh/core/attribute_coordinate_reference_system.h>
 #include <geode/mesh/core/coordinate_reference_system_manager.h>
 #include <geode/mesh/core/coordinate_reference_system_managers.h>
+#include <geode/mesh/core/vertex_set.h>
+
+namespace
+{
+    constexpr auto POINTS_AS_ARRAY_DOC =
+        "Read-only view on the mesh point coordinates, without copy.\n"
+        "The view keeps the point storage alive but not its content: it "
+        "dangles once the mesh vertices are created or deleted (the storage "
+        "may be reallocated). Request a new view after any modification of "
+        "the mesh vertices.";
+
+    template < geode::index_t dimension >
+    pybind11::memoryview points_as_array( const pybind11::object& mesh )
+    {
+        const auto& crs_managers = mesh.cast<
+            const geode::CoordinateReferenceSystemManagers< dimension >& >();
+        const auto* crs = dynamic_cast<
+            const geode::AttributeCoordinateReferenceSystem< dimension >* >(
+            &crs_managers.main_coordinate_reference_system_manager()
+                 .active_coordinate_reference_system() );
+        OPENGEODE_EXCEPTION( crs, "[points_as_array] Active coordinate "
+                                  "reference system should store its points "
+                                  "in an attribute" );
+        const auto& vertices = mesh.cast< const geode::VertexSet& >();
+        auto points = std::dynamic_pointer_cast<
+            geode::VariableAttribute< geode::Point< dimension > > >(
+            vertices.vertex_attribute_manager()
+                .find_attribute< geode::Point< dimension > >(
+                    crs->attribute_name() ) );
+        OPENGEODE_EXCEPTION( points, "[points_as_array] Points should be "
+                                     "stored in a VariableAttribute" );
+        // The view holds the attribute, not its buffer: resizing the mesh
+        // reallocates the buffer and invalidates the view
+        return pybind11::memoryview( pybind11::cast( std::move( points ) ) );
+    }
+} // namespace
 
 #define PYTHON_CRS_MANAGERS( dimension )                                       \
     const auto name##dimension = "CoordinateReferenceSystemManagers"           \
@@ -54,7 +93,9 @@
                 & CoordinateReferenceSystemManagers##dimension##D::            \
                     main_coordinate_reference_system_manager )                 \
         .def(                                                                  \
-            "point", &CoordinateReferenceSystemManagers##dimension##D::point )
+            "point", &CoordinateReferenceSystemManagers##dimension##D::point ) \
+        .def( "points_as_array", &points_as_array< dimension >,              \
+            POINTS_AS_ARRAY_DOC )
 
 namespace geode
 {
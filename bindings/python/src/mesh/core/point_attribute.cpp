@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2019 - 2023 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "../../common.h"
+
+#include <geode/basic/attribute.h>
+
+#include <geode/geometry/point.h>
+
+namespace
+{
+    template < geode::index_t dimension >
+    pybind11::buffer_info point_attribute_buffer(
+        geode::VariableAttribute< geode::Point< dimension > >& attribute )
+    {
+        static_assert( sizeof( geode::Point< dimension > )
+                           == dimension * sizeof( double ),
+            "[point_attribute_buffer] Point coordinates should be contiguous" );
+        const auto values = attribute.values();
+        // Exposed as a read-only (nb_points x dimension) buffer, values are
+        // modified with set_values
+        return pybind11::buffer_info(
+            const_cast< double* >(
+                reinterpret_cast< const double* >( values.data() ) ),
+            sizeof( double ), pybind11::format_descriptor< double >::format(),
+            2,
+            { static_cast< pybind11::ssize_t >( values.size() ),
+                static_cast< pybind11::ssize_t >( dimension ) },
+            { static_cast< pybind11::ssize_t >(
+                  sizeof( geode::Point< dimension > ) ),
+                static_cast< pybind11::ssize_t >( sizeof( double ) ) },
+            true );
+    }
+
+    template < geode::index_t dimension >
+    void set_point_attribute_values(
+        geode::VariableAttribute< geode::Point< dimension > >& attribute,
+        geode::index_t first_element,
+        pybind11::buffer buffer )
+    {
+        const auto info = buffer.request();
+        OPENGEODE_EXCEPTION(
+            info.format == pybind11::format_descriptor< double >::format()
+                && info.ndim == 2
+                && info.shape[1]
+                       == static_cast< pybind11::ssize_t >( dimension )
+                && info.strides[0]
+                       == static_cast< pybind11::ssize_t >(
+                           sizeof( geode::Point< dimension > ) )
+                && info.strides[1]
+                       == static_cast< pybind11::ssize_t >( sizeof( double ) ),
+            "[VariableAttribute::set_values] Given buffer should be a "
+            "contiguous (nb_points x dimension) array of double" );
+        attribute.set_values( first_element,
+            absl::MakeConstSpan(
+                static_cast< const geode::Point< dimension >* >( info.ptr ),
+                static_cast< size_t >( info.shape[0] ) ) );
+    }
+} // namespace
+
+#define PYTHON_POINT_ATTRIBUTE( dimension )                                    \
+    const auto read##dimension =                                               \
+        "ReadOnlyAttributePoint" + std::to_string( dimension ) + "D";          \
+    pybind11::class_< ReadOnlyAttribute< Point##dimension##D >, AttributeBase, \
+        std::shared_ptr< ReadOnlyAttribute< Point##dimension##D > > >(         \
+        module, read##dimension.c_str() )                                      \
+        .def( "value", &ReadOnlyAttribute< Point##dimension##D >::value );     \
+    const auto variable##dimension =                                           \
+        "VariableAttributePoint" + std::to_string( dimension ) + "D";          \
+    pybind11::class_< VariableAttribute< Point##dimension##D >,                \
+        ReadOnlyAttribute< Point##dimension##D >,                              \
+        std::shared_ptr< VariableAttribute< Point##dimension##D > > >(         \
+        module, variable##dimension.c_str(), pybind11::buffer_protocol() )     \
+        .def_buffer( &point_attribute_buffer< dimension > )                    \
+        .def( "set_value",                                                     \
+            &VariableAttribute< Point##dimension##D >::set_value )             \
+        .def( "set_values", &set_point_attribute_values< dimension > )         \
+        .def( "default_value",                                                 \
+            &VariableAttribute< Point##dimension##D >::default_value )
+
+namespace geode
+{
+    void define_point_attributes( pybind11::module& module )
+    {
+        PYTHON_POINT_ATTRIBUTE( 2 );
+        PYTHON_POINT_ATTRIBUTE( 3 );
+    }
+} // namespace geode
@@ -34,7 +34,11 @@ namespace geode
         module
             .def( "convert_edged_curve3d_into_2d",
                 &convert_edged_curve3d_into_2d )
-            .def( "merge_edged_curves2D", &merge_edged_curves< 2 > )
-            .def( "merge_edged_curves3D", &merge_edged_curves< 3 > );
+            .def( "merge_edged_curves2D", &merge_edged_curves< 2 >,
+                pybind11::arg( "curves" ),
+                pybind11::arg( "method" ) = ColocationMethod::nn_search )
+            .def( "merge_edged_curves3D", &merge_edged_curves< 3 >,
+                pybind11::arg( "curves" ),
+                pybind11::arg( "method" ) = ColocationMethod::nn_search );
     }
 } // namespace geode
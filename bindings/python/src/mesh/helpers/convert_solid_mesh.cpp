@@ -33,6 +33,8 @@ namespace geode
         module
             .def( "convert_solid_mesh_into_tetrahedral_solid",
                 &convert_solid_mesh_into_tetrahedral_solid )
-            .def( "merge_solid_meshes", &merge_solid_meshes );
+            .def( "merge_solid_meshes", &merge_solid_meshes,
+                pybind11::arg( "solids" ),
+                pybind11::arg( "method" ) = ColocationMethod::nn_search );
     }
 } // namespace geode
@@ -54,7 +54,11 @@ namespace geode
                 &convert_triangulated_surface2d_into_3d )
             .def( "convert_triangulated_surface3d_into_2d",
                 &convert_triangulated_surface3d_into_2d )
-            .def( "merge_surface_meshes2D", &merge_surface_meshes< 2 > )
-            .def( "merge_surface_meshes3D", &merge_surface_meshes< 3 > );
+            .def( "merge_surface_meshes2D", &merge_surface_meshes< 2 >,
+                pybind11::arg( "surfaces" ),
+                pybind11::arg( "method" ) = ColocationMethod::nn_search )
+            .def( "merge_surface_meshes3D", &merge_surface_meshes< 3 >,
+                pybind11::arg( "surfaces" ),
+                pybind11::arg( "method" ) = ColocationMethod::nn_search );
     }
 } // namespace geode
\ No newline at end of file
@@ -31,7 +31,9 @@
 #define PYTHON_HYBRID_SOLID_IO( dimension )                                    \
     const auto save##dimension =                                               \
         "save_hybrid_solid" + std::to_string( dimension ) + "D";               \
-    module.def( save##dimension.c_str(), &save_hybrid_solid< dimension > );    \
+    module.def( save##dimension.c_str(),                                       \
+        ( void ( * )( const HybridSolid< dimension >&, absl::string_view ) )   \
+            & save_hybrid_solid< dimension > );                                \
     const auto load##dimension =                                               \
         "load_hybrid_solid" + std::to_string( dimension ) + "D";               \
     module.def( load##dimension.c_str(),                                       \
@@ -31,7 +31,9 @@
 #define PYTHON_POINT_SET_IO( dimension )                                       \
     const auto save##dimension =                                               \
         "save_point_set" + std::to_string( dimension ) + "D";                  \
-    module.def( save##dimension.c_str(), &save_point_set< dimension > );       \
+    module.def( save##dimension.c_str(),                                       \
+        ( void ( * )( const PointSet< dimension >&, absl::string_view ) )      \
+            & save_point_set< dimension > );                                   \
     const auto load##dimension =                                               \
         "load_point_set" + std::to_string( dimension ) + "D";                  \
     module.def( load##dimension.c_str(),                                       \
@@ -32,7 +32,9 @@
 #define PYTHON_REGULAR_GRID_IO( dimension )                                    \
     const auto save##dimension =                                               \
         "save_regular_grid" + std::to_string( dimension ) + "D";               \
-    module.def( save##dimension.c_str(), &save_regular_grid< dimension > );    \
+    module.def( save##dimension.c_str(),                                       \
+        ( void ( * )( const RegularGrid< dimension >&, absl::string_view ) )   \
+            & save_regular_grid< dimension > );                                \
     const auto load##dimension =                                               \
         "load_regular_grid" + std::to_string( dimension ) + "D";               \
     module.def( load##dimension.c_str(),                                       \
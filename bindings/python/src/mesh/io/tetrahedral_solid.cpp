@@ -31,8 +31,10 @@
 #define PYTHON_TETRAHEDRAL_SOLID_IO( dimension )                               \
     const auto save##dimension =                                               \
         "save_tetrahedral_solid" + std::to_string( dimension ) + "D";          \
-    module.def(                                                                \
-        save##dimension.c_str(), &save_tetrahedral_solid< dimension > );       \
+    module.def( save##dimension.c_str(),                                       \
+        ( void ( * )(                                                          \
+            const TetrahedralSolid< dimension >&, absl::string_view ) )        \
+            & save_tetrahedral_solid< dimension > );                           \
     const auto load##dimension =                                               \
         "load_tetrahedral_solid" + std::to_string( dimension ) + "D";          \
     module.def( load##dimension.c_str(),                                       \
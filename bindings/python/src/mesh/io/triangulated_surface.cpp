@@ -31,8 +31,10 @@
 #define PYTHON_TRIANGULATED_SURFACE_IO( dimension )                            \
     const auto save##dimension =                                               \
         "save_triangulated_surface" + std::to_string( dimension ) + "D";       \
-    module.def(                                                                \
-        save##dimension.c_str(), &save_triangulated_surface< dimension > );    \
+    module.def( save##dimension.c_str(),                                       \
+        ( void ( * )(                                                          \
+            const TriangulatedSurface< dimension >&, absl::string_view ) )     \
+            & save_triangulated_surface< dimension > );                        \
     const auto load##dimension =                                               \
         "load_triangulated_surface" + std::to_string( dimension ) + "D";       \
     module.def( load##dimension.c_str(),                                       \
@@ -28,6 +28,7 @@
 
 namespace geode
 {
+    void define_point_attributes( pybind11::module& );
     void define_crs( pybind11::module& );
     void define_crs_manager( pybind11::module& );
     void define_crs_managers( pybind11::module& );
@@ -106,6 +107,7 @@ PYBIND11_MODULE( opengeode_py_mesh, module )
         module, "OpenGeodeMeshLibrary" )
         .def( "initialize", &geode::OpenGeodeMeshLibrary::initialize );
 
+    geode::define_point_attributes( module );
     geode::define_crs( module );
     geode::define_crs_manager( module );
     geode::define_crs_managers( module );
@@ -33,9 +33,12 @@ namespace geode
             .def( pybind11::init<>() )
             .def( "nb_unique_vertices", &VertexIdentifier::nb_unique_vertices )
             .def( "component_mesh_vertices",
-                ( const std::vector< ComponentMeshVertex >& (
-                    VertexIdentifier::*) ( index_t ) const )
-                    & VertexIdentifier::component_mesh_vertices )
+                []( const VertexIdentifier& vertex_identifier,
+                    index_t unique_vertex_id ) {
+                    return vertex_identifier
+                        .component_mesh_vertices( unique_vertex_id )
+                        .to_vector();
+                } )
             .def( "filtered_component_mesh_vertices_by_type",
                 ( std::vector< ComponentMeshVertex >( VertexIdentifier::* )(
                     index_t, const ComponentType& ) const )
@@ -32,7 +32,8 @@ namespace geode
 {
     void define_brep_io( pybind11::module& module )
     {
-        module.def( "save_brep", &save_brep );
+        module.def( "save_brep",
+            ( void ( * )( const BRep&, absl::string_view ) ) & save_brep );
         module.def( "load_brep", &load_brep );
         PYTHON_FACTORY_CLASS( BRepInputFactory );
         PYTHON_FACTORY_CLASS( BRepOutputFactory );
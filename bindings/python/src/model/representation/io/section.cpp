@@ -32,7 +32,9 @@ namespace geode
 {
     void define_section_io( pybind11::module& module )
     {
-        module.def( "save_section", &save_section );
+        module.def( "save_section",
+            ( void ( * )( const Section&, absl::string_view ) )
+                & save_section );
         module.def( "load_section", &load_section );
         PYTHON_FACTORY_CLASS( SectionInputFactory );
         PYTHON_FACTORY_CLASS( SectionOutputFactory );
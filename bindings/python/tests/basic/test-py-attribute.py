@@ -19,6 +19,7 @@
 # OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 # SOFTWARE.
 
+import array
 import os
 import sys
 import platform
@@ -79,6 +80,22 @@ def test_double_sparse_attribute(manager):
         raise ValueError("[Test] Should be equal to 5")
 
 
+def test_bulk_variable_attribute():
+    manager = basic.AttributeManager()
+    manager.resize(10)
+    variable_attribute = manager.find_or_create_attribute_variable_double(
+        "bulk", 1)
+    variable_attribute.set_values(4, array.array('d', [2, 3, 4]))
+    values = memoryview(variable_attribute)
+    if values.shape != (10,) or not values.readonly:
+        raise ValueError("[Test] Wrong shape of attribute buffer")
+    if values[3] != 1 or values[5] != 3:
+        raise ValueError("[Test] Wrong values in attribute buffer")
+    variable_attribute.fill(5)
+    if values[5] != 5:
+        raise ValueError("[Test] Attribute buffer should share its values")
+
+
 def test_number_of_attributes(manager, nb):
     if len(manager.attribute_names()) != nb:
         raise ValueError(
@@ -112,6 +129,7 @@ if __name__ == '__main__':
         raise ValueError("[Test] Manager should have 10 elements")
     test_constant_attribute(manager)
     test_int_variable_attribute(manager)
+    test_bulk_variable_attribute()
     test_double_sparse_attribute(manager)
     test_double_sparse_attribute(manager)
     test_delete_attribute_elements(manager)
@@ -19,6 +19,7 @@
 # OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 # SOFTWARE.
 
+import array
 import os
 import sys
 import platform
@@ -41,6 +42,22 @@ def test_create_vertices(surface, builder):
         raise ValueError("[Test] TriangulatedSurface should have 5 vertices")
 
 
+def test_points_as_array(surface, builder):
+    points = surface.points_as_array()
+    if points.shape != (5, 3) or not points.readonly:
+        raise ValueError("[Test] Wrong shape of points array")
+    if points[1, 1] != 9.4 or points[4, 2] != 1.3:
+        raise ValueError("[Test] Wrong values in points array")
+    coordinates = array.array('d', points.tobytes())
+    shifted = array.array('d', [c + 1 for c in coordinates])
+    builder.set_points_from_array(
+        memoryview(shifted).cast('B').cast('d', [5, 3]))
+    if points[0, 2] != 1.3 or surface.point(0).value(2) != 1.3:
+        raise ValueError("[Test] Points should be set from array")
+    builder.set_points_from_array(
+        memoryview(coordinates).cast('B').cast('d', [5, 3]))
+
+
 def test_create_polygons(surface, builder):
     builder.create_triangle([0, 1, 2])
     builder.create_triangle([1, 3, 2])
@@ -221,6 +238,7 @@ if __name__ == '__main__':
     builder = mesh.TriangulatedSurfaceBuilder3D.create(surface)
 
     test_create_vertices(surface, builder)
+    test_points_as_array(surface, builder)
     test_create_polygons(surface, builder)
     test_polygon_adjacencies(surface, builder)
     test_io(surface, "test." + surface.native_extension())
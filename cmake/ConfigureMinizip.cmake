@@ -34,16 +34,19 @@ ExternalProject_Add(minizip
         -DCMAKE_CXX_COMPILER=${CMAKE_CXX_COMPILER}
         -DCMAKE_BUILD_TYPE=${CMAKE_BUILD_TYPE}
         -DCMAKE_INSTALL_MESSAGE=LAZY
+        -DCMAKE_POSITION_INDEPENDENT_CODE:BOOL=ON
         -DCMAKE_CXX_STANDARD=${CMAKE_CXX_STANDARD}
     CMAKE_CACHE_ARGS
         -DMZ_COMPAT:BOOL=OFF
-        -DMZ_ZLIB:BOOL=OFF
+        -DMZ_ZLIB:BOOL=ON
         -DMZ_BZIP2:BOOL=OFF
         -DMZ_LZMA:BOOL=OFF
         -DMZ_PKCRYPT:BOOL=OFF
         -DMZ_WZAES:BOOL=OFF
-        -DMZ_ZSTD:BOOL=OFF
+        -DMZ_ZSTD:BOOL=ON
         -DMZ_OPENSSL:BOOL=OFF
         -DMZ_LIBBSD:BOOL=OFF
+        -DMZ_FETCH_LIBS:BOOL=ON
+        -DMZ_FORCE_FETCH_LIBS:BOOL=ON
         -DCMAKE_INSTALL_PREFIX:PATH=${MINIZIP_INSTALL_PREFIX}
 )
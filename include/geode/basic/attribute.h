@@ -28,6 +28,7 @@
 
 #include <absl/container/flat_hash_map.h>
 #include <absl/strings/string_view.h>
+#include <absl/types/span.h>
 
 #include <bitsery/bitsery.h>
 #include <bitsery/brief_syntax.h>
@@ -39,6 +40,7 @@
 #include <geode/basic/attribute_utils.h>
 #include <geode/basic/bitsery_archive.h>
 #include <geode/basic/common.h>
+#include <geode/basic/detail/column_encoding.h>
 #include <geode/basic/detail/mapping_after_deletion.h>
 #include <geode/basic/mapping.h>
 #include <geode/basic/passkey.h>
@@ -402,6 +404,48 @@ namespace geode
             return values_.size();
         }
 
+        /*!
+         * Return the values of all the elements, stored contiguously.
+         * @warning The span is invalidated by any change of the number of
+         * elements.
+         */
+        absl::Span< const T > values() const
+        {
+            return values_;
+        }
+
+        /*!
+         * Set the values of consecutive elements.
+         * @param[in] first_element Index of the first element to set.
+         * @param[in] values Values to set, one per element.
+         */
+        void set_values( index_t first_element, absl::Span< const T > values )
+        {
+            OPENGEODE_EXCEPTION( first_element + values.size() <= size(),
+                "[VariableAttribute::set_values] Trying to set values beyond "
+                "the number of elements" );
+            absl::c_copy( values, values_.begin() + first_element );
+        }
+
+        /*!
+         * Set the same value to all the elements.
+         */
+        void fill( const T& value )
+        {
+            absl::c_fill( values_, value );
+        }
+
+        /*!
+         * Modify all the values at once.
+         * @param[in] modifier Functor taking an absl::Span< T > over all the
+         * values. The span should not be used outside of the functor.
+         */
+        template < typename Modifier >
+        void modify_values( Modifier&& modifier )
+        {
+            modifier( absl::MakeSpan( values_ ) );
+        }
+
     public:
         void compute_value( index_t from_element,
             index_t to_element,
@@ -441,7 +485,15 @@ namespace geode
                             []( Archive& a2, T& item ) {
                                 a2( item );
                             } );
-                    } } } );
+                    },
+                        []( Archive& a, VariableAttribute< T >& attribute ) {
+                            a.ext( attribute, bitsery::ext::BaseClass<
+                                                  ReadOnlyAttribute< T > >{} );
+                            a( attribute.default_value_ );
+                            detail::serialize_raw_column( a, attribute.values_,
+                                attribute.default_value_ );
+                        } },
+                    detail::raw_column_version< T >( archive ) } );
             values_.reserve( 10 );
         }
 
@@ -596,6 +648,34 @@ namespace geode
             return values_.size();
         }
 
+        absl::Span< const bool > values() const
+        {
+            return absl::Span< const bool >(
+                reinterpret_cast< const bool* >( values_.data() ),
+                values_.size() );
+        }
+
+        void set_values(
+            index_t first_element, absl::Span< const bool > values )
+        {
+            OPENGEODE_EXCEPTION( first_element + values.size() <= size(),
+                "[VariableAttribute::set_values] Trying to set values beyond "
+                "the number of elements" );
+            absl::c_copy( values, values_.begin() + first_element );
+        }
+
+        void fill( bool value )
+        {
+            absl::c_fill( values_, value );
+        }
+
+        template < typename Modifier >
+        void modify_values( Modifier&& modifier )
+        {
+            modifier( absl::Span< bool >(
+                reinterpret_cast< bool* >( values_.data() ), values_.size() ) );
+        }
+
     public:
         void compute_value( index_t from_element,
             index_t to_element,
@@ -960,4 +1040,63 @@ namespace geode
         T default_value_;
         absl::flat_hash_map< index_t, T > values_;
     };
+
+    /*!
+     * Read-only view on the values of an attribute resolving its storage once.
+     * When the viewed attribute is a VariableAttribute, values are read
+     * directly from its contiguous storage, avoiding a virtual call per
+     * element. Other storages are read through ReadOnlyAttribute::value.
+     * @warning The view is invalidated by any change of the number of
+     * elements of the attribute.
+     */
+    template < typename T >
+    class AttributeValuesView
+    {
+    public:
+        explicit AttributeValuesView( const ReadOnlyAttribute< T >& attribute )
+            : attribute_( attribute )
+        {
+            if( const auto* variable =
+                    dynamic_cast< const VariableAttribute< T >* >(
+                        &attribute ) )
+            {
+                values_ = variable->values();
+                is_contiguous_ = true;
+            }
+        }
+
+        /*!
+         * Return true if the values are stored contiguously, then they can
+         * be accessed using values().
+         */
+        bool is_contiguous() const
+        {
+            return is_contiguous_;
+        }
+
+        /*!
+         * Return the contiguous values.
+         * @pre The view should be contiguous.
+         */
+        absl::Span< const T > values() const
+        {
+            OPENGEODE_ASSERT( is_contiguous_, "[AttributeValuesView::values] "
+                                              "Values are not contiguous" );
+            return values_;
+        }
+
+        const T& value( index_t element ) const
+        {
+            if( is_contiguous_ )
+            {
+                return values_[element];
+            }
+            return attribute_.value( element );
+        }
+
+    private:
+        const ReadOnlyAttribute< T >& attribute_;
+        absl::Span< const T > values_;
+        bool is_contiguous_{ false };
+    };
 } // namespace geode
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2019 - 2023 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <string>
+
+#include <absl/container/flat_hash_set.h>
+#include <absl/strings/string_view.h>
+#include <absl/types/span.h>
+
+#include <geode/basic/common.h>
+
+namespace geode
+{
+    /*!
+     * Selection of the attributes to load when reading a file.
+     * By default, every attribute is loaded.
+     * Attributes used by the object internal structure are always loaded.
+     */
+    class AttributeFilter
+    {
+    public:
+        AttributeFilter() = default;
+
+        /*!
+         * Load only the attributes with the given names.
+         */
+        static AttributeFilter load_only(
+            absl::Span< const std::string > names )
+        {
+            return { names, true };
+        }
+
+        /*!
+         * Load all the attributes except the ones with the given names.
+         */
+        static AttributeFilter skip( absl::Span< const std::string > names )
+        {
+            return { names, false };
+        }
+
+        bool is_loaded( absl::string_view name ) const
+        {
+            return names_.contains( name ) == load_listed_names_;
+        }
+
+        /*!
+         * Return true if every attribute is loaded.
+         */
+        bool loads_all() const
+        {
+            return !load_listed_names_ && names_.empty();
+        }
+
+    private:
+        AttributeFilter(
+            absl::Span< const std::string > names, bool load_listed_names )
+            : names_( names.begin(), names.end() ),
+              load_listed_names_( load_listed_names )
+        {
+        }
+
+    private:
+        absl::flat_hash_set< std::string > names_;
+        bool load_listed_names_{ false };
+    };
+} // namespace geode
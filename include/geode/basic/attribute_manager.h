@@ -195,6 +195,22 @@ namespace geode
         void rename_attribute(
             absl::string_view old_name, absl::string_view new_name );
 
+        /*!
+         * Flag the attribute as part of the data structure of the object
+         * owning this manager, like mesh points or polygon vertices.
+         * Structural attributes are always loaded, whatever the
+         * AttributeFilter given to the reader.
+         * @param[in] name The attribute name, the attribute may be created
+         * later
+         */
+        void set_attribute_structural( absl::string_view name );
+
+        /*!
+         * Return true if the attribute was flagged as structural.
+         * @param[in] name The attribute name to use
+         */
+        bool is_attribute_structural( absl::string_view name ) const;
+
         /*!
          * Remove all the attributes in the manager
          */
@@ -23,6 +23,11 @@
 
 #pragma once
 
+#include <array>
+#include <type_traits>
+
+#include <absl/base/config.h>
+
 #include <geode/basic/bitsery_archive.h>
 #include <geode/basic/common.h>
 
@@ -238,4 +243,38 @@ namespace geode
     IMPLICIT_ARRAY_GENERIC_ATTRIBUTE_CONVERSION( unsigned int );
     IMPLICIT_ARRAY_GENERIC_ATTRIBUTE_CONVERSION( float );
     IMPLICIT_ARRAY_GENERIC_ATTRIBUTE_CONVERSION( double );
+
+    namespace detail
+    {
+        /*!
+         * Values that can be written as a raw little-endian array: every
+         * byte of their object representation is a value byte, padding
+         * would otherwise leak uninitialized memory in the files.
+         * Arithmetic types, enums and arrays of them qualify. Other types
+         * qualify if they have unique object representations (C++17) or if
+         * they specialize this struct.
+         */
+        template < typename T >
+        struct RawColumnValue
+        {
+#ifdef ABSL_IS_LITTLE_ENDIAN
+            static constexpr bool value =
+                std::is_arithmetic< T >::value || std::is_enum< T >::value
+#    ifdef __cpp_lib_has_unique_object_representations
+                || std::has_unique_object_representations< T >::value
+#    endif
+                ;
+#else
+            static constexpr bool value = false;
+#endif
+        };
+
+        template < typename T, size_t size >
+        struct RawColumnValue< std::array< T, size > >
+        {
+            static constexpr bool value =
+                RawColumnValue< T >::value
+                && sizeof( std::array< T, size > ) == size * sizeof( T );
+        };
+    } // namespace detail
 } // namespace geode
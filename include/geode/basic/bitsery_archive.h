@@ -34,16 +34,39 @@
 #include <bitsery/ext/inheritance.h>
 #include <bitsery/ext/pointer.h>
 
+#include <geode/basic/attribute_filter.h>
+#include <geode/basic/attribute_serialization_layout.h>
 #include <geode/basic/common.h>
 #include <geode/basic/range.h>
 
 namespace geode
 {
+    namespace detail
+    {
+        /*!
+         * Archive state telling attributes how to write their values.
+         * The layout is set by the archive writer, the other values by the
+         * AttributeManager when writing a columnar layout.
+         * When reading, the filter selects the attribute columns to load
+         * and the AttributeManager sets the layout found in the file.
+         */
+        struct AttributeColumnContext
+        {
+            AttributeSerializationLayout layout{
+                AttributeSerializationLayout::row
+            };
+            bool raw_values{ false };
+            bool encode_values{ false };
+            AttributeFilter filter;
+        };
+    } // namespace detail
+
     using PContext =
         bitsery::ext::PolymorphicContext< bitsery::ext::StandardRTTI >;
     using TContext = std::tuple< PContext,
         bitsery::ext::PointerLinkingContext,
-        bitsery::ext::InheritanceContext >;
+        bitsery::ext::InheritanceContext,
+        detail::AttributeColumnContext >;
     using Serializer =
         bitsery::Serializer< bitsery::OutputBufferedStreamAdapter, TContext >;
     using Deserializer =
@@ -78,12 +101,24 @@ namespace geode
         {
         }
 
+        /*!
+         * @param[in] written_version Version used when serializing, instead
+         * of the last one. Deserialization still handles every version.
+         */
+        Growable( absl::FixedArray< std::function< void( Archive &, T & ) > >
+                      serializers,
+            index_t written_version )
+            : version_( written_version ),
+              serializers_( std::move( serializers ) )
+        {
+        }
+
         template < typename Fnc >
         void serialize( Archive &ser, const T &obj, Fnc &&fnc ) const
         {
             geode_unused( fnc );
             ser.ext4b( version_, bitsery::ext::CompactValue{} );
-            serializers_.back()( ser, const_cast< T & >( obj ) );
+            serializers_.at( version_ - 1 )( ser, const_cast< T & >( obj ) );
         }
 
         template < typename Fnc >
@@ -23,6 +23,8 @@
 
 #pragma once
 
+#include <atomic>
+#include <thread>
 #include <type_traits>
 
 #include <bitsery/brief_syntax.h>
@@ -31,24 +33,71 @@
 
 namespace geode
 {
+    /*!
+     * Lazily computed value. The value is computed once by the first call to
+     * operator() and returned by the next calls until reset() is called.
+     * Concurrent calls to operator() are thread-safe: only one thread
+     * computes the value, the others wait for it to be available.
+     */
     template < typename ReturnType >
     class CachedValue
     {
+        enum State : unsigned char
+        {
+            NOT_COMPUTED,
+            COMPUTING,
+            COMPUTED
+        };
+
     public:
         template < typename... Args >
         using CachedFunction =
             typename std::add_pointer< ReturnType( Args... ) >::type;
 
+        CachedValue() = default;
+
+        CachedValue( const CachedValue& other )
+            : value_( other.value_ )
+        {
+            set_computed( other.computed() );
+        }
+
+        CachedValue& operator=( const CachedValue& other )
+        {
+            set_computed( other.computed() );
+            value_ = other.value_;
+            return *this;
+        }
+
         template < typename... Args >
         const ReturnType& operator()(
             CachedFunction< Args... > computer, Args&&... args ) const
         {
-            if( !computed_ )
+            while( true )
             {
-                value_ = computer( std::forward< Args >( args )... );
-                computed_ = true;
+                auto state = state_.load( std::memory_order_acquire );
+                if( state == COMPUTED )
+                {
+                    return value_;
+                }
+                if( state == NOT_COMPUTED
+                    && state_.compare_exchange_strong(
+                        state, COMPUTING, std::memory_order_acquire ) )
+                {
+                    try
+                    {
+                        value_ = computer( std::forward< Args >( args )... );
+                    }
+                    catch( ... )
+                    {
+                        state_.store( NOT_COMPUTED, std::memory_order_release );
+                        throw;
+                    }
+                    state_.store( COMPUTED, std::memory_order_release );
+                    return value_;
+                }
+                std::this_thread::yield();
             }
-            return value_;
         }
 
         bool operator!=( const CachedValue& other ) const
@@ -62,12 +111,12 @@ namespace geode
 
         void reset()
         {
-            computed_ = false;
+            set_computed( false );
         }
 
         bool computed() const
         {
-            return computed_;
+            return state_.load( std::memory_order_acquire ) == COMPUTED;
         }
 
         const ReturnType& value() const
@@ -82,13 +131,21 @@ namespace geode
         {
             archive.ext( *this, Growable< Archive, CachedValue >{
                                     { []( Archive& a, CachedValue& value ) {
-                                        a.value1b( value.computed_ );
+                                        auto computed = value.computed();
+                                        a.value1b( computed );
+                                        value.set_computed( computed );
                                         a( value.value_ );
                                     } } } );
         }
 
+        void set_computed( bool computed )
+        {
+            state_.store( computed ? COMPUTED : NOT_COMPUTED,
+                std::memory_order_relaxed );
+        }
+
     private:
-        mutable bool computed_{ false };
+        mutable std::atomic< unsigned char > state_{ NOT_COMPUTED };
         mutable ReturnType value_;
     };
-} // namespace geode
\ No newline at end of file
+} // namespace geode
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2019 - 2023 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <absl/strings/string_view.h>
+#include <absl/types/span.h>
+
+#include <geode/basic/attribute_utils.h>
+#include <geode/basic/bitsery_archive.h>
+#include <geode/basic/common.h>
+
+namespace geode
+{
+    namespace detail
+    {
+        enum struct ColumnEncoding : uint8_t
+        {
+            raw,
+            delta_shuffle
+        };
+
+        /*!
+         * Encode an array of fixed size values.
+         * delta_shuffle replaces each 4 or 8 bytes word by its difference
+         * with the same word of the previous value, then groups the words
+         * bytes by significance. Both steps are lossless and help generic
+         * compressors on smooth coordinates and increasing indices.
+         * @param[in] values Bytes of the values to encode.
+         * @param[in] value_size Size in bytes of one value.
+         */
+        std::string opengeode_basic_api encode_column( absl::string_view values,
+            size_t value_size,
+            ColumnEncoding encoding );
+
+        /*!
+         * Decode an array encoded by encode_column.
+         * @param[out] values Bytes of the decoded values. Its size should be
+         * the one of the encoded array.
+         */
+        void opengeode_basic_api decode_column( absl::string_view encoded,
+            size_t value_size,
+            ColumnEncoding encoding,
+            absl::Span< char > values );
+
+        /*!
+         * Get the version to write for an attribute storing values of type T:
+         * 2 for a raw column if requested by the archive, 1 otherwise.
+         */
+        template < typename T, typename Archive >
+        index_t raw_column_version( Archive& archive )
+        {
+            const auto& context =
+                archive.template context< AttributeColumnContext >();
+            return RawColumnValue< T >::value && context.raw_values ? 2 : 1;
+        }
+
+        template < typename T >
+        void serialize_raw_column( Serializer& archive,
+            std::vector< T >& values,
+            std::true_type /*raw*/ )
+        {
+            const auto& context =
+                archive.template context< AttributeColumnContext >();
+            uint8_t encoding = static_cast< uint8_t >(
+                context.encode_values && sizeof( T ) % 4 == 0
+                    ? ColumnEncoding::delta_shuffle
+                    : ColumnEncoding::raw );
+            index_t value_size = sizeof( T );
+            index_t nb_values = values.size();
+            const auto encoded = encode_column(
+                { reinterpret_cast< const char* >( values.data() ),
+                    values.size() * sizeof( T ) },
+                sizeof( T ), static_cast< ColumnEncoding >( encoding ) );
+            archive.value1b( encoding );
+            archive.value4b( value_size );
+            archive.value4b( nb_values );
+            archive.text1b( encoded, encoded.max_size() );
+        }
+
+        /*!
+         * Never called: raw_column_version does not select raw columns for
+         * these values, whose bytes are not written.
+         */
+        template < typename T >
+        void serialize_raw_column( Serializer& /*unused*/,
+            std::vector< T >& /*unused*/,
+            std::false_type /*raw*/ )
+        {
+            throw OpenGeodeException{ "[serialize_raw_column] Values cannot "
+                                      "be written as raw bytes" };
+        }
+
+        template < typename T >
+        void serialize_raw_column(
+            Serializer& archive, std::vector< T >& values, const T& )
+        {
+            serialize_raw_column( archive, values,
+                std::integral_constant< bool, RawColumnValue< T >::value >{} );
+        }
+
+        template < typename T >
+        void serialize_raw_column(
+            Deserializer& archive, std::vector< T >& values, const T& value )
+        {
+            uint8_t encoding;
+            index_t value_size;
+            index_t nb_values;
+            std::string encoded;
+            archive.value1b( encoding );
+            archive.value4b( value_size );
+            archive.value4b( nb_values );
+            archive.text1b( encoded, encoded.max_size() );
+            OPENGEODE_EXCEPTION(
+                RawColumnValue< T >::value && value_size == sizeof( T ),
+                "[serialize_raw_column] Raw column does not match the "
+                "attribute type" );
+            values.assign( nb_values, value );
+            decode_column( encoded, sizeof( T ),
+                static_cast< ColumnEncoding >( encoding ),
+                { reinterpret_cast< char* >( values.data() ),
+                    values.size() * sizeof( T ) } );
+        }
+    } // namespace detail
+} // namespace geode
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2019 - 2023 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <streambuf>
+#include <string>
+
+namespace geode
+{
+    namespace detail
+    {
+        /*!
+         * Read-only stream buffer over a contiguous memory block.
+         * The memory is neither copied nor owned.
+         */
+        class MemoryStreamBuffer : public std::streambuf
+        {
+        public:
+            MemoryStreamBuffer( const char* data, size_t size )
+            {
+                auto* begin = const_cast< char* >( data );
+                setg( begin, begin, begin + size );
+            }
+
+        protected:
+            std::streamsize xsgetn( char* output, std::streamsize count ) final
+            {
+                const auto available = std::min( count,
+                    static_cast< std::streamsize >( egptr() - gptr() ) );
+                std::memcpy( output, gptr(), available );
+                setg( eback(), gptr() + available, egptr() );
+                return available;
+            }
+        };
+
+        /*!
+         * Write-only stream buffer appending to an owned string.
+         * Unlike std::ostringstream, the content can be moved out without
+         * being copied.
+         */
+        class StringStreamBuffer : public std::streambuf
+        {
+        public:
+            std::string release()
+            {
+                std::string content;
+                content.swap( content_ );
+                return content;
+            }
+
+        protected:
+            int_type overflow( int_type character ) final
+            {
+                if( !traits_type::eq_int_type(
+                        character, traits_type::eof() ) )
+                {
+                    content_.push_back( traits_type::to_char_type( character ) );
+                }
+                return traits_type::not_eof( character );
+            }
+
+            std::streamsize xsputn(
+                const char* input, std::streamsize count ) final
+            {
+                content_.append( input, static_cast< size_t >( count ) );
+                return count;
+            }
+
+        private:
+            std::string content_;
+        };
+    } // namespace detail
+} // namespace geode
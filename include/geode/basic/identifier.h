@@ -31,6 +31,7 @@ namespace geode
 {
     class IdentifierBuilder;
     struct uuid;
+    class ZipFile;
 } // namespace geode
 
 namespace geode
@@ -52,6 +53,8 @@ namespace geode
 
         void save_identifier( absl::string_view directory ) const;
 
+        void save_identifier( const ZipFile& zip_writer ) const;
+
     public:
         void set_id( uuid id, IdentifierKey );
 
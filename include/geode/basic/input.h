@@ -23,6 +23,7 @@
 
 #pragma once
 
+#include <geode/basic/attribute_filter.h>
 #include <geode/basic/common.h>
 #include <geode/basic/io.h>
 #include <geode/basic/logger.h>
@@ -35,6 +36,20 @@ namespace geode
     public:
         virtual Object read( const Args&... args ) = 0;
 
+        /*!
+         * Select the attributes to read.
+         * Readers unable to skip attributes load all of them.
+         */
+        void set_attribute_filter( AttributeFilter attribute_filter )
+        {
+            attribute_filter_ = std::move( attribute_filter );
+        }
+
+        const AttributeFilter& attribute_filter() const
+        {
+            return attribute_filter_;
+        }
+
         ~Input()
         {
             if( inspect_required_ )
@@ -62,5 +77,6 @@ namespace geode
 
     private:
         bool inspect_required_{ false };
+        AttributeFilter attribute_filter_;
     };
 } // namespace geode
@@ -25,6 +25,7 @@
 
 #include <geode/basic/common.h>
 #include <geode/basic/io.h>
+#include <geode/basic/output_options.h>
 
 namespace geode
 {
@@ -34,7 +35,23 @@ namespace geode
     public:
         virtual void write( const Object& object ) const = 0;
 
+        /*!
+         * Select how the object is written.
+         */
+        void set_options( OutputOptions options )
+        {
+            options_ = std::move( options );
+        }
+
+        const OutputOptions& options() const
+        {
+            return options_;
+        }
+
     protected:
         Output( absl::string_view filename ) : IOFile( filename ) {}
+
+    private:
+        OutputOptions options_;
     };
 } // namespace geode
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2019 - 2023 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <geode/basic/attribute_serialization_layout.h>
+#include <geode/basic/common.h>
+#include <geode/basic/zip_file.h>
+
+namespace geode
+{
+    /*!
+     * Options given to a file writer.
+     * Writers ignore the options that do not apply to their format.
+     */
+    struct OutputOptions
+    {
+        /*!
+         * Compression of the archive entries, for formats written as zip
+         * archives.
+         * @see ZipFile::is_compression_available
+         */
+        ZipFile::Compression compression{ ZipFile::Compression::store };
+
+        /*!
+         * Compression level, -1 for the compression method default.
+         */
+        int16_t compression_level{ -1 };
+
+        /*!
+         * Layout of the attributes, for native OpenGeode formats.
+         * Default is row, readable by previous versions.
+         */
+        AttributeSerializationLayout attribute_layout{
+            AttributeSerializationLayout::row
+        };
+    };
+} // namespace geode
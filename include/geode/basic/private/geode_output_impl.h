@@ -28,6 +28,7 @@
 #include <absl/strings/ascii.h>
 
 #include <geode/basic/filename.h>
+#include <geode/basic/output_options.h>
 #include <geode/basic/timer.h>
 
 namespace geode
@@ -37,7 +38,8 @@ namespace geode
         template < typename Factory, typename Object >
         void geode_object_output_impl( absl::string_view type,
             const Object& object,
-            absl::string_view filename )
+            absl::string_view filename,
+            const OutputOptions& options = {} )
         {
             Timer timer;
             const auto extension =
@@ -46,7 +48,9 @@ namespace geode
                 "Unknown extension: ", extension );
             ghc::filesystem::create_directories(
                 filepath_without_filename( filename ) );
-            Factory::create( extension, filename )->write( object );
+            const auto output = Factory::create( extension, filename );
+            output->set_options( options );
+            output->write( object );
             Logger::info(
                 type, " saved in ", filename, " in ", timer.duration() );
         }
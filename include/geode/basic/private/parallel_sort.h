@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2019 - 2023 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include <async++.h>
+
+#include <geode/basic/common.h>
+
+namespace geode
+{
+    namespace detail
+    {
+        /*!
+         * Stable sort of the given vector using all available threads.
+         * The vector is split into chunks sorted in parallel, then chunks are
+         * merged pairwise until one sorted range remains.
+         * Elements comparing equal keep their original relative order.
+         * @warning Only include this header in translation units linking
+         * Async++.
+         */
+        template < typename T, typename Compare >
+        void parallel_stable_sort( std::vector< T >& values, Compare compare )
+        {
+            static constexpr size_t CHUNK_SIZE{ 16384 };
+            const auto nb_values = values.size();
+            if( nb_values <= CHUNK_SIZE )
+            {
+                std::stable_sort( values.begin(), values.end(), compare );
+                return;
+            }
+            const auto nb_chunks = ( nb_values + CHUNK_SIZE - 1 ) / CHUNK_SIZE;
+            async::parallel_for( async::irange( size_t{ 0 }, nb_chunks ),
+                [&values, &compare, nb_values]( size_t chunk ) {
+                    const auto begin = chunk * CHUNK_SIZE;
+                    const auto end = std::min( begin + CHUNK_SIZE, nb_values );
+                    std::stable_sort( values.begin() + begin,
+                        values.begin() + end, compare );
+                } );
+            for( auto width = CHUNK_SIZE; width < nb_values; width *= 2 )
+            {
+                const auto nb_merges =
+                    ( nb_values + 2 * width - 1 ) / ( 2 * width );
+                async::parallel_for( async::irange( size_t{ 0 }, nb_merges ),
+                    [&values, &compare, nb_values, width]( size_t merge ) {
+                        const auto begin = merge * 2 * width;
+                        const auto middle =
+                            std::min( begin + width, nb_values );
+                        const auto end =
+                            std::min( begin + 2 * width, nb_values );
+                        std::inplace_merge( values.begin() + begin,
+                            values.begin() + middle, values.begin() + end,
+                            compare );
+                    } );
+            }
+        }
+    } // namespace detail
+} // namespace geode
@@ -23,19 +23,53 @@
 
 #pragma once
 
+#include <functional>
+#include <iosfwd>
+#include <vector>
+
 #include <absl/types/span.h>
 
 #include <geode/basic/common.h>
 
 #include <geode/basic/pimpl.h>
 
+namespace geode
+{
+    struct OutputOptions;
+} // namespace geode
+
 namespace geode
 {
     class opengeode_basic_api ZipFile
     {
     public:
+        enum struct Compression
+        {
+            store,
+            deflate,
+            zstd
+        };
+
+        /*!
+         * Check if the minizip library has been built with the backend of
+         * the given compression method.
+         */
+        static bool is_compression_available( Compression compression );
+
         ZipFile(
             absl::string_view file, absl::string_view archive_temp_filename );
+
+        /*!
+         * Each entry is compressed by the thread writing it, so that
+         * concurrent writers compress in parallel.
+         * @param[in] options Compression of the archive entries and options
+         * of the entry writers.
+         * @exception OpenGeodeException if the compression method is not
+         * available.
+         */
+        ZipFile( absl::string_view file,
+            absl::string_view archive_temp_filename,
+            const OutputOptions& options );
         ~ZipFile();
 
         void archive_files(
@@ -43,8 +77,30 @@ namespace geode
 
         void archive_file( absl::string_view file ) const;
 
+        /*!
+         * Write a new entry in the archive without any temporary file.
+         * The writer fills the entry content from the given stream.
+         * This method is thread-safe: writers run concurrently and the entries
+         * are appended one at a time. The number of entries held in memory at
+         * the same time is bounded by the hardware concurrency.
+         * @param[in] entry_name Name of the entry inside the archive.
+         * @param[in] writer Function serializing the entry content.
+         */
+        void archive_entry( absl::string_view entry_name,
+            const std::function< void( std::ostream& ) >& writer ) const;
+
+        /*!
+         * Temporary directory used to stage files before calling archive_file.
+         * It is created on the first call.
+         */
         std::string directory() const;
 
+        /*!
+         * Options given at construction, to be followed by the entry
+         * writers.
+         */
+        const OutputOptions& options() const;
+
     private:
         IMPLEMENTATION_MEMBER( impl_ );
     };
@@ -58,6 +114,36 @@ namespace geode
 
         void extract_all() const;
 
+        /*!
+         * Names of the archive entries, read from its central directory.
+         */
+        std::vector< std::string > entries() const;
+
+        /*!
+         * Uncompressed size in bytes of the given entry.
+         */
+        uint64_t entry_size( absl::string_view entry_name ) const;
+
+        /*!
+         * Read an entry content without any temporary file.
+         * This method is thread-safe: the entry is decompressed in memory
+         * under a lock and the reader is called outside of it.
+         * @param[in] entry_name Name of the entry inside the archive.
+         * @param[in] reader Function deserializing the entry content.
+         */
+        void read_entry( absl::string_view entry_name,
+            const std::function< void( std::istream& ) >& reader ) const;
+
+        /*!
+         * Extract a single entry in the temporary directory.
+         * @return Path to the extracted file.
+         */
+        std::string extract_entry( absl::string_view entry_name ) const;
+
+        /*!
+         * Temporary directory where entries are extracted.
+         * It is created on the first call.
+         */
         std::string directory() const;
 
     private:
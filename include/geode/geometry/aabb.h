@@ -45,6 +45,29 @@ namespace geode
         OPENGEODE_DISABLE_COPY( AABBTree );
         OPENGEODE_TEMPLATE_ASSERT_2D_OR_3D( dimension );
 
+    public:
+        /*!
+         * Result of a batch of containing box queries stored in a compressed
+         * (CSR) layout: the boxes containing the query q are stored in
+         * boxes[offsets[q]] to boxes[offsets[q+1]].
+         */
+        struct ContainingBoxes
+        {
+            index_t nb_queries() const
+            {
+                return offsets.size() - 1;
+            }
+
+            absl::Span< const index_t > query_boxes( index_t query ) const
+            {
+                return absl::MakeConstSpan( boxes ).subspan(
+                    offsets[query], offsets[query + 1] - offsets[query] );
+            }
+
+            std::vector< index_t > offsets;
+            std::vector< index_t > boxes;
+        };
+
     public:
         /*!
          * @brief AABB is a search tree for fast spatial request using the
@@ -69,6 +92,28 @@ namespace geode
 
         const BoundingBox< dimension >& bounding_box() const;
 
+        /*!
+         * @brief Updates the tree after its elements moved.
+         * @param[in] bboxes new elements bounding boxes, in the same order
+         * and number as the ones given at the tree construction.
+         * @details The tree hierarchy computed at construction (Morton
+         * ordering of the initial boxes) is kept and only the node boxes are
+         * recomputed bottom-up. Query results remain exact but the queries may
+         * slow down if the elements move far from their initial
+         * configuration, see refit_quality().
+         */
+        void refit( absl::Span< const BoundingBox< dimension > > bboxes );
+
+        /*!
+         * @brief Gets the ratio between the traversal cost of the tree when it
+         * was built and its current traversal cost.
+         * @details The traversal cost is the sum of the node box surfaces
+         * (perimeters in 2D) relative to the root box surface. The ratio is 1
+         * after construction and decreases as refitted node boxes grow and
+         * overlap: rebuilding the tree is advised when it goes below 0.5.
+         */
+        double refit_quality() const;
+
         /*!
          * @brief Gets all the boxes containing a point
          * @param[in] query the point to test
@@ -76,6 +121,15 @@ namespace geode
         std::vector< index_t > containing_boxes(
             const Point< dimension >& query ) const;
 
+        /*!
+         * @brief Gets all the boxes containing each point of a batch
+         * @param[in] queries the points to test
+         * @details Queries are processed in parallel following their Morton
+         * order to improve cache locality during tree traversal.
+         */
+        ContainingBoxes containing_boxes(
+            absl::Span< const Point< dimension > > queries ) const;
+
         /*!
          * @brief Gets the closest element to a point
          * @param[in] query the point to test
@@ -102,6 +156,23 @@ namespace geode
         std::tuple< index_t, Point< dimension >, double > closest_element_box(
             const Point< dimension >& query, const EvalDistance& action ) const;
 
+        /*!
+         * @brief Gets the closest element to each point of a batch
+         * @param[in] queries the points to test
+         * @param[in] action the functor to compute the distance between
+         * a query and the tree element in boxes
+         * @return for each query, the same tuple as closest_element_box.
+         *
+         * @details Queries are processed in parallel following their Morton
+         * order to improve cache locality during tree traversal.
+         * @note \p action is called concurrently and should be thread safe.
+         */
+        template < typename EvalDistance >
+        std::vector< std::tuple< index_t, Point< dimension >, double > >
+            closest_element_boxes(
+                absl::Span< const Point< dimension > > queries,
+                const EvalDistance& action ) const;
+
         /*!
          * @brief Computes the intersections between a given
          * box and the all element boxes.
@@ -178,6 +249,33 @@ namespace geode
         void compute_ray_element_bbox_intersections(
             const Ray< dimension >& ray, EvalIntersection& action ) const;
 
+        /*!
+         * @brief Computes the intersections between a batch of rays and all
+         * element boxes.
+         * @param[in] rays The rays to test.
+         * @param[in,out] max_distances For each ray, the distance from its
+         * origin beyond which boxes are ignored (use
+         * std::numeric_limits< double >::max() for no limit).
+         * @param[in] action The functor to run when a box is intersected by a
+         * ray.
+         * @tparam EvalIntersection this functor should have an operator()
+         * defined like this:
+         * bool operator()( index_t ray_id, index_t cur_element_box ) ;
+         * @note The functor may decrease max_distances[ray_id] (for example
+         * to the distance of the closest element found so far) to prune the
+         * remaining traversal for this ray.
+         * @note The returned boolean indicates if the search should stop or
+         * continue for this ray. Return true to stop, false to continue.
+         * @details Consecutive rays are grouped in packets traversing the
+         * tree together: each node box is tested against all the rays of a
+         * packet at once. Coherent rays should be consecutive.
+         */
+        template < class EvalIntersection >
+        void compute_rays_element_bbox_intersections(
+            absl::Span< const Ray< dimension > > rays,
+            absl::Span< double > max_distances,
+            EvalIntersection& action ) const;
+
         /*!
          * @brief Computes the intersections between a given infinite line and
          * all element boxes.
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2019 - 2023 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <geode/geometry/common.h>
+#include <geode/geometry/nn_search.h>
+
+namespace geode
+{
+    /*!
+     * Spatial search used to find colocated points:
+     * - nn_search builds a kd-tree on the points and requests the neighbors
+     * of each point, see NNSearch::colocated_index_mapping.
+     * - grid_hashing buckets the points into a regular grid of cells of size
+     * epsilon and only compares the points of neighboring cells. It avoids
+     * the kd-tree construction and is faster when the points are evenly
+     * spread compared to epsilon. When the cell coordinates (point
+     * coordinates divided by epsilon) do not fit in 64-bit integers,
+     * nn_search is used instead.
+     */
+    enum struct ColocationMethod
+    {
+        nn_search,
+        grid_hashing
+    };
+
+    /*!
+     * Compute a colocation mapping from a list of points
+     * @param[in] points The points to colocate
+     * @param[in] epsilon The approximation allowed to test if two points
+     * are identical
+     * @param[in] method The spatial search used to find colocated points,
+     * both methods return the same result
+     * @return The information related to this colocated operation
+     */
+    template < index_t dimension >
+    typename NNSearch< dimension >::ColocatedInfo colocated_index_mapping(
+        std::vector< Point< dimension > > points,
+        double epsilon,
+        ColocationMethod method );
+} // namespace geode
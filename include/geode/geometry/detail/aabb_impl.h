@@ -29,12 +29,63 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+
+#include <absl/container/inlined_vector.h>
+
 #include <geode/basic/pimpl_impl.h>
 
 #include <geode/geometry/aabb.h>
+#include <geode/geometry/point.h>
 
 namespace geode
 {
+    namespace detail
+    {
+        inline bool line_intersects_box( const std::array< double, 2 >& half,
+            const std::array< double, 2 >& origin,
+            const Vector2D& direction )
+        {
+            const auto lhs = std::fabs( direction.value( 0 ) * origin[1]
+                                        - direction.value( 1 ) * origin[0] );
+            const auto rhs = half[0] * std::fabs( direction.value( 1 ) )
+                             + half[1] * std::fabs( direction.value( 0 ) );
+            return lhs - rhs <= global_epsilon;
+        }
+
+        inline bool line_intersects_box( const std::array< double, 3 >& half,
+            const std::array< double, 3 >& origin,
+            const Vector3D& direction )
+        {
+            const std::array< double, 3 > origin_cross_direction{
+                direction.value( 1 ) * origin[2]
+                    - direction.value( 2 ) * origin[1],
+                direction.value( 2 ) * origin[0]
+                    - direction.value( 0 ) * origin[2],
+                direction.value( 0 ) * origin[1]
+                    - direction.value( 1 ) * origin[0]
+            };
+            for( const auto i : LRange{ 3 } )
+            {
+                const auto ii = i == 2 ? 0 : i + 1;
+                const auto iii = ii == 2 ? 0 : ii + 1;
+                if( std::fabs( origin_cross_direction[i] )
+                        - ( half[ii] * std::fabs( direction.value( iii ) )
+                            + half[iii] * std::fabs( direction.value( ii ) ) )
+                    > global_epsilon )
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+    } // namespace detail
+
     /*!
      * AABB tree structure implementation
      * The tree is store in s single vector following this example:
@@ -45,12 +96,21 @@ namespace geode
      *                  B1     B2   B3    B4
      *  where B* are the input bboxes
      *  Storage: |empty|ROOT|A1|A2|B1|B2|B3|B4|
+     *
+     * Node boxes are stored flattened by pair of siblings: the children
+     * 2n and 2n+1 of the node n share a block of 4 * dimension doubles
+     * |min_x(2n)|min_x(2n+1)|min_y(2n)|min_y(2n+1)|...|max_x(2n)|...
+     * so that both children of a node are tested with the same instructions
+     * during traversals. The root is the second sibling of the empty node 0,
+     * testing the children of node 0 tests the root.
      */
     template < index_t dimension >
     class AABBTree< dimension >::Impl
     {
     public:
         static constexpr index_t ROOT_INDEX{ 1 };
+        static constexpr index_t ROOT_PARENT_INDEX{ 0 };
+        static constexpr index_t PAIR_SIZE{ 4 * dimension };
 
         struct Iterator
         {
@@ -59,6 +119,90 @@ namespace geode
             index_t child_right;
         };
 
+        /*!
+         * Node of the explicit traversal stack.
+         * The distance is a lower bound of the distance between the node box
+         * and the query, only used by closest element traversal.
+         */
+        struct StackNode
+        {
+            index_t node_index;
+            index_t element_begin;
+            index_t element_end;
+            double distance;
+        };
+        using Stack = absl::InlinedVector< StackNode, 64 >;
+
+        /*!
+         * Rays of a packet stored by coordinate so that a node box is tested
+         * against all of them with the same instructions. Lanes past the
+         * packet size are padded with rays that never hit any box, so that
+         * every loop runs over the full packet width.
+         */
+        static constexpr index_t RAY_PACKET_SIZE{ 32 };
+        using RayMask = uint32_t;
+        struct RayPacket
+        {
+            RayPacket( absl::Span< const Ray< dimension > > rays,
+                absl::Span< const double > ray_max_distances )
+                : size( static_cast< index_t >( rays.size() ) )
+            {
+                for( auto& coordinates : origins )
+                {
+                    coordinates.fill( 0 );
+                }
+                for( auto& coordinates : inverse_directions )
+                {
+                    coordinates.fill( 1 );
+                }
+                max_distances.fill( -1 );
+                for( index_t r = 0; r < RAY_PACKET_SIZE; r++ )
+                {
+                    lane_masks[r] = RayMask{ 1 } << r;
+                }
+                for( const auto r : Indices{ rays } )
+                {
+                    const auto& origin = rays[r].origin();
+                    const auto& direction = rays[r].direction();
+                    for( const auto c : LRange{ dimension } )
+                    {
+                        origins[c][r] = origin.value( c );
+                        const auto value = direction.value( c );
+                        inverse_directions[c][r] =
+                            1.
+                            / ( std::fabs( value )
+                                        > std::numeric_limits< double >::min()
+                                    ? value
+                                    : std::numeric_limits< double >::min() );
+                    }
+                    max_distances[r] = ray_max_distances[r];
+                }
+            }
+
+            RayMask all_rays() const
+            {
+                return size == RAY_PACKET_SIZE
+                           ? ~RayMask{ 0 }
+                           : ( RayMask{ 1 } << size ) - RayMask{ 1 };
+            }
+
+            index_t size;
+            std::array< std::array< double, RAY_PACKET_SIZE >, dimension >
+                origins;
+            std::array< std::array< double, RAY_PACKET_SIZE >, dimension >
+                inverse_directions;
+            std::array< double, RAY_PACKET_SIZE > max_distances;
+            std::array< RayMask, RAY_PACKET_SIZE > lane_masks;
+        };
+        struct PacketStackNode
+        {
+            index_t node_index;
+            index_t element_begin;
+            index_t element_end;
+            RayMask rays;
+        };
+        using PacketStack = absl::InlinedVector< PacketStackNode, 64 >;
+
     public:
         Impl() = default;
 
@@ -70,40 +214,165 @@ namespace geode
 
         index_t nb_bboxes() const;
 
-        static bool is_leaf( index_t box_begin, index_t box_end );
+        static bool is_leaf( index_t box_begin, index_t box_end )
+        {
+            return box_begin + 1 == box_end;
+        }
 
         static Iterator get_recursive_iterators(
-            index_t node_index, index_t box_begin, index_t box_end );
+            index_t node_index, index_t box_begin, index_t box_end )
+        {
+            Iterator it;
+            it.middle_box = box_begin + ( box_end - box_begin ) / 2;
+            it.child_left = 2 * node_index;
+            it.child_right = 2 * node_index + 1;
+            return it;
+        }
+
+        const BoundingBox< dimension >& bounding_box() const;
 
-        const BoundingBox< dimension >& node( index_t index ) const;
+        BoundingBox< dimension > node( index_t index ) const;
 
-        index_t mapping_morton( index_t index ) const;
+        double node_min( index_t node_index, local_index_t axis ) const
+        {
+            return nodes_[node_offset( node_index ) + 2 * axis];
+        }
+
+        double node_max( index_t node_index, local_index_t axis ) const
+        {
+            return nodes_[node_offset( node_index ) + 2 * ( dimension + axis )];
+        }
+
+        index_t mapping_morton( index_t index ) const
+        {
+            return mapping_morton_[index];
+        }
 
         static index_t max_node_index_recursive(
             index_t node_index, index_t box_begin, index_t box_end );
 
-        void initialize_tree_recursive(
+        double initialize_tree_recursive(
             absl::Span< const BoundingBox< dimension > > bboxes,
             index_t node_index,
             index_t element_begin,
             index_t element_end );
 
+        void refit( absl::Span< const BoundingBox< dimension > > bboxes );
+
+        double refit_quality() const;
+
+        std::array< double, 2 > children_signed_distances(
+            index_t node_index, const Point< dimension >& query ) const
+        {
+            const auto* pair = &nodes_[node_index * PAIR_SIZE];
+            std::array< double, 2 > outside{ { 0, 0 } };
+            std::array< double, 2 > inside{
+                { std::numeric_limits< double >::max(),
+                    std::numeric_limits< double >::max() }
+            };
+            for( const auto c : LRange{ dimension } )
+            {
+                const auto value = query.value( c );
+                const auto* mins = pair + 2 * c;
+                const auto* maxs = pair + 2 * ( dimension + c );
+                for( const auto lane : LRange{ 2 } )
+                {
+                    const auto to_min = value - mins[lane];
+                    const auto to_max = value - maxs[lane];
+                    const auto gap =
+                        std::min( to_min, 0. ) + std::max( to_max, 0. );
+                    outside[lane] += gap * gap;
+                    inside[lane] = std::min( inside[lane],
+                        std::min( std::fabs( to_min ), std::fabs( to_max ) ) );
+                }
+            }
+            std::array< double, 2 > result;
+            for( const auto lane : LRange{ 2 } )
+            {
+                result[lane] = outside[lane] > 0 ? std::sqrt( outside[lane] )
+                                                 : -inside[lane];
+            }
+            return result;
+        }
+
+        std::array< bool, 2 > children_contain(
+            index_t node_index, const Point< dimension >& query ) const
+        {
+            const auto* pair = &nodes_[node_index * PAIR_SIZE];
+            std::array< bool, 2 > result{ { true, true } };
+            for( const auto c : LRange{ dimension } )
+            {
+                const auto value = query.value( c );
+                const auto* mins = pair + 2 * c;
+                const auto* maxs = pair + 2 * ( dimension + c );
+                for( const auto lane : LRange{ 2 } )
+                {
+                    result[lane] = result[lane] && value >= mins[lane]
+                                   && value <= maxs[lane];
+                }
+            }
+            return result;
+        }
+
+        std::array< bool, 2 > children_intersect(
+            index_t node_index, const BoundingBox< dimension >& box ) const
+        {
+            const auto* pair = &nodes_[node_index * PAIR_SIZE];
+            std::array< bool, 2 > result{ { true, true } };
+            for( const auto c : LRange{ dimension } )
+            {
+                const auto box_min = box.min().value( c );
+                const auto box_max = box.max().value( c );
+                const auto* mins = pair + 2 * c;
+                const auto* maxs = pair + 2 * ( dimension + c );
+                for( const auto lane : LRange{ 2 } )
+                {
+                    result[lane] = result[lane] && maxs[lane] >= box_min
+                                   && mins[lane] <= box_max;
+                }
+            }
+            return result;
+        }
+
+        std::array< bool, 2 > children_intersect(
+            index_t node_index, const InfiniteLine< dimension >& line ) const
+        {
+            return children_intersect_line( node_index, line, false );
+        }
+
+        std::array< bool, 2 > children_intersect(
+            index_t node_index, const Ray< dimension >& ray ) const
+        {
+            return children_intersect_line( node_index, ray, true );
+        }
+
+        bool node_intersects( index_t node_index,
+            const Impl& other,
+            index_t other_node_index ) const
+        {
+            for( const auto c : LRange{ dimension } )
+            {
+                if( node_max( node_index, c )
+                        < other.node_min( other_node_index, c )
+                    || node_min( node_index, c )
+                           > other.node_max( other_node_index, c ) )
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
         template < typename ACTION >
-        void closest_element_box_recursive( const Point< dimension >& query,
+        void closest_element_box( const Point< dimension >& query,
             index_t& nearest_box,
             Point< dimension >& nearest_point,
             double& distance,
-            index_t node_index,
-            index_t element_begin,
-            index_t element_end,
             const ACTION& action ) const;
 
         template < typename ACTION >
-        bool bbox_intersect_recursive( const BoundingBox< dimension >& box,
-            index_t node_index,
-            index_t element_begin,
-            index_t element_end,
-            ACTION& action ) const;
+        bool bbox_intersect(
+            const BoundingBox< dimension >& box, ACTION& action ) const;
 
         template < typename ACTION >
         bool self_intersect_recursive( index_t node_index1,
@@ -125,24 +394,176 @@ namespace geode
             ACTION& action ) const;
 
         template < typename Line, typename ACTION >
-        bool line_intersect_recursive( const Line& line,
-            index_t node_index,
-            index_t element_begin,
-            index_t element_end,
+        bool line_intersect( const Line& line, ACTION& action ) const;
+
+        template < typename ACTION >
+        void rays_intersect( absl::Span< const Ray< dimension > > rays,
+            absl::Span< double > max_distances,
+            index_t first_ray,
             ACTION& action ) const;
 
         index_t closest_element_box_hint(
             const Point< dimension >& query ) const;
 
-        void containing_boxes_recursive( index_t node_index,
-            index_t element_begin,
-            index_t element_end,
-            const Point< dimension >& query,
+        void containing_boxes( const Point< dimension >& query,
             std::vector< index_t >& result ) const;
 
+        /*!
+         * Runs the \p action on every query index, in parallel, following
+         * the Morton order of the \p queries.
+         */
+        static void parallel_morton_queries(
+            absl::Span< const Point< dimension > > queries,
+            const std::function< void( index_t ) >& action );
+
+    private:
+        index_t node_offset( index_t node_index ) const
+        {
+            return ( node_index / 2 ) * PAIR_SIZE + node_index % 2;
+        }
+
+        void set_node(
+            index_t node_index, const BoundingBox< dimension >& box );
+
+        void set_node_from_children( index_t node_index );
+
+        double node_surface( index_t node_index ) const;
+
+        double traversal_cost( double internal_nodes_surface ) const;
+
+        /*!
+         * Slab tests of both children of a node against the packet rays in
+         * \p rays. Returns, for each child, the intersecting rays and the
+         * smallest entry distance among them.
+         * @details Loops run over the full packet width without branches so
+         * that they are vectorized. Rays out of \p rays get a negative max
+         * distance and cannot hit. Ray bits are taken from a lane table:
+         * variable shifts would need AVX2 to be vectorized.
+         */
+        std::tuple< std::array< RayMask, 2 >, std::array< double, 2 > >
+            children_intersect_packet( index_t node_index,
+                const RayPacket& packet,
+                RayMask rays ) const
+        {
+            const auto* pair = &nodes_[node_index * PAIR_SIZE];
+            const auto limits = packet_limits( packet, rays );
+            std::array< RayMask, 2 > hits;
+            std::array< double, 2 > entries;
+            for( const auto lane : LRange{ 2 } )
+            {
+                std::tie( hits[lane], entries[lane] ) =
+                    lane_intersect_packet( pair, lane, packet, limits );
+            }
+            return std::make_tuple( hits, entries );
+        }
+
+        /*!
+         * Slab test of a node against the packet rays in \p rays, using
+         * their current max distances.
+         */
+        RayMask node_intersect_packet(
+            index_t node_index, const RayPacket& packet, RayMask rays ) const
+        {
+            const auto* pair = &nodes_[( node_index / 2 ) * PAIR_SIZE];
+            return std::get< 0 >( lane_intersect_packet( pair,
+                node_index % 2, packet, packet_limits( packet, rays ) ) );
+        }
+
+        static std::array< double, RAY_PACKET_SIZE > packet_limits(
+            const RayPacket& packet, RayMask rays )
+        {
+            std::array< double, RAY_PACKET_SIZE > limits;
+            for( index_t r = 0; r < RAY_PACKET_SIZE; r++ )
+            {
+                const auto is_active = ( rays & packet.lane_masks[r] ) != 0;
+                limits[r] = is_active ? packet.max_distances[r] : -1.;
+            }
+            return limits;
+        }
+
+        /*!
+         * Slab test of the box at \p lane of a node pair against the packet
+         * rays, each one limited to the distance given in \p limits.
+         */
+        static std::tuple< RayMask, double > lane_intersect_packet(
+            const double* pair,
+            index_t lane,
+            const RayPacket& packet,
+            const std::array< double, RAY_PACKET_SIZE >& limits )
+        {
+            std::array< double, RAY_PACKET_SIZE > t_entry;
+            std::array< double, RAY_PACKET_SIZE > t_exit;
+            for( index_t r = 0; r < RAY_PACKET_SIZE; r++ )
+            {
+                t_entry[r] = 0;
+                t_exit[r] = limits[r];
+            }
+            for( const auto c : LRange{ dimension } )
+            {
+                const auto min = pair[2 * c + lane] - global_epsilon;
+                const auto max =
+                    pair[2 * ( dimension + c ) + lane] + global_epsilon;
+                const auto& origins = packet.origins[c];
+                const auto& inverses = packet.inverse_directions[c];
+                for( index_t r = 0; r < RAY_PACKET_SIZE; r++ )
+                {
+                    const auto t0 = ( min - origins[r] ) * inverses[r];
+                    const auto t1 = ( max - origins[r] ) * inverses[r];
+                    t_entry[r] = std::max( t_entry[r], std::min( t0, t1 ) );
+                    t_exit[r] = std::min( t_exit[r], std::max( t0, t1 ) );
+                }
+            }
+            RayMask hit{ 0 };
+            for( index_t r = 0; r < RAY_PACKET_SIZE; r++ )
+            {
+                const auto is_hit = t_entry[r] <= t_exit[r];
+                const auto hit_mask =
+                    RayMask{ 0 } - static_cast< RayMask >( is_hit );
+                hit |= packet.lane_masks[r] & hit_mask;
+                t_entry[r] =
+                    is_hit ? t_entry[r] : std::numeric_limits< double >::max();
+            }
+            return std::make_tuple(
+                hit, *std::min_element( t_entry.begin(), t_entry.end() ) );
+        }
+
+        template < typename Line >
+        std::array< bool, 2 > children_intersect_line(
+            index_t node_index, const Line& line, bool is_ray ) const
+        {
+            const auto* pair = &nodes_[node_index * PAIR_SIZE];
+            std::array< bool, 2 > result{ { true, true } };
+            for( const auto lane : LRange{ 2 } )
+            {
+                std::array< double, dimension > half;
+                std::array< double, dimension > origin;
+                for( const auto c : LRange{ dimension } )
+                {
+                    const auto min = pair[2 * c + lane];
+                    const auto max = pair[2 * ( dimension + c ) + lane];
+                    half[c] = ( max - min ) / 2.;
+                    origin[c] = line.origin().value( c ) - ( min + max ) / 2.;
+                    if( is_ray
+                        && std::fabs( origin[c] ) - half[c] > global_epsilon
+                        && origin[c] * line.direction().value( c )
+                               > global_epsilon )
+                    {
+                        result[lane] = false;
+                    }
+                }
+                result[lane] = result[lane]
+                               && detail::line_intersects_box(
+                                   half, origin, line.direction() );
+            }
+            return result;
+        }
+
     private:
-        std::vector< BoundingBox< dimension > > tree_;
+        std::vector< double > nodes_;
         std::vector< index_t > mapping_morton_;
+        BoundingBox< dimension > bbox_;
+        double build_cost_{ 0 };
+        double cost_{ 0 };
     };
 
     template < index_t dimension >
@@ -160,12 +581,28 @@ namespace geode
         Point< dimension > nearest_point;
         std::tie( distance, nearest_point ) = action( query, nearest_box );
 
-        impl_->closest_element_box_recursive( query, nearest_box, nearest_point,
-            distance, Impl::ROOT_INDEX, 0, nb_bboxes(), action );
+        impl_->closest_element_box(
+            query, nearest_box, nearest_point, distance, action );
         OPENGEODE_ASSERT( nearest_box != NO_ID, "No box found" );
         return std::make_tuple( nearest_box, nearest_point, distance );
     }
 
+    template < index_t dimension >
+    template < typename EvalDistance >
+    std::vector< std::tuple< index_t, Point< dimension >, double > >
+        AABBTree< dimension >::closest_element_boxes(
+            absl::Span< const Point< dimension > > queries,
+            const EvalDistance& action ) const
+    {
+        std::vector< std::tuple< index_t, Point< dimension >, double > >
+            result( queries.size() );
+        Impl::parallel_morton_queries(
+            queries, [&result, &queries, &action, this]( index_t q ) {
+                result[q] = closest_element_box( queries[q], action );
+            } );
+        return result;
+    }
+
     template < index_t dimension >
     template < class EvalIntersection >
     void AABBTree< dimension >::compute_bbox_element_bbox_intersections(
@@ -175,8 +612,7 @@ namespace geode
         {
             return;
         }
-        impl_->bbox_intersect_recursive(
-            box, Impl::ROOT_INDEX, 0, nb_bboxes(), action );
+        impl_->bbox_intersect( box, action );
     }
 
     template < index_t dimension >
@@ -215,8 +651,31 @@ namespace geode
         {
             return;
         }
-        impl_->line_intersect_recursive(
-            ray, Impl::ROOT_INDEX, 0, nb_bboxes(), action );
+        impl_->line_intersect( ray, action );
+    }
+
+    template < index_t dimension >
+    template < class EvalIntersection >
+    void AABBTree< dimension >::compute_rays_element_bbox_intersections(
+        absl::Span< const Ray< dimension > > rays,
+        absl::Span< double > max_distances,
+        EvalIntersection& action ) const
+    {
+        OPENGEODE_EXCEPTION( rays.size() == max_distances.size(),
+            "[AABBTree::compute_rays_element_bbox_intersections] Rays and "
+            "max distances should have the same size" );
+        if( nb_bboxes() == 0 )
+        {
+            return;
+        }
+        const auto nb_rays = static_cast< index_t >( rays.size() );
+        const index_t packet_size{ Impl::RAY_PACKET_SIZE };
+        for( index_t begin = 0; begin < nb_rays; begin += packet_size )
+        {
+            const auto size = std::min( packet_size, nb_rays - begin );
+            impl_->rays_intersect( rays.subspan( begin, size ),
+                max_distances.subspan( begin, size ), begin, action );
+        }
     }
 
     template < index_t dimension >
@@ -228,117 +687,113 @@ namespace geode
         {
             return;
         }
-        impl_->line_intersect_recursive(
-            line, Impl::ROOT_INDEX, 0, nb_bboxes(), action );
+        impl_->line_intersect( line, action );
     }
 
     template < index_t dimension >
     template < typename ACTION >
-    void AABBTree< dimension >::Impl::closest_element_box_recursive(
+    void AABBTree< dimension >::Impl::closest_element_box(
         const Point< dimension >& query,
         index_t& nearest_box,
         Point< dimension >& nearest_point,
         double& distance,
-        index_t node_index,
-        index_t box_begin,
-        index_t box_end,
         const ACTION& action ) const
     {
-        OPENGEODE_ASSERT( node_index < tree_.size(), "node out of tree" );
-        OPENGEODE_ASSERT(
-            box_begin != box_end, "Begin and End indices should be different" );
-
-        // If node is a leaf: compute point-element distance
-        // and replace current if nearer
-        if( is_leaf( box_begin, box_end ) )
-        {
-            const auto cur_box = mapping_morton( box_begin );
-            Point< dimension > cur_nearest_point;
-            double cur_distance;
-            std::tie( cur_distance, cur_nearest_point ) =
-                action( query, cur_box );
-            if( cur_distance < distance )
-            {
-                nearest_box = cur_box;
-                nearest_point = cur_nearest_point;
-                distance = cur_distance;
-            }
-            return;
-        }
-        const auto it =
-            get_recursive_iterators( node_index, box_begin, box_end );
-        const auto distance_left =
-            node( it.child_left ).signed_distance( query );
-        const auto distance_right =
-            node( it.child_right ).signed_distance( query );
-
-        // Traverse the "nearest" child first, so that it has more chances
-        // to prune the traversal of the other child.
-        if( distance_left < distance_right )
+        Stack stack;
+        stack.push_back( { ROOT_INDEX, 0, nb_bboxes(),
+            std::numeric_limits< double >::lowest() } );
+        while( !stack.empty() )
         {
-            if( distance_left < distance )
+            const auto current = stack.back();
+            stack.pop_back();
+            // The nearest distance may have decreased since the node was
+            // pushed
+            if( current.distance >= distance )
             {
-                closest_element_box_recursive( query, nearest_box,
-                    nearest_point, distance, it.child_left, box_begin,
-                    it.middle_box, action );
+                continue;
             }
-            if( distance_right < distance )
+
+            // If node is a leaf: compute point-element distance
+            // and replace current if nearer
+            if( is_leaf( current.element_begin, current.element_end ) )
             {
-                closest_element_box_recursive( query, nearest_box,
-                    nearest_point, distance, it.child_right, it.middle_box,
-                    box_end, action );
+                const auto cur_box = mapping_morton( current.element_begin );
+                Point< dimension > cur_nearest_point;
+                double cur_distance;
+                std::tie( cur_distance, cur_nearest_point ) =
+                    action( query, cur_box );
+                if( cur_distance < distance )
+                {
+                    nearest_box = cur_box;
+                    nearest_point = cur_nearest_point;
+                    distance = cur_distance;
+                }
+                continue;
             }
-        }
-        else
-        {
-            if( distance_right < distance )
+            const auto it = get_recursive_iterators( current.node_index,
+                current.element_begin, current.element_end );
+            const auto distances =
+                children_signed_distances( current.node_index, query );
+            const StackNode left{ it.child_left, current.element_begin,
+                it.middle_box, distances[0] };
+            const StackNode right{ it.child_right, it.middle_box,
+                current.element_end, distances[1] };
+
+            // Traverse the "nearest" child first, so that it has more chances
+            // to prune the traversal of the other child.
+            const auto& first = distances[0] < distances[1] ? left : right;
+            const auto& second = distances[0] < distances[1] ? right : left;
+            if( second.distance < distance )
             {
-                closest_element_box_recursive( query, nearest_box,
-                    nearest_point, distance, it.child_right, it.middle_box,
-                    box_end, action );
+                stack.push_back( second );
             }
-            if( distance_left < distance )
+            if( first.distance < distance )
             {
-                closest_element_box_recursive( query, nearest_box,
-                    nearest_point, distance, it.child_left, box_begin,
-                    it.middle_box, action );
+                stack.push_back( first );
             }
         }
     }
 
     template < index_t dimension >
     template < typename ACTION >
-    bool AABBTree< dimension >::Impl::bbox_intersect_recursive(
-        const BoundingBox< dimension >& box,
-        index_t node_index,
-        index_t element_begin,
-        index_t element_end,
-        ACTION& action ) const
+    bool AABBTree< dimension >::Impl::bbox_intersect(
+        const BoundingBox< dimension >& box, ACTION& action ) const
     {
-        OPENGEODE_ASSERT( node_index < tree_.size(), "Node out of tree range" );
-        OPENGEODE_ASSERT(
-            element_begin != element_end, "No iteration allowed start == end" );
-
         // Prune sub-tree that does not have intersection
-        if( !box.intersects( node( node_index ) ) )
+        if( !children_intersect( ROOT_PARENT_INDEX, box )[1] )
         {
             return false;
         }
-
-        if( is_leaf( element_begin, element_end ) )
-        {
-            return action( mapping_morton( element_begin ) );
-        }
-
-        const auto it =
-            get_recursive_iterators( node_index, element_begin, element_end );
-        if( bbox_intersect_recursive(
-                box, it.child_left, element_begin, it.middle_box, action ) )
+        Stack stack;
+        stack.push_back( { ROOT_INDEX, 0, nb_bboxes(), 0 } );
+        while( !stack.empty() )
         {
-            return true;
+            const auto current = stack.back();
+            stack.pop_back();
+            if( is_leaf( current.element_begin, current.element_end ) )
+            {
+                if( action( mapping_morton( current.element_begin ) ) )
+                {
+                    return true;
+                }
+                continue;
+            }
+            const auto it = get_recursive_iterators( current.node_index,
+                current.element_begin, current.element_end );
+            const auto intersect =
+                children_intersect( current.node_index, box );
+            if( intersect[1] )
+            {
+                stack.push_back(
+                    { it.child_right, it.middle_box, current.element_end, 0 } );
+            }
+            if( intersect[0] )
+            {
+                stack.push_back( { it.child_left, current.element_begin,
+                    it.middle_box, 0 } );
+            }
         }
-        return bbox_intersect_recursive(
-            box, it.child_right, it.middle_box, element_end, action );
+        return false;
     }
 
     template < index_t dimension >
@@ -367,7 +822,7 @@ namespace geode
         }
 
         // The acceleration is here:
-        if( !node( node_index1 ).intersects( node( node_index2 ) ) )
+        if( !node_intersects( node_index1, *this, node_index2 ) )
         {
             return false;
         }
@@ -432,8 +887,7 @@ namespace geode
             "No iteration allowed start == end" );
 
         // The acceleration is here:
-        if( !node( node_index1 )
-                 .intersects( other_tree.impl_->node( node_index2 ) ) )
+        if( !node_intersects( node_index1, *other_tree.impl_, node_index2 ) )
         {
             return false;
         }
@@ -479,36 +933,120 @@ namespace geode
 
     template < index_t dimension >
     template < typename Line, typename ACTION >
-    bool AABBTree< dimension >::Impl::line_intersect_recursive(
-        const Line& line,
-        index_t node_index,
-        index_t element_begin,
-        index_t element_end,
-        ACTION& action ) const
+    bool AABBTree< dimension >::Impl::line_intersect(
+        const Line& line, ACTION& action ) const
     {
-        OPENGEODE_ASSERT( node_index < tree_.size(), "Node out of tree range" );
-        OPENGEODE_ASSERT(
-            element_begin != element_end, "No iteration allowed start == end" );
-
         // Prune sub-tree that does not have intersection
-        if( !node( node_index ).intersects( line ) )
+        if( !children_intersect( ROOT_PARENT_INDEX, line )[1] )
         {
             return false;
         }
-
-        if( is_leaf( element_begin, element_end ) )
+        Stack stack;
+        stack.push_back( { ROOT_INDEX, 0, nb_bboxes(), 0 } );
+        while( !stack.empty() )
         {
-            return action( mapping_morton( element_begin ) );
+            const auto current = stack.back();
+            stack.pop_back();
+            if( is_leaf( current.element_begin, current.element_end ) )
+            {
+                if( action( mapping_morton( current.element_begin ) ) )
+                {
+                    return true;
+                }
+                continue;
+            }
+            const auto it = get_recursive_iterators( current.node_index,
+                current.element_begin, current.element_end );
+            const auto intersect =
+                children_intersect( current.node_index, line );
+            if( intersect[1] )
+            {
+                stack.push_back(
+                    { it.child_right, it.middle_box, current.element_end, 0 } );
+            }
+            if( intersect[0] )
+            {
+                stack.push_back( { it.child_left, current.element_begin,
+                    it.middle_box, 0 } );
+            }
         }
+        return false;
+    }
 
-        const auto it =
-            get_recursive_iterators( node_index, element_begin, element_end );
-        if( line_intersect_recursive(
-                line, it.child_left, element_begin, it.middle_box, action ) )
+    template < index_t dimension >
+    template < typename ACTION >
+    void AABBTree< dimension >::Impl::rays_intersect(
+        absl::Span< const Ray< dimension > > rays,
+        absl::Span< double > max_distances,
+        index_t first_ray,
+        ACTION& action ) const
+    {
+        RayPacket packet{ rays, max_distances };
+        RayMask stopped{ 0 };
+        const auto root = std::get< 0 >( children_intersect_packet(
+            ROOT_PARENT_INDEX, packet, packet.all_rays() ) )[1];
+        if( root == 0 )
         {
-            return true;
+            return;
+        }
+        PacketStack stack;
+        stack.push_back( { ROOT_INDEX, 0, nb_bboxes(), root } );
+        while( !stack.empty() )
+        {
+            const auto current = stack.back();
+            stack.pop_back();
+            const auto rays_mask = current.rays & ~stopped;
+            if( rays_mask == 0 )
+            {
+                continue;
+            }
+            if( is_leaf( current.element_begin, current.element_end ) )
+            {
+                // Max distances may have been shortened since the leaf was
+                // pushed: rays now ending before the leaf box are skipped.
+                const auto leaf_rays = node_intersect_packet(
+                    current.node_index, packet, rays_mask );
+                const auto box = mapping_morton( current.element_begin );
+                for( const auto r : Range{ packet.size } )
+                {
+                    if( !( ( leaf_rays >> r ) & RayMask{ 1 } ) )
+                    {
+                        continue;
+                    }
+                    if( action( first_ray + r, box ) )
+                    {
+                        stopped |= RayMask{ 1 } << r;
+                    }
+                    packet.max_distances[r] = max_distances[r];
+                }
+                if( stopped == packet.all_rays() )
+                {
+                    return;
+                }
+                continue;
+            }
+            const auto it = get_recursive_iterators( current.node_index,
+                current.element_begin, current.element_end );
+            std::array< RayMask, 2 > hits;
+            std::array< double, 2 > entries;
+            std::tie( hits, entries ) = children_intersect_packet(
+                current.node_index, packet, rays_mask );
+            const PacketStackNode left{ it.child_left, current.element_begin,
+                it.middle_box, hits[0] };
+            const PacketStackNode right{ it.child_right, it.middle_box,
+                current.element_end, hits[1] };
+            // Visit first the child closest to the ray origins
+            const auto left_first = entries[0] <= entries[1];
+            const auto& first = left_first ? left : right;
+            const auto& second = left_first ? right : left;
+            if( second.rays != 0 )
+            {
+                stack.push_back( second );
+            }
+            if( first.rays != 0 )
+            {
+                stack.push_back( first );
+            }
         }
-        return line_intersect_recursive(
-            line, it.child_right, it.middle_box, element_end, action );
     }
 } // namespace geode
@@ -23,6 +23,8 @@
 
 #pragma once
 
+#include <absl/types/span.h>
+
 #include <geode/basic/pimpl.h>
 
 #include <geode/geometry/common.h>
@@ -59,6 +61,29 @@ namespace geode
             std::vector< Point< dimension > > unique_points;
         };
 
+        /*!
+         * Neighbors of a batch of queries stored in a Compressed Sparse Row
+         * (CSR) layout: the neighbors of the query q are stored in
+         * neighbors[offsets[q]] to neighbors[offsets[q+1]].
+         */
+        struct BatchNeighbors
+        {
+            index_t nb_queries() const
+            {
+                return offsets.size() - 1;
+            }
+
+            absl::Span< const index_t > query_neighbors( index_t query ) const
+            {
+                return absl::MakeConstSpan( neighbors )
+                    .subspan(
+                        offsets[query], offsets[query + 1] - offsets[query] );
+            }
+
+            std::vector< index_t > offsets;
+            std::vector< index_t > neighbors;
+        };
+
     public:
         NNSearch( std::vector< Point< dimension > > points );
         NNSearch( NNSearch&& other );
@@ -96,6 +121,42 @@ namespace geode
         std::vector< index_t > neighbors(
             const Point< dimension >& point, index_t nb_neighbors ) const;
 
+        /*!
+         * Get the closest neighbor of each point of a batch
+         * @param[in] points The requested points
+         * @return the index of the closest point for each requested point
+         * @details Queries are processed in parallel following their Morton
+         * order to improve cache locality during tree traversal.
+         */
+        std::vector< index_t > closest_neighbors(
+            absl::Span< const Point< dimension > > points ) const;
+
+        /*!
+         * Get the neighbors closer than a given distance from each point of a
+         * batch
+         * @param[in] points The centers of the spheres
+         * @param[in] threshold_distance The radius of the spheres
+         * @return the lists of points inside this distance for each requested
+         * point
+         * @details Queries are processed in parallel following their Morton
+         * order to improve cache locality during tree traversal.
+         */
+        BatchNeighbors radius_neighbors(
+            absl::Span< const Point< dimension > > points,
+            double threshold_distance ) const;
+
+        /*!
+         * Get a number of close neighbors from each point of a batch
+         * @param[in] points The requested points
+         * @param[in] nb_neighbors The number of neighbors to return per point
+         * @return the lists of points for each requested point, see
+         * neighbors()
+         * @details Queries are processed in parallel following their Morton
+         * order to improve cache locality during tree traversal.
+         */
+        BatchNeighbors neighbors( absl::Span< const Point< dimension > > points,
+            index_t nb_neighbors ) const;
+
         /*!
          * Compute a colocation mapping from the list of points
          * @param[in] epsilon The approximation allowed to test if two points
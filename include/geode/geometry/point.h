@@ -169,6 +169,18 @@ namespace geode
     };
     ALIAS_1D_AND_2D_AND_3D( Point );
 
+    namespace detail
+    {
+        template < index_t dimension >
+        struct RawColumnValue< Point< dimension > >
+        {
+            static constexpr bool value =
+                RawColumnValue< std::array< double, dimension > >::value
+                && sizeof( Point< dimension > )
+                       == sizeof( std::array< double, dimension > );
+        };
+    } // namespace detail
+
     template < index_t dimension >
     struct AttributeLinearInterpolationImpl< Point< dimension > >
     {
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2019 - 2023 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <tuple>
+#include <vector>
+
+#include <absl/container/fixed_array.h>
+
+#include <geode/geometry/common.h>
+
+namespace geode
+{
+    namespace detail
+    {
+        /*!
+         * Lock-free union-find clustering of points. Each cluster is
+         * represented by its smallest point index whatever the order in
+         * which the pairs are linked, so the result does not depend on the
+         * thread scheduling.
+         */
+        class ColocatedClusters
+        {
+        public:
+            explicit ColocatedClusters( index_t nb_points );
+
+            /*!
+             * Merges the clusters of the two points.
+             * This method is thread-safe.
+             */
+            void link( index_t point0, index_t point1 );
+
+            /*!
+             * Numbers the clusters following the order of their smallest
+             * point.
+             * @return a tuple containing:
+             * - the cluster index of each point.
+             * - the smallest point index of each cluster.
+             */
+            std::tuple< std::vector< index_t >, std::vector< index_t > >
+                compute_mapping();
+
+        private:
+            index_t find_root( index_t point );
+
+        private:
+            absl::FixedArray< std::atomic< index_t > > parents_;
+        };
+    } // namespace detail
+} // namespace geode
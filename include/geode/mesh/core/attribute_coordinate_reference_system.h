@@ -61,6 +61,8 @@ namespace geode
 
         void set_point( index_t point_id, Point< dimension > point ) override;
 
+        absl::Span< const Point< dimension > > points() const override;
+
         absl::string_view attribute_name() const;
 
         index_t nb_points() const;
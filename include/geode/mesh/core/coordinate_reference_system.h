@@ -23,6 +23,8 @@
 
 #pragma once
 
+#include <absl/types/span.h>
+
 #include <geode/basic/named_type.h>
 
 #include <geode/mesh/common.h>
@@ -55,6 +57,15 @@ namespace geode
         virtual void set_point(
             index_t point_id, Point< dimension > point ) = 0;
 
+        /*!
+         * Return all the points as a contiguous array if the CRS stores them
+         * this way, an empty Span otherwise.
+         */
+        virtual absl::Span< const Point< dimension > > points() const
+        {
+            return {};
+        }
+
         template < typename Type, typename Serializer >
         static void register_coordinate_reference_system_type(
             PContext& context, absl::string_view name )
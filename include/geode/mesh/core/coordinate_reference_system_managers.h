@@ -23,6 +23,8 @@
 
 #pragma once
 
+#include <absl/types/span.h>
+
 #include <geode/basic/passkey.h>
 #include <geode/basic/pimpl.h>
 
@@ -63,6 +65,15 @@ namespace geode
 
         const Point< dimension >& point( index_t vertex ) const;
 
+        /*!
+         * Return the points of the active CRS as a contiguous array, or an
+         * empty Span if the active CRS does not store them this way.
+         * The Span is invalidated by any vertex creation, deletion or
+         * permutation and by a change of the active CRS.
+         * @see detail::MeshPoints to iterate on it with a fallback.
+         */
+        absl::Span< const Point< dimension > > points() const;
+
     public:
         CoordinateReferenceSystemManager1D&
             coordinate_reference_system_manager1D( CRSManagersKey );
@@ -56,6 +56,9 @@ namespace geode
                               VertexContainer(),
                               { false, false } ) )
             {
+                facet_attribute_manager_.set_attribute_structural( "counter" );
+                facet_attribute_manager_.set_attribute_structural(
+                    attribute_name() );
             }
 
             AttributeManager& facet_attribute_manager() const
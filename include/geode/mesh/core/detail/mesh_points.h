@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2019 - 2023 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <absl/types/span.h>
+
+#include <geode/basic/assert.h>
+
+#include <geode/geometry/point.h>
+
+#include <geode/mesh/common.h>
+#include <geode/mesh/core/coordinate_reference_system_managers.h>
+
+namespace geode
+{
+    namespace detail
+    {
+        /*!
+         * Read-only access to the mesh points through the contiguous storage
+         * of the active CRS, skipping the CRS indirections. Falls back on
+         * CoordinateReferenceSystemManagers::point when the active CRS does
+         * not store its points contiguously.
+         * The view is invalidated as CoordinateReferenceSystemManagers::points
+         * is, which is checked on each access in debug.
+         */
+        template < index_t dimension >
+        class MeshPoints
+        {
+        public:
+            explicit MeshPoints(
+                const CoordinateReferenceSystemManagers< dimension >& mesh )
+                : mesh_( mesh ), points_( mesh.points() )
+            {
+            }
+
+            const Point< dimension >& point( index_t vertex ) const
+            {
+                OPENGEODE_ASSERT( is_up_to_date(),
+                    "[MeshPoints::point] Mesh points have been modified "
+                    "since the view creation" );
+                if( points_.empty() )
+                {
+                    return mesh_.point( vertex );
+                }
+                return points_[vertex];
+            }
+
+            bool is_contiguous() const
+            {
+                return !points_.empty();
+            }
+
+        private:
+            bool is_up_to_date() const
+            {
+                const auto current = mesh_.points();
+                return current.data() == points_.data()
+                       && current.size() == points_.size();
+            }
+
+        private:
+            const CoordinateReferenceSystemManagers< dimension >& mesh_;
+            absl::Span< const Point< dimension > > points_;
+        };
+        ALIAS_2D_AND_3D( MeshPoints );
+    } // namespace detail
+} // namespace geode
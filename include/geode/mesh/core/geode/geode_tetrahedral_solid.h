@@ -25,6 +25,8 @@
 
 #include <array>
 
+#include <absl/types/span.h>
+
 #include <geode/basic/passkey.h>
 #include <geode/basic/pimpl.h>
 
@@ -82,6 +84,25 @@ namespace geode
             return native_extension_static();
         }
 
+        /*!
+         * Return the storage of the tetrahedron vertices, indexed by
+         * tetrahedron.
+         * The Span is invalidated by any tetrahedron creation, deletion or
+         * permutation.
+         * @see TetrahedralSolidView
+         */
+        absl::Span< const std::array< index_t, 4 > >
+            tetrahedron_vertices_storage() const;
+
+        /*!
+         * Return the storage of the tetrahedron adjacents, indexed by
+         * tetrahedron. NO_ID is stored for facets without adjacent.
+         * The Span is invalidated by any tetrahedron creation, deletion or
+         * permutation.
+         */
+        absl::Span< const std::array< index_t, 4 > >
+            tetrahedron_adjacents_storage() const;
+
     public:
         void set_vertex( index_t vertex_id,
             Point< dimension > point,
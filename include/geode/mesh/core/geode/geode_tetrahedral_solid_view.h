@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2019 - 2023 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <array>
+
+#include <absl/types/optional.h>
+#include <absl/types/span.h>
+
+#include <geode/basic/range.h>
+
+#include <geode/geometry/basic_objects/tetrahedron.h>
+
+#include <geode/mesh/common.h>
+#include <geode/mesh/core/detail/geode_elements.h>
+#include <geode/mesh/core/detail/mesh_points.h>
+#include <geode/mesh/core/geode/geode_tetrahedral_solid.h>
+
+namespace geode
+{
+    /*!
+     * Read-only view on an OpenGeodeTetrahedralSolid reading directly its
+     * storage arrays.
+     * It provides the TetrahedralSolid queries used by element loops and
+     * adjacency walks without any virtual call, so that they can be inlined
+     * in template code (e.g. through GenericMeshAccessor).
+     * The view is invalidated by any modification of the mesh vertices or
+     * tetrahedra.
+     */
+    template < index_t dimension >
+    class TetrahedralSolidView
+    {
+    public:
+        static constexpr auto dim = dimension;
+
+        explicit TetrahedralSolidView(
+            const OpenGeodeTetrahedralSolid< dimension >& mesh )
+            : points_( mesh ),
+              vertices_( mesh.tetrahedron_vertices_storage() ),
+              adjacents_( mesh.tetrahedron_adjacents_storage() ),
+              nb_vertices_( mesh.nb_vertices() )
+        {
+        }
+
+        index_t nb_vertices() const
+        {
+            return nb_vertices_;
+        }
+
+        index_t nb_polyhedra() const
+        {
+            return static_cast< index_t >( vertices_.size() );
+        }
+
+        local_index_t nb_polyhedron_vertices( index_t /*unused*/ ) const
+        {
+            return 4;
+        }
+
+        local_index_t nb_polyhedron_facets( index_t /*unused*/ ) const
+        {
+            return 4;
+        }
+
+        local_index_t nb_polyhedron_facet_vertices(
+            const PolyhedronFacet& /*unused*/ ) const
+        {
+            return 3;
+        }
+
+        const Point< dimension >& point( index_t vertex_id ) const
+        {
+            return points_.point( vertex_id );
+        }
+
+        const std::array< index_t, 4 >& tetrahedron_vertices(
+            index_t tetrahedron_id ) const
+        {
+            return vertices_[tetrahedron_id];
+        }
+
+        index_t polyhedron_vertex(
+            const PolyhedronVertex& polyhedron_vertex ) const
+        {
+            return vertices_[polyhedron_vertex.polyhedron_id]
+                            [polyhedron_vertex.vertex_id];
+        }
+
+        PolyhedronVertices polyhedron_vertices( index_t tetrahedron_id ) const
+        {
+            const auto& vertices = vertices_[tetrahedron_id];
+            return { vertices[0], vertices[1], vertices[2], vertices[3] };
+        }
+
+        index_t polyhedron_facet_vertex(
+            const PolyhedronFacetVertex& polyhedron_facet_vertex ) const
+        {
+            const auto& facet = polyhedron_facet_vertex.polyhedron_facet;
+            return vertices_[facet.polyhedron_id]
+                            [detail::tetrahedron_facet_vertices
+                                    [facet.facet_id]
+                                    [polyhedron_facet_vertex.vertex_id]];
+        }
+
+        PolyhedronFacetVertices polyhedron_facet_vertices(
+            const PolyhedronFacet& polyhedron_facet ) const
+        {
+            const auto& vertices = vertices_[polyhedron_facet.polyhedron_id];
+            const auto& facet_vertices =
+                detail::tetrahedron_facet_vertices[polyhedron_facet.facet_id];
+            return { vertices[facet_vertices[0]], vertices[facet_vertices[1]],
+                vertices[facet_vertices[2]] };
+        }
+
+        absl::optional< index_t > polyhedron_adjacent(
+            const PolyhedronFacet& polyhedron_facet ) const
+        {
+            const auto adjacent = adjacents_[polyhedron_facet.polyhedron_id]
+                                            [polyhedron_facet.facet_id];
+            if( adjacent == NO_ID )
+            {
+                return absl::nullopt;
+            }
+            return adjacent;
+        }
+
+        /*!
+         * The adjacent facet is the one whose opposite vertex in the adjacent
+         * tetrahedron is not a vertex of the given facet.
+         */
+        absl::optional< PolyhedronFacet > polyhedron_adjacent_facet(
+            const PolyhedronFacet& polyhedron_facet ) const
+        {
+            const auto adjacent = adjacents_[polyhedron_facet.polyhedron_id]
+                                            [polyhedron_facet.facet_id];
+            if( adjacent == NO_ID )
+            {
+                return absl::nullopt;
+            }
+            const auto facet_vertices =
+                polyhedron_facet_vertices( polyhedron_facet );
+            const auto& adjacent_vertices = vertices_[adjacent];
+            for( const auto f : LRange{ 4 } )
+            {
+                if( adjacents_[adjacent][f] != polyhedron_facet.polyhedron_id )
+                {
+                    continue;
+                }
+                const auto opposite = adjacent_vertices[f];
+                if( opposite != facet_vertices[0]
+                    && opposite != facet_vertices[1]
+                    && opposite != facet_vertices[2] )
+                {
+                    return absl::optional< PolyhedronFacet >{ absl::in_place,
+                        adjacent, f };
+                }
+            }
+            throw OpenGeodeException{ "[TetrahedralSolidView::polyhedron_"
+                                      "adjacent_facet] Wrong adjacency with "
+                                      "polyhedra: ",
+                polyhedron_facet.polyhedron_id, " and ", adjacent };
+        }
+
+        Tetrahedron tetrahedron( index_t tetrahedron_id ) const
+        {
+            const auto& vertices = vertices_[tetrahedron_id];
+            return { point( vertices[0] ), point( vertices[1] ),
+                point( vertices[2] ), point( vertices[3] ) };
+        }
+
+    private:
+        detail::MeshPoints< dimension > points_;
+        absl::Span< const std::array< index_t, 4 > > vertices_;
+        absl::Span< const std::array< index_t, 4 > > adjacents_;
+        index_t nb_vertices_;
+    };
+    ALIAS_3D( TetrahedralSolidView );
+} // namespace geode
@@ -25,6 +25,8 @@
 
 #include <array>
 
+#include <absl/types/span.h>
+
 #include <geode/basic/passkey.h>
 #include <geode/basic/pimpl.h>
 
@@ -82,6 +84,24 @@ namespace geode
             return native_extension_static();
         }
 
+        /*!
+         * Return the storage of the triangle vertices, indexed by triangle.
+         * The Span is invalidated by any triangle creation, deletion or
+         * permutation.
+         * @see TriangulatedSurfaceView
+         */
+        absl::Span< const std::array< index_t, 3 > >
+            triangle_vertices_storage() const;
+
+        /*!
+         * Return the storage of the triangle adjacents, indexed by triangle.
+         * NO_ID is stored for edges without adjacent.
+         * The Span is invalidated by any triangle creation, deletion or
+         * permutation.
+         */
+        absl::Span< const std::array< index_t, 3 > >
+            triangle_adjacents_storage() const;
+
     public:
         void set_vertex( index_t vertex_id,
             Point< dimension > point,
@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2019 - 2023 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <array>
+
+#include <absl/types/optional.h>
+#include <absl/types/span.h>
+
+#include <geode/basic/range.h>
+
+#include <geode/geometry/basic_objects/triangle.h>
+
+#include <geode/mesh/common.h>
+#include <geode/mesh/core/detail/mesh_points.h>
+#include <geode/mesh/core/geode/geode_triangulated_surface.h>
+
+namespace geode
+{
+    /*!
+     * Read-only view on an OpenGeodeTriangulatedSurface reading directly its
+     * storage arrays.
+     * It provides the TriangulatedSurface queries used by element loops and
+     * adjacency walks without any virtual call, so that they can be inlined
+     * in template code (e.g. through GenericMeshAccessor).
+     * The view is invalidated by any modification of the mesh vertices or
+     * triangles.
+     */
+    template < index_t dimension >
+    class TriangulatedSurfaceView
+    {
+    public:
+        static constexpr auto dim = dimension;
+
+        explicit TriangulatedSurfaceView(
+            const OpenGeodeTriangulatedSurface< dimension >& mesh )
+            : points_( mesh ),
+              vertices_( mesh.triangle_vertices_storage() ),
+              adjacents_( mesh.triangle_adjacents_storage() ),
+              nb_vertices_( mesh.nb_vertices() )
+        {
+        }
+
+        index_t nb_vertices() const
+        {
+            return nb_vertices_;
+        }
+
+        index_t nb_polygons() const
+        {
+            return static_cast< index_t >( vertices_.size() );
+        }
+
+        local_index_t nb_polygon_vertices( index_t /*unused*/ ) const
+        {
+            return 3;
+        }
+
+        local_index_t nb_polygon_edges( index_t /*unused*/ ) const
+        {
+            return 3;
+        }
+
+        const Point< dimension >& point( index_t vertex_id ) const
+        {
+            return points_.point( vertex_id );
+        }
+
+        const std::array< index_t, 3 >& triangle_vertices(
+            index_t triangle_id ) const
+        {
+            return vertices_[triangle_id];
+        }
+
+        index_t polygon_vertex( const PolygonVertex& polygon_vertex ) const
+        {
+            return vertices_[polygon_vertex.polygon_id]
+                            [polygon_vertex.vertex_id];
+        }
+
+        PolygonVertices polygon_vertices( index_t triangle_id ) const
+        {
+            const auto& vertices = vertices_[triangle_id];
+            return { vertices[0], vertices[1], vertices[2] };
+        }
+
+        std::array< index_t, 2 > polygon_edge_vertices(
+            const PolygonEdge& polygon_edge ) const
+        {
+            const auto& vertices = vertices_[polygon_edge.polygon_id];
+            return { vertices[polygon_edge.edge_id],
+                vertices[next_edge( polygon_edge.edge_id )] };
+        }
+
+        absl::optional< index_t > polygon_adjacent(
+            const PolygonEdge& polygon_edge ) const
+        {
+            const auto adjacent =
+                adjacents_[polygon_edge.polygon_id][polygon_edge.edge_id];
+            if( adjacent == NO_ID )
+            {
+                return absl::nullopt;
+            }
+            return adjacent;
+        }
+
+        absl::optional< PolygonEdge > polygon_adjacent_edge(
+            const PolygonEdge& polygon_edge ) const
+        {
+            const auto adjacent =
+                adjacents_[polygon_edge.polygon_id][polygon_edge.edge_id];
+            if( adjacent == NO_ID )
+            {
+                return absl::nullopt;
+            }
+            const auto vertices = polygon_edge_vertices( polygon_edge );
+            for( const auto e : LRange{ 3 } )
+            {
+                if( adjacents_[adjacent][e] != polygon_edge.polygon_id )
+                {
+                    continue;
+                }
+                const auto adjacent_vertices =
+                    polygon_edge_vertices( { adjacent, e } );
+                if( adjacent_vertices == vertices
+                    || ( adjacent_vertices[0] == vertices[1]
+                         && adjacent_vertices[1] == vertices[0] ) )
+                {
+                    return absl::optional< PolygonEdge >{ absl::in_place,
+                        adjacent, e };
+                }
+            }
+            throw OpenGeodeException{ "[TriangulatedSurfaceView::polygon_"
+                                      "adjacent_edge] Wrong adjacency with "
+                                      "polygons: ",
+                polygon_edge.polygon_id, " and ", adjacent };
+        }
+
+        Triangle< dimension > triangle( index_t triangle_id ) const
+        {
+            const auto& vertices = vertices_[triangle_id];
+            return { point( vertices[0] ), point( vertices[1] ),
+                point( vertices[2] ) };
+        }
+
+    private:
+        static local_index_t next_edge( local_index_t edge_id )
+        {
+            return edge_id == 2 ? 0
+                                : static_cast< local_index_t >( edge_id + 1 );
+        }
+
+    private:
+        detail::MeshPoints< dimension > points_;
+        absl::Span< const std::array< index_t, 3 > > vertices_;
+        absl::Span< const std::array< index_t, 3 > > adjacents_;
+        index_t nb_vertices_;
+    };
+    ALIAS_2D_AND_3D( TriangulatedSurfaceView );
+} // namespace geode
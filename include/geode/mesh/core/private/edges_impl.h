@@ -45,6 +45,8 @@ namespace geode
                             std::array< index_t, 2 >{ NO_ID, NO_ID },
                             { false, false } ) )
             {
+                graph.edge_attribute_manager().set_attribute_structural(
+                    "edges" );
             }
 
             index_t get_edge_vertex( const EdgeVertex& edge_vertex ) const
@@ -53,6 +53,11 @@ namespace geode
                 points_->set_value( vertex_id, std::move( point ) );
             }
 
+            absl::Span< const Point< dimension > > points() const
+            {
+                return points_->values();
+            }
+
             index_t nb_points() const
             {
                 return points_->size();
@@ -127,6 +132,7 @@ namespace geode
                               attribute_name, Point< dimension >{} )
                   }
             {
+                manager.set_attribute_structural( attribute_name );
             }
 
         private:
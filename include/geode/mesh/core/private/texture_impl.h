@@ -90,6 +90,7 @@ namespace geode
                           ElementTextureCoordinates >( name, {} )
                   }
             {
+                manager.set_attribute_structural( name );
             }
 
             TextureImpl() = default;
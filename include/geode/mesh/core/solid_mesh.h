@@ -435,6 +435,8 @@ namespace geode
          * Get all the polyhedra with one of the vertices matching given vertex.
          * @param[in] vertex_id Index of the vertex.
          * @pre This function needs that polyhedron adjacencies are computed
+         * @details The result is cached on the first call for each vertex,
+         * concurrent calls are safe as long as the mesh is not modified.
          */
         const PolyhedraAroundVertex& polyhedra_around_vertex(
             index_t vertex_id ) const;
@@ -44,6 +44,14 @@ namespace geode
     AABBTree< dimension > create_aabb_tree(
         const EdgedCurve< dimension >& mesh );
 
+    /*!
+     * Updates the tree boxes after the mesh vertices moved, the mesh
+     * connectivity must be the same as the one used to build the tree.
+     */
+    template < index_t dimension >
+    void refit_aabb_tree(
+        AABBTree< dimension >& tree, const EdgedCurve< dimension >& mesh );
+
     template < index_t dimension >
     class DistanceToEdge
     {
@@ -39,6 +39,14 @@ namespace geode
     AABBTree< dimension > create_aabb_tree(
         const SolidMesh< dimension >& mesh );
 
+    /*!
+     * Updates the tree boxes after the mesh vertices moved, the mesh
+     * connectivity must be the same as the one used to build the tree.
+     */
+    template < index_t dimension >
+    void refit_aabb_tree(
+        AABBTree< dimension >& tree, const SolidMesh< dimension >& mesh );
+
     template < index_t dimension >
     class DistanceToTetrahedron
     {
@@ -27,6 +27,8 @@
 
 #include <absl/types/span.h>
 
+#include <geode/geometry/colocation.h>
+
 #include <geode/mesh/common.h>
 
 namespace geode
@@ -47,7 +49,9 @@ namespace geode
             double axis_coordinate );
 
     template < index_t dimension >
-    std::unique_ptr< EdgedCurve< dimension > > merge_edged_curves( absl::Span<
-        const std::reference_wrapper< const EdgedCurve< dimension > > >
-            curves );
+    std::unique_ptr< EdgedCurve< dimension > > merge_edged_curves(
+        absl::Span<
+            const std::reference_wrapper< const EdgedCurve< dimension > > >
+            curves,
+        ColocationMethod method = ColocationMethod::nn_search );
 } // namespace geode
\ No newline at end of file
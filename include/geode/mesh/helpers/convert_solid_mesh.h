@@ -26,6 +26,8 @@
 #include <absl/types/optional.h>
 #include <absl/types/span.h>
 
+#include <geode/geometry/colocation.h>
+
 #include <geode/mesh/common.h>
 
 namespace geode
@@ -43,5 +45,6 @@ namespace geode
 
     std::unique_ptr< SolidMesh3D > opengeode_mesh_api merge_solid_meshes(
         absl::Span< const std::reference_wrapper< const SolidMesh3D > >
-            solids );
+            solids,
+        ColocationMethod method = ColocationMethod::nn_search );
 } // namespace geode
\ No newline at end of file
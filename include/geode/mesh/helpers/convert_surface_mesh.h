@@ -26,6 +26,8 @@
 #include <absl/types/optional.h>
 #include <absl/types/span.h>
 
+#include <geode/geometry/colocation.h>
+
 #include <geode/mesh/common.h>
 
 namespace geode
@@ -91,5 +93,6 @@ namespace geode
     std::unique_ptr< SurfaceMesh< dimension > > merge_surface_meshes(
         absl::Span<
             const std::reference_wrapper< const SurfaceMesh< dimension > > >
-            surfaces );
+            surfaces,
+        ColocationMethod method = ColocationMethod::nn_search );
 } // namespace geode
\ No newline at end of file
@@ -28,6 +28,8 @@
 #include <absl/container/inlined_vector.h>
 #include <absl/types/span.h>
 
+#include <geode/geometry/colocation.h>
+
 #include <geode/mesh/common.h>
 
 namespace geode
@@ -62,7 +64,8 @@ namespace geode
 
             ~SolidMeshMerger();
 
-            std::unique_ptr< SolidMesh< dimension > > merge();
+            std::unique_ptr< SolidMesh< dimension > > merge(
+                ColocationMethod method = ColocationMethod::nn_search );
 
             index_t vertex_in_merged( index_t solid, index_t vertex ) const;
 
@@ -28,6 +28,8 @@
 #include <absl/container/inlined_vector.h>
 #include <absl/types/span.h>
 
+#include <geode/geometry/colocation.h>
+
 #include <geode/mesh/common.h>
 
 namespace geode
@@ -61,7 +63,8 @@ namespace geode
 
             ~SurfaceMeshMerger();
 
-            std::unique_ptr< SurfaceMesh< dimension > > merge();
+            std::unique_ptr< SurfaceMesh< dimension > > merge(
+                ColocationMethod method = ColocationMethod::nn_search );
 
             index_t vertex_in_merged( index_t surface, index_t vertex ) const;
 
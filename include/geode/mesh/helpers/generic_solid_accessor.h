@@ -26,6 +26,7 @@
 #include <geode/geometry/basic_objects/tetrahedron.h>
 
 #include <geode/mesh/common.h>
+#include <geode/mesh/core/geode/geode_tetrahedral_solid_view.h>
 #include <geode/mesh/core/polyhedral_solid.h>
 #include <geode/mesh/core/tetrahedral_solid.h>
 
@@ -130,6 +131,73 @@ namespace geode
         const TetrahedralSolid< dimension >& mesh_;
     };
 
+    template < index_t dimension >
+    class GenericMeshAccessor< TetrahedralSolidView< dimension > >
+    {
+    public:
+        using Element = Tetrahedron;
+        using ElementVertex = PolyhedronVertex;
+        using ElementVertices = PolyhedronVertices;
+        using ElementFacet = PolyhedronFacet;
+        using ElementFacetVertices = PolyhedronFacetVertices;
+
+        GenericMeshAccessor( const TetrahedralSolidView< dimension >& mesh )
+            : mesh_( mesh )
+        {
+        }
+
+        index_t nb_elements() const
+        {
+            return mesh_.nb_polyhedra();
+        }
+
+        index_t nb_element_vertices( index_t polyhedron_id ) const
+        {
+            return mesh_.nb_polyhedron_vertices( polyhedron_id );
+        }
+
+        index_t nb_element_facets( index_t polyhedron_id ) const
+        {
+            return mesh_.nb_polyhedron_facets( polyhedron_id );
+        }
+
+        index_t element_vertex( const ElementVertex& polyhedron_vertex ) const
+        {
+            return mesh_.polyhedron_vertex( polyhedron_vertex );
+        }
+
+        ElementVertices element_vertices( index_t polyhedron_id ) const
+        {
+            return mesh_.polyhedron_vertices( polyhedron_id );
+        }
+
+        ElementFacetVertices element_facet_vertices(
+            const ElementFacet& polyhedron_facet ) const
+        {
+            return mesh_.polyhedron_facet_vertices( polyhedron_facet );
+        }
+
+        absl::optional< index_t > element_adjacent(
+            const ElementFacet& polyhedron_facet ) const
+        {
+            return mesh_.polyhedron_adjacent( polyhedron_facet );
+        }
+
+        absl::optional< ElementFacet > element_adjacent_facet(
+            const ElementFacet& polyhedron_facet ) const
+        {
+            return mesh_.polyhedron_adjacent_facet( polyhedron_facet );
+        }
+
+        Element element( index_t tetrahedron_id ) const
+        {
+            return mesh_.tetrahedron( tetrahedron_id );
+        }
+
+    private:
+        const TetrahedralSolidView< dimension >& mesh_;
+    };
+
     template < index_t dimension >
     class GenericMeshAccessor< PolyhedralSolid< dimension > >
         : public GenericMeshAccessor< SolidMesh< dimension > >
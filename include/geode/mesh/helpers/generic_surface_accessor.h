@@ -26,6 +26,7 @@
 #include <geode/geometry/basic_objects/triangle.h>
 
 #include <geode/mesh/common.h>
+#include <geode/mesh/core/geode/geode_triangulated_surface_view.h>
 #include <geode/mesh/core/polygonal_surface.h>
 #include <geode/mesh/core/triangulated_surface.h>
 
@@ -124,6 +125,73 @@ namespace geode
         const TriangulatedSurface< dimension >& mesh_;
     };
 
+    template < index_t dimension >
+    class GenericMeshAccessor< TriangulatedSurfaceView< dimension > >
+    {
+    public:
+        using Element = Triangle< dimension >;
+        using ElementVertex = PolygonVertex;
+        using ElementVertices = PolygonVertices;
+        using ElementFacet = PolygonEdge;
+        using ElementFacetVertices = std::array< index_t, 2 >;
+
+        GenericMeshAccessor( const TriangulatedSurfaceView< dimension >& mesh )
+            : mesh_( mesh )
+        {
+        }
+
+        index_t nb_elements() const
+        {
+            return mesh_.nb_polygons();
+        }
+
+        index_t nb_element_vertices( index_t polygon_id ) const
+        {
+            return mesh_.nb_polygon_vertices( polygon_id );
+        }
+
+        index_t nb_element_facets( index_t polygon_id ) const
+        {
+            return mesh_.nb_polygon_edges( polygon_id );
+        }
+
+        index_t element_vertex( const ElementVertex& polygon_vertex ) const
+        {
+            return mesh_.polygon_vertex( polygon_vertex );
+        }
+
+        ElementVertices element_vertices( index_t polygon_id ) const
+        {
+            return mesh_.polygon_vertices( polygon_id );
+        }
+
+        ElementFacetVertices element_facet_vertices(
+            const ElementFacet& polygon_edge ) const
+        {
+            return mesh_.polygon_edge_vertices( polygon_edge );
+        }
+
+        absl::optional< index_t > element_adjacent(
+            const ElementFacet& polygon_edge ) const
+        {
+            return mesh_.polygon_adjacent( polygon_edge );
+        }
+
+        absl::optional< ElementFacet > element_adjacent_facet(
+            const ElementFacet& polygon_edge ) const
+        {
+            return mesh_.polygon_adjacent_edge( polygon_edge );
+        }
+
+        Element element( index_t triangle_id ) const
+        {
+            return mesh_.triangle( triangle_id );
+        }
+
+    private:
+        const TriangulatedSurfaceView< dimension >& mesh_;
+    };
+
     template < index_t dimension >
     class GenericMeshAccessor< PolygonalSurface< dimension > >
         : public GenericMeshAccessor< SurfaceMesh< dimension > >
@@ -23,6 +23,7 @@
 
 #pragma once
 
+#include <geode/geometry/colocation.h>
 #include <geode/geometry/nn_search.h>
 #include <geode/geometry/point.h>
 
@@ -114,9 +115,9 @@ namespace geode
                 return *builder_;
             }
 
-            void create_points()
+            void create_points( ColocationMethod method )
             {
-                auto info = create_colocated_index_mapping();
+                auto info = create_colocated_index_mapping( method );
                 vertices_ = std::move( info.colocated_mapping );
                 for( const auto& point : info.unique_points )
                 {
@@ -125,7 +126,8 @@ namespace geode
             }
 
         private:
-            ColocatedInfo create_colocated_index_mapping()
+            ColocatedInfo create_colocated_index_mapping(
+                ColocationMethod method )
             {
                 index_t nb_points{ 0 };
                 for( const auto& mesh : meshes_ )
@@ -141,8 +143,8 @@ namespace geode
                         points.emplace_back( mesh.get().point( v ) );
                     }
                 }
-                NNSearch< dimension > nnsearch{ std::move( points ) };
-                return nnsearch.colocated_index_mapping( epsilon_ );
+                return colocated_index_mapping(
+                    std::move( points ), epsilon_, method );
             }
 
         private:
@@ -24,6 +24,7 @@
 #pragma once
 
 #include <absl/types/optional.h>
+#include <absl/types/span.h>
 
 #include <geode/basic/pimpl.h>
 
@@ -35,7 +36,9 @@
 
 namespace geode
 {
+    FORWARD_DECLARATION_DIMENSION_CLASS( AABBTree );
     FORWARD_DECLARATION_DIMENSION_CLASS( SurfaceMesh );
+    ALIAS_3D( AABBTree );
     ALIAS_3D( SurfaceMesh );
 } // namespace geode
 
@@ -89,4 +92,49 @@ namespace geode
     private:
         IMPLEMENTATION_MEMBER( impl_ );
     };
+
+    /*!
+     * Closest intersections between many rays and a SurfaceMesh3D.
+     * Rays are traced by packets through a single traversal of the mesh
+     * AABBTree, each ray pruning the tree beyond its closest intersection
+     * found so far. Packets are traced in parallel.
+     */
+    class opengeode_mesh_api RayPacketTracing3D
+    {
+    public:
+        /*!
+         * Closest intersections stored in flat arrays: the i-th value of
+         * each array corresponds to the i-th ray.
+         * Rays without intersection have a NO_ID polygon.
+         */
+        struct ClosestPolygons
+        {
+            explicit ClosestPolygons( index_t nb_rays );
+
+            std::vector< index_t > polygons;
+            std::vector< double > distances;
+            std::vector< Position > positions;
+            std::vector< Point3D > points;
+        };
+
+    public:
+        /*!
+         * @param[in] mesh The mesh to trace.
+         * @param[in] aabb The AABBTree of the \p mesh polygons.
+         */
+        RayPacketTracing3D( const SurfaceMesh3D& mesh, const AABBTree3D& aabb );
+        RayPacketTracing3D( RayPacketTracing3D&& other );
+        ~RayPacketTracing3D();
+
+        /*!
+         * Computes the closest intersection of each ray.
+         * @note Coherent rays (close origins and directions) should be
+         * consecutive to be traced in the same packets.
+         */
+        ClosestPolygons closest_polygons(
+            absl::Span< const Ray3D > rays ) const;
+
+    private:
+        IMPLEMENTATION_MEMBER( impl_ );
+    };
 } // namespace geode
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2019 - 2023 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <absl/types/span.h>
+
+#include <geode/mesh/common.h>
+#include <geode/mesh/core/solid_mesh.h>
+#include <geode/mesh/core/surface_mesh.h>
+
+namespace geode
+{
+    /*!
+     * Incidence between the vertices and the polygons of a SurfaceMesh stored
+     * in a Compressed Sparse Row (CSR) layout: two flat arrays built at once
+     * in parallel. It is an alternative to the per-vertex cache of
+     * SurfaceMesh::polygons_around_vertex when all the vertices are visited.
+     * @note SurfaceMesh::polygons_around_vertex is not computed from this
+     * structure: it orders the polygons around the vertex by walking their
+     * adjacencies, and is kept as a lazy per-vertex cache updated along with
+     * the mesh.
+     * @warning The incidence is not updated when the mesh is modified.
+     */
+    template < index_t dimension >
+    class SurfaceVertexIncidence
+    {
+    public:
+        explicit SurfaceVertexIncidence( const SurfaceMesh< dimension >& mesh );
+
+        index_t nb_vertices() const
+        {
+            return offsets_.size() - 1;
+        }
+
+        /*!
+         * Get all the polygon vertices matching the given vertex, sorted by
+         * polygon index.
+         * @details Contrary to SurfaceMesh::polygons_around_vertex, polygon
+         * adjacencies are not needed and polygons not connected by an edge
+         * around a non-manifold vertex are also returned.
+         */
+        absl::Span< const PolygonVertex > polygons_around_vertex(
+            index_t vertex_id ) const
+        {
+            return absl::MakeConstSpan( polygon_vertices_ )
+                .subspan( offsets_[vertex_id],
+                    offsets_[vertex_id + 1] - offsets_[vertex_id] );
+        }
+
+    private:
+        std::vector< index_t > offsets_;
+        std::vector< PolygonVertex > polygon_vertices_;
+    };
+    ALIAS_2D_AND_3D( SurfaceVertexIncidence );
+
+    /*!
+     * Incidence between the vertices and the polyhedra of a SolidMesh stored
+     * in a Compressed Sparse Row (CSR) layout: two flat arrays built at once
+     * in parallel. It is an alternative to the per-vertex cache of
+     * SolidMesh::polyhedra_around_vertex when all the vertices are visited.
+     * @note SolidMesh::polyhedra_around_vertex is not computed from this
+     * structure: it only returns the polyhedra connected by facets to the
+     * first one found, and is kept as a lazy per-vertex cache updated along
+     * with the mesh.
+     * @warning The incidence is not updated when the mesh is modified.
+     */
+    template < index_t dimension >
+    class SolidVertexIncidence
+    {
+    public:
+        explicit SolidVertexIncidence( const SolidMesh< dimension >& mesh );
+
+        index_t nb_vertices() const
+        {
+            return offsets_.size() - 1;
+        }
+
+        /*!
+         * Get all the polyhedron vertices matching the given vertex, sorted
+         * by polyhedron index.
+         * @details Contrary to SolidMesh::polyhedra_around_vertex, polyhedron
+         * adjacencies are not needed and polyhedra not connected by a facet
+         * around a non-manifold vertex are also returned.
+         */
+        absl::Span< const PolyhedronVertex > polyhedra_around_vertex(
+            index_t vertex_id ) const
+        {
+            return absl::MakeConstSpan( polyhedron_vertices_ )
+                .subspan( offsets_[vertex_id],
+                    offsets_[vertex_id + 1] - offsets_[vertex_id] );
+        }
+
+    private:
+        std::vector< index_t > offsets_;
+        std::vector< PolyhedronVertex > polyhedron_vertices_;
+    };
+    ALIAS_3D( SolidVertexIncidence );
+} // namespace geode
@@ -45,6 +45,18 @@ namespace geode
     void save_edged_curve( const EdgedCurve< dimension >& edged_curve,
         absl::string_view filename );
 
+    /*!
+     * API function for saving a EdgedCurve with given options.
+     * The adequate saver is called depending on the given filename extension.
+     * @param[in] edged_curve EdgedCurve to save.
+     * @param[in] filename Path to the file where save the EdgedCurve.
+     * @param[in] options Writing options, e.g. the attribute layout.
+     */
+    template < index_t dimension >
+    void save_edged_curve( const EdgedCurve< dimension >& edged_curve,
+        absl::string_view filename,
+        const OutputOptions& options );
+
     template < index_t dimension >
     class EdgedCurveOutput : public Output< EdgedCurve< dimension > >
     {
@@ -25,32 +25,80 @@
 
 #include <fstream>
 
+#include <geode/basic/logger.h>
+#include <geode/basic/mapped_file.h>
+
 #include <geode/geometry/bitsery_archive.h>
 
 #include <geode/image/core/bitsery_archive.h>
 
 #include <geode/mesh/core/bitsery_archive.h>
 
+namespace geode
+{
+    namespace detail
+    {
+        /*!
+         * Deserialize a native OpenGeode mesh from the given stream.
+         * @param[in] name Name of the read file, used in error messages.
+         * @param[in] attribute_filter Attributes to load, only honoured for
+         * files written with a columnar attribute layout. Files written with
+         * the row layout are fully loaded and a warning is logged.
+         */
+        template < typename NativeMesh >
+        void read_native_mesh( NativeMesh& mesh,
+            std::istream& stream,
+            absl::string_view name,
+            const AttributeFilter& attribute_filter = {} )
+        {
+            TContext context{};
+            std::get< 3 >( context ).filter = attribute_filter;
+            register_basic_deserialize_pcontext( std::get< 0 >( context ) );
+            register_geometry_deserialize_pcontext( std::get< 0 >( context ) );
+            register_image_deserialize_pcontext( std::get< 0 >( context ) );
+            register_mesh_deserialize_pcontext( std::get< 0 >( context ) );
+            Deserializer archive{ context, stream };
+            archive.object( mesh );
+            const auto& adapter = archive.adapter();
+            OPENGEODE_EXCEPTION(
+                adapter.error() == bitsery::ReaderError::NoError
+                    && adapter.isCompletedSuccessfully()
+                    && std::get< 1 >( context ).isValid(),
+                "[Bitsery::read] Error while reading file: ", name );
+            if( !attribute_filter.loads_all()
+                && std::get< 3 >( context ).layout
+                       == AttributeSerializationLayout::row )
+            {
+                Logger::warn( "[Bitsery::read] File ", name,
+                    " uses the row attribute layout, the attribute filter is "
+                    "ignored and all attributes are loaded" );
+            }
+        }
+
+        /*!
+         * Deserialize a native OpenGeode mesh file mapped in memory.
+         * This avoids the read system calls and intermediate buffer copies
+         * of the file stream.
+         */
+        template < typename NativeMesh >
+        void read_native_mesh_file( NativeMesh& mesh,
+            absl::string_view filename,
+            const AttributeFilter& attribute_filter = {} )
+        {
+            MappedFile file{ filename };
+            read_native_mesh(
+                mesh, file.stream(), filename, attribute_filter );
+        }
+    } // namespace detail
+} // namespace geode
+
 #define BITSERY_READ( Mesh )                                                   \
     std::unique_ptr< Mesh > read( const MeshImpl& impl ) final                 \
     {                                                                          \
-        std::ifstream file{ to_string( this->filename() ),                     \
-            std::ifstream::binary };                                           \
-        OPENGEODE_EXCEPTION( file, "[Bitsery::read] Failed to open file: ",    \
-            to_string( this->filename() ) );                                   \
-        TContext context{};                                                    \
-        register_basic_deserialize_pcontext( std::get< 0 >( context ) );       \
-        register_geometry_deserialize_pcontext( std::get< 0 >( context ) );    \
-        register_image_deserialize_pcontext( std::get< 0 >( context ) );       \
-        register_mesh_deserialize_pcontext( std::get< 0 >( context ) );        \
-        Deserializer archive{ context, file };                                 \
         auto mesh = Mesh::create( impl );                                      \
-        archive.object( dynamic_cast< OpenGeode##Mesh& >( *mesh ) );           \
-        const auto& adapter = archive.adapter();                               \
-        OPENGEODE_EXCEPTION( adapter.error() == bitsery::ReaderError::NoError  \
-                                 && adapter.isCompletedSuccessfully()          \
-                                 && std::get< 1 >( context ).isValid(),        \
-            "[Bitsery::read] Error while reading file: ", this->filename() );  \
+        detail::read_native_mesh_file(                                         \
+            dynamic_cast< OpenGeode##Mesh& >( *mesh ), this->filename(),       \
+            this->attribute_filter() );                                        \
         return mesh;                                                           \
     }
 
@@ -25,27 +25,52 @@
 
 #include <fstream>
 
+#include <geode/basic/output_options.h>
+
 #include <geode/geometry/bitsery_archive.h>
 
 #include <geode/image/core/bitsery_archive.h>
 
 #include <geode/mesh/core/bitsery_archive.h>
 
+namespace geode
+{
+    namespace detail
+    {
+        /*!
+         * Serialize a native OpenGeode mesh into the given stream.
+         * @param[in] name Name of the written file, used in error messages.
+         * @param[in] options Writing options, e.g. the attribute layout.
+         */
+        template < typename NativeMesh >
+        void write_native_mesh( const NativeMesh& mesh,
+            std::ostream& stream,
+            absl::string_view name,
+            const OutputOptions& options )
+        {
+            TContext context{};
+            std::get< 3 >( context ).layout = options.attribute_layout;
+            register_basic_serialize_pcontext( std::get< 0 >( context ) );
+            register_geometry_serialize_pcontext( std::get< 0 >( context ) );
+            register_image_serialize_pcontext( std::get< 0 >( context ) );
+            register_mesh_serialize_pcontext( std::get< 0 >( context ) );
+            Serializer archive{ context, stream };
+            archive.object( mesh );
+            archive.adapter().flush();
+            OPENGEODE_EXCEPTION( std::get< 1 >( context ).isValid(),
+                "[Bitsery::write] Error while writing file: ", name );
+        }
+    } // namespace detail
+} // namespace geode
+
 #define BITSERY_WRITE( Mesh )                                                  \
     void write( const Mesh& mesh ) const final                                 \
     {                                                                          \
         std::ofstream file{ to_string( this->filename() ),                     \
             std::ofstream::binary };                                           \
-        TContext context{};                                                    \
-        register_basic_serialize_pcontext( std::get< 0 >( context ) );         \
-        register_geometry_serialize_pcontext( std::get< 0 >( context ) );      \
-        register_image_serialize_pcontext( std::get< 0 >( context ) );         \
-        register_mesh_serialize_pcontext( std::get< 0 >( context ) );          \
-        Serializer archive{ context, file };                                   \
-        archive.object( dynamic_cast< const OpenGeode##Mesh& >( mesh ) );      \
-        archive.adapter().flush();                                             \
-        OPENGEODE_EXCEPTION( std::get< 1 >( context ).isValid(),               \
-            "[Bitsery::write] Error while writing file: ", this->filename() ); \
+        detail::write_native_mesh(                                             \
+            dynamic_cast< const OpenGeode##Mesh& >( mesh ), file,              \
+            this->filename(), this->options() );                               \
     }
 
 #define BITSERY_OUTPUT_MESH_DIMENSION( Mesh )                                  \
@@ -54,6 +54,31 @@ namespace geode
     std::unique_ptr< Graph > opengeode_mesh_api load_graph(
         absl::string_view filename );
 
+    /*!
+     * API function for loading an Graph.
+     * Only the attributes selected by the filter are loaded. Attributes can
+     * only be skipped in files written with a columnar attribute layout,
+     * see OutputOptions::attribute_layout. Other files are fully loaded and
+     * a warning is logged.
+     * @param[in] impl Data structure implementation.
+     * @param[in] filename Path to the file to load.
+     * @param[in] attribute_filter Attributes to load.
+     */
+    std::unique_ptr< Graph > opengeode_mesh_api load_graph(
+        const MeshImpl& impl,
+        absl::string_view filename,
+        const AttributeFilter& attribute_filter );
+
+    /*!
+     * API function for loading an Graph.
+     * Only the attributes selected by the filter are loaded.
+     * Default data structure implémentation is used.
+     * @param[in] filename Path to the file to load.
+     * @param[in] attribute_filter Attributes to load.
+     */
+    std::unique_ptr< Graph > opengeode_mesh_api load_graph(
+        absl::string_view filename, const AttributeFilter& attribute_filter );
+
     class GraphInput : public Input< std::unique_ptr< Graph >, MeshImpl >
     {
     protected:
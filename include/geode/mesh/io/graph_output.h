@@ -44,6 +44,18 @@ namespace geode
     void opengeode_mesh_api save_graph(
         const Graph& graph, absl::string_view filename );
 
+    /*!
+     * API function for saving a Graph with given options.
+     * The adequate saver is called depending on the given filename extension.
+     * @param[in] graph Graph to save.
+     * @param[in] filename Path to the file where save the Graph.
+     * @param[in] options Writing options, e.g. the attribute layout.
+     */
+    void opengeode_mesh_api save_graph(
+        const Graph& graph,
+        absl::string_view filename,
+        const OutputOptions& options );
+
     class GraphOutput : public Output< Graph >
     {
     protected:
@@ -56,6 +56,33 @@ namespace geode
     std::unique_ptr< HybridSolid< dimension > > load_hybrid_solid(
         absl::string_view filename );
 
+    /*!
+     * API function for loading an HybridSolid.
+     * Only the attributes selected by the filter are loaded. Attributes can
+     * only be skipped in files written with a columnar attribute layout,
+     * see OutputOptions::attribute_layout. Other files are fully loaded and
+     * a warning is logged.
+     * @param[in] impl Data structure implementation.
+     * @param[in] filename Path to the file to load.
+     * @param[in] attribute_filter Attributes to load.
+     */
+    template < index_t dimension >
+    std::unique_ptr< HybridSolid< dimension > > load_hybrid_solid(
+        const MeshImpl& impl,
+        absl::string_view filename,
+        const AttributeFilter& attribute_filter );
+
+    /*!
+     * API function for loading an HybridSolid.
+     * Only the attributes selected by the filter are loaded.
+     * Default data structure implémentation is used.
+     * @param[in] filename Path to the file to load.
+     * @param[in] attribute_filter Attributes to load.
+     */
+    template < index_t dimension >
+    std::unique_ptr< HybridSolid< dimension > > load_hybrid_solid(
+        absl::string_view filename, const AttributeFilter& attribute_filter );
+
     template < index_t dimension >
     class HybridSolidInput
         : public Input< std::unique_ptr< HybridSolid< dimension > >, MeshImpl >
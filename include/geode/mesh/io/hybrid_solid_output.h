@@ -45,6 +45,18 @@ namespace geode
     void save_hybrid_solid( const HybridSolid< dimension >& hybrid_solid,
         absl::string_view filename );
 
+    /*!
+     * API function for saving a HybridSolid with given options.
+     * The adequate saver is called depending on the given filename extension.
+     * @param[in] hybrid_solid HybridSolid to save.
+     * @param[in] filename Path to the file where save the HybridSolid.
+     * @param[in] options Writing options, e.g. the attribute layout.
+     */
+    template < index_t dimension >
+    void save_hybrid_solid( const HybridSolid< dimension >& hybrid_solid,
+        absl::string_view filename,
+        const OutputOptions& options );
+
     template < index_t dimension >
     class HybridSolidOutput : public Output< HybridSolid< dimension > >
     {
@@ -45,6 +45,19 @@ namespace geode
     void save_point_set(
         const PointSet< dimension >& point_set, absl::string_view filename );
 
+    /*!
+     * API function for saving a PointSet with given options.
+     * The adequate saver is called depending on the given filename extension.
+     * @param[in] point_set PointSet to save.
+     * @param[in] filename Path to the file where save the PointSet.
+     * @param[in] options Writing options, e.g. the attribute layout.
+     */
+    template < index_t dimension >
+    void save_point_set(
+        const PointSet< dimension >& point_set,
+        absl::string_view filename,
+        const OutputOptions& options );
+
     template < index_t dimension >
     class PointSetOutput : public Output< PointSet< dimension > >
     {
@@ -56,6 +56,33 @@ namespace geode
     std::unique_ptr< PolygonalSurface< dimension > > load_polygonal_surface(
         absl::string_view filename );
 
+    /*!
+     * API function for loading an PolygonalSurface.
+     * Only the attributes selected by the filter are loaded. Attributes can
+     * only be skipped in files written with a columnar attribute layout,
+     * see OutputOptions::attribute_layout. Other files are fully loaded and
+     * a warning is logged.
+     * @param[in] impl Data structure implementation.
+     * @param[in] filename Path to the file to load.
+     * @param[in] attribute_filter Attributes to load.
+     */
+    template < index_t dimension >
+    std::unique_ptr< PolygonalSurface< dimension > > load_polygonal_surface(
+        const MeshImpl& impl,
+        absl::string_view filename,
+        const AttributeFilter& attribute_filter );
+
+    /*!
+     * API function for loading an PolygonalSurface.
+     * Only the attributes selected by the filter are loaded.
+     * Default data structure implémentation is used.
+     * @param[in] filename Path to the file to load.
+     * @param[in] attribute_filter Attributes to load.
+     */
+    template < index_t dimension >
+    std::unique_ptr< PolygonalSurface< dimension > > load_polygonal_surface(
+        absl::string_view filename, const AttributeFilter& attribute_filter );
+
     template < index_t dimension >
     class PolygonalSurfaceInput
         : public Input< std::unique_ptr< PolygonalSurface< dimension > >,
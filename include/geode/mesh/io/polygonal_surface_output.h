@@ -47,6 +47,20 @@ namespace geode
         const PolygonalSurface< dimension >& polygonal_surface,
         absl::string_view filename );
 
+    /*!
+     * API function for saving a PolygonalSurface with given options.
+     * The adequate saver is called depending on the given filename extension.
+        const PolygonalSurface< dimension >& polygonal_surface,
+     * @param[in] edged_curve PolygonalSurface to save.
+     * @param[in] filename Path to the file where save the PolygonalSurface.
+     * @param[in] options Writing options, e.g. the attribute layout.
+     */
+    template < index_t dimension >
+    void save_polygonal_surface(
+        const PolygonalSurface< dimension >& polygonal_surface,
+        absl::string_view filename,
+        const OutputOptions& options );
+
     template < index_t dimension >
     class PolygonalSurfaceOutput
         : public Output< PolygonalSurface< dimension > >
@@ -46,6 +46,19 @@ namespace geode
         const PolyhedralSolid< dimension >& polyhedral_solid,
         absl::string_view filename );
 
+    /*!
+     * API function for saving a PolyhedralSolid with given options.
+     * The adequate saver is called depending on the given filename extension.
+     * @param[in] polyhedral_solid PolyhedralSolid to save.
+     * @param[in] filename Path to the file where save the PolyhedralSolid.
+     * @param[in] options Writing options, e.g. the attribute layout.
+     */
+    template < index_t dimension >
+    void save_polyhedral_solid(
+        const PolyhedralSolid< dimension >& polyhedral_solid,
+        absl::string_view filename,
+        const OutputOptions& options );
+
     template < index_t dimension >
     class PolyhedralSolidOutput : public Output< PolyhedralSolid< dimension > >
     {
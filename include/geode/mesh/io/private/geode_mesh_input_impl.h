@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2019 - 2023 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+#pragma once
+
+#include <absl/strings/ascii.h>
+
+#include <geode/basic/attribute_filter.h>
+#include <geode/basic/filename.h>
+#include <geode/basic/identifier_builder.h>
+#include <geode/basic/logger.h>
+#include <geode/basic/timer.h>
+
+#include <geode/mesh/core/mesh_id.h>
+
+namespace geode
+{
+    namespace detail
+    {
+        /*!
+         * Load a mesh with the reader registered in the Factory for the
+         * filename extension, and name it after the file if it has no name.
+         * @param[in] type Mesh type name used in the log and error messages.
+         */
+        template < typename Mesh, typename Factory >
+        std::unique_ptr< Mesh > geode_mesh_input_impl( absl::string_view type,
+            const MeshImpl& impl,
+            absl::string_view filename,
+            const AttributeFilter& attribute_filter )
+        {
+            try
+            {
+                Timer timer;
+                const auto extension = absl::AsciiStrToLower(
+                    extension_from_filename( filename ) );
+                OPENGEODE_EXCEPTION( Factory::has_creator( extension ),
+                    "Unknown extension: ", extension );
+                auto input = Factory::create( extension, filename );
+                input->set_attribute_filter( attribute_filter );
+                auto mesh = input->read( impl );
+                if( mesh->name() == Identifier::DEFAULT_NAME )
+                {
+                    IdentifierBuilder{ *mesh }.set_name(
+                        filename_without_extension( filename ) );
+                }
+                Logger::info(
+                    type, " loaded from ", filename, " in ", timer.duration() );
+                return mesh;
+            }
+            catch( const OpenGeodeException& e )
+            {
+                Logger::error( e.what() );
+                throw OpenGeodeException{ "Cannot load ", type,
+                    " from file: ", filename };
+            }
+        }
+    } // namespace detail
+} // namespace geode
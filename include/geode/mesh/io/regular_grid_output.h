@@ -45,6 +45,18 @@ namespace geode
     void save_regular_grid( const RegularGrid< dimension >& regular_grid,
         absl::string_view filename );
 
+    /*!
+     * API function for saving a RegularGrid with given options.
+     * The adequate saver is called depending on the given filename extension.
+     * @param[in] regular_grid RegularGrid to save.
+     * @param[in] filename Path to the file where save the RegularGrid.
+     * @param[in] options Writing options, e.g. the attribute layout.
+     */
+    template < index_t dimension >
+    void save_regular_grid( const RegularGrid< dimension >& regular_grid,
+        absl::string_view filename,
+        const OutputOptions& options );
+
     template < index_t dimension >
     class RegularGridOutput : public Output< RegularGrid< dimension > >
     {
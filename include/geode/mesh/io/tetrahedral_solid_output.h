@@ -46,6 +46,19 @@ namespace geode
         const TetrahedralSolid< dimension >& tetrahedral_solid,
         absl::string_view filename );
 
+    /*!
+     * API function for saving a TetrahedralSolid with given options.
+     * The adequate saver is called depending on the given filename extension.
+     * @param[in] tetrahedral_solid TetrahedralSolid to save.
+     * @param[in] filename Path to the file where save the TetrahedralSolid.
+     * @param[in] options Writing options, e.g. the attribute layout.
+     */
+    template < index_t dimension >
+    void save_tetrahedral_solid(
+        const TetrahedralSolid< dimension >& tetrahedral_solid,
+        absl::string_view filename,
+        const OutputOptions& options );
+
     template < index_t dimension >
     class TetrahedralSolidOutput
         : public Output< TetrahedralSolid< dimension > >
@@ -46,6 +46,19 @@ namespace geode
         const TriangulatedSurface< dimension >& triangulated_surface,
         absl::string_view filename );
 
+    /*!
+     * API function for saving a TriangulatedSurface with given options.
+     * The adequate saver is called depending on the given filename extension.
+     * @param[in] triangulated_surface TriangulatedSurface to save.
+     * @param[in] filename Path to the file where save the TriangulatedSurface.
+     * @param[in] options Writing options, e.g. the attribute layout.
+     */
+    template < index_t dimension >
+    void save_triangulated_surface(
+        const TriangulatedSurface< dimension >& triangulated_surface,
+        absl::string_view filename,
+        const OutputOptions& options );
+
     template < index_t dimension >
     class TriangulatedSurfaceOutput
         : public Output< TriangulatedSurface< dimension > >
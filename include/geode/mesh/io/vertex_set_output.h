@@ -44,6 +44,18 @@ namespace geode
     void opengeode_mesh_api save_vertex_set(
         const VertexSet& vertex_set, absl::string_view filename );
 
+    /*!
+     * API function for saving a VertexSet with given options.
+     * The adequate saver is called depending on the given filename extension.
+     * @param[in] vertex_set VertexSet to save.
+     * @param[in] filename Path to the file where save the VertexSet.
+     * @param[in] options Writing options, e.g. the attribute layout.
+     */
+    void opengeode_mesh_api save_vertex_set(
+        const VertexSet& vertex_set,
+        absl::string_view filename,
+        const OutputOptions& options );
+
     class VertexSetOutput : public Output< VertexSet >
     {
     protected:
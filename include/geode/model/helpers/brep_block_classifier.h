@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2019 - 2023 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <absl/types/span.h>
+
+#include <geode/basic/pimpl.h>
+
+#include <geode/model/common.h>
+
+namespace geode
+{
+    FORWARD_DECLARATION_DIMENSION_CLASS( Point );
+    ALIAS_3D( Point );
+    class BRep;
+    struct uuid;
+} // namespace geode
+
+namespace geode
+{
+    /*!
+     * Finds the Block of a BRep containing given points.
+     * Blocks meshed with a TetrahedralSolid are queried using an AABBTree on
+     * their tetrahedra. Other Blocks are queried by ray parity on their
+     * boundary Surfaces: the ray is cast again in another
+     * direction when it hits a Surface edge or vertex, and a majority vote is
+     * used when every direction does.
+     * The used meshes are pinned in memory during the lifetime of this
+     * object, even if the BRep is read lazily with a memory budget.
+     * @warning The BRep meshes should not be modified during the lifetime of
+     * this object.
+     */
+    class opengeode_model_api BRepBlockClassifier
+    {
+    public:
+        explicit BRepBlockClassifier( const BRep& brep );
+        BRepBlockClassifier( BRepBlockClassifier&& other );
+        ~BRepBlockClassifier();
+
+        index_t nb_blocks() const;
+
+        /*!
+         * Gets the Block id of a given block index.
+         * Block indices follow the BRep::blocks() order.
+         */
+        const uuid& block_id( index_t block_index ) const;
+
+        /*!
+         * Gets the index of the Block containing the point.
+         * @return NO_ID if the point is not inside any Block.
+         * @note A point on a Block boundary belongs to one of the incident
+         * Blocks.
+         */
+        index_t block_index( const Point3D& point ) const;
+
+        /*!
+         * Gets the index of the Block containing each point of a batch.
+         * @details Points are processed in parallel following their Morton
+         * order to improve cache locality during tree traversals.
+         */
+        std::vector< index_t > block_indices(
+            absl::Span< const Point3D > points ) const;
+
+    private:
+        IMPLEMENTATION_MEMBER( impl_ );
+    };
+} // namespace geode
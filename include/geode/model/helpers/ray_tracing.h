@@ -24,6 +24,9 @@
 #pragma once
 
 #include <absl/container/flat_hash_map.h>
+#include <absl/types/span.h>
+
+#include <geode/basic/pimpl.h>
 
 #include <geode/mesh/helpers/ray_tracing.h>
 
@@ -47,4 +50,47 @@ namespace geode
             const BRep& brep,
             const Block3D& block );
 
+    /*!
+     * Ray tracer on the boundary Surfaces of BRep Blocks.
+     * The AABBTree of each Surface mesh is built once, in parallel, at
+     * construction and cached by mesh id: queries reuse them and batches of
+     * lines or rays are answered in parallel.
+     * The used meshes are pinned in memory during the lifetime of this
+     * object, even if the BRep is read lazily with a memory budget.
+     * @warning The BRep meshes should not be modified during the lifetime of
+     * this object.
+     */
+    class opengeode_model_api BRepRayTracer
+    {
+    public:
+        explicit BRepRayTracer( const BRep& brep );
+        BRepRayTracer( BRepRayTracer&& other );
+        ~BRepRayTracer();
+
+        BoundarySurfaceIntersections find_intersections_with_boundaries(
+            const InfiniteLine3D& infinite_line, const Block3D& block ) const;
+
+        BoundarySurfaceIntersections find_intersections_with_boundaries(
+            const Ray3D& ray, const Block3D& block ) const;
+
+        /*!
+         * Compute the intersections of each line with the Block boundaries.
+         * The i-th result corresponds to the i-th line.
+         */
+        std::vector< BoundarySurfaceIntersections >
+            find_intersections_with_boundaries(
+                absl::Span< const InfiniteLine3D > infinite_lines,
+                const Block3D& block ) const;
+
+        /*!
+         * Compute the intersections of each ray with the Block boundaries.
+         * The i-th result corresponds to the i-th ray.
+         */
+        std::vector< BoundarySurfaceIntersections >
+            find_intersections_with_boundaries(
+                absl::Span< const Ray3D > rays, const Block3D& block ) const;
+
+    private:
+        IMPLEMENTATION_MEMBER( impl_ );
+    };
 } // namespace geode
\ No newline at end of file
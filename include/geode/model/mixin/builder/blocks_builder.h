@@ -38,6 +38,11 @@ namespace geode
     FORWARD_DECLARATION_DIMENSION_CLASS( SolidMeshBuilder );
 
     struct uuid;
+
+    namespace detail
+    {
+        class LazyMeshArchive;
+    } // namespace detail
 } // namespace geode
 
 namespace geode
@@ -48,6 +53,13 @@ namespace geode
     public:
         void load_blocks( absl::string_view directory );
 
+        /*!
+         * Load the Blocks and defer the loading of their meshes to their
+         * first access.
+         */
+        void load_blocks( absl::string_view directory,
+            std::shared_ptr< detail::LazyMeshArchive > archive );
+
         /*!
          * Get a pointer to the builder of a Block mesh
          * @param[in] id Unique index of the Block
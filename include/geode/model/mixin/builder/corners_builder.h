@@ -37,6 +37,11 @@ namespace geode
     FORWARD_DECLARATION_DIMENSION_CLASS( PointSetBuilder );
 
     struct uuid;
+
+    namespace detail
+    {
+        class LazyMeshArchive;
+    } // namespace detail
 } // namespace geode
 
 namespace geode
@@ -47,6 +52,13 @@ namespace geode
     public:
         void load_corners( absl::string_view directory );
 
+        /*!
+         * Load the Corners and defer the loading of their meshes to their
+         * first access.
+         */
+        void load_corners( absl::string_view directory,
+            std::shared_ptr< detail::LazyMeshArchive > archive );
+
         /*!
          * Get a pointer to the builder of a Corner mesh
          * @param[in] id Unique index of the Corner
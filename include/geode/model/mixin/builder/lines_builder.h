@@ -37,6 +37,11 @@ namespace geode
     FORWARD_DECLARATION_DIMENSION_CLASS( EdgedCurveBuilder );
 
     struct uuid;
+
+    namespace detail
+    {
+        class LazyMeshArchive;
+    } // namespace detail
 } // namespace geode
 
 namespace geode
@@ -47,6 +52,13 @@ namespace geode
     public:
         void load_lines( absl::string_view directory );
 
+        /*!
+         * Load the Lines and defer the loading of their meshes to their
+         * first access.
+         */
+        void load_lines( absl::string_view directory,
+            std::shared_ptr< detail::LazyMeshArchive > archive );
+
         /*!
          * Get a pointer to the builder of a Line mesh
          * @param[in] id Unique index of the Line
@@ -38,6 +38,11 @@ namespace geode
     FORWARD_DECLARATION_DIMENSION_CLASS( SurfaceMeshBuilder );
 
     struct uuid;
+
+    namespace detail
+    {
+        class LazyMeshArchive;
+    } // namespace detail
 } // namespace geode
 
 namespace geode
@@ -48,6 +53,13 @@ namespace geode
     public:
         void load_surfaces( absl::string_view directory );
 
+        /*!
+         * Load the Surfaces and defer the loading of their meshes to their
+         * first access.
+         */
+        void load_surfaces( absl::string_view directory,
+            std::shared_ptr< detail::LazyMeshArchive > archive );
+
         /*!
          * Get a pointer to the builder of a Surface mesh
          * @param[in] id Unique index of the Surface
@@ -47,6 +47,18 @@ namespace geode
             vertex_identifier_.register_mesh_component( component, {} );
         }
 
+        /*!
+         * Add a component whose mesh is loaded lazily from the archive.
+         * The component is registered when its mesh is loaded.
+         */
+        template < typename MeshComponent >
+        void register_lazy_mesh_component(
+            const MeshComponent& component, detail::LazyMeshArchive& archive )
+        {
+            vertex_identifier_.register_lazy_mesh_component(
+                component, archive, {} );
+        }
+
         /*!
          * Remove a component from the VertexIdentifier and delete corresponding
          * information (i.e. the attribute on component mesh).
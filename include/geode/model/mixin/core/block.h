@@ -23,6 +23,9 @@
 
 #pragma once
 
+#include <functional>
+#include <memory>
+
 #include <geode/basic/passkey.h>
 #include <geode/basic/pimpl.h>
 
@@ -36,6 +39,11 @@ namespace geode
     FORWARD_DECLARATION_DIMENSION_CLASS( Blocks );
     FORWARD_DECLARATION_DIMENSION_CLASS( BlocksBuilder );
     FORWARD_DECLARATION_DIMENSION_CLASS( SolidMesh );
+
+    namespace detail
+    {
+        class LazyMeshArchive;
+    } // namespace detail
 } // namespace geode
 
 namespace geode
@@ -78,6 +86,13 @@ namespace geode
             return dynamic_cast< const Mesh& >( get_mesh() );
         }
 
+        /*!
+         * Access the mesh and keep it in memory as long as the returned
+         * pointer is alive, even if the model is read lazily with a memory
+         * budget.
+         */
+        std::shared_ptr< const SolidMesh< dimension > > pinned_mesh() const;
+
         const MeshImpl& mesh_type() const;
 
         template < typename Mesh = SolidMesh< dimension > >
@@ -94,6 +109,13 @@ namespace geode
         void set_mesh(
             std::unique_ptr< SolidMesh< dimension > > mesh, BlocksKey );
 
+        using MeshLoader =
+            std::function< std::unique_ptr< SolidMesh< dimension > >() >;
+
+        void set_mesh_loader( MeshLoader loader,
+            std::shared_ptr< detail::LazyMeshArchive > archive,
+            BlocksKey );
+
         void set_mesh(
             std::unique_ptr< SolidMesh< dimension > > mesh, BlocksBuilderKey );
 
@@ -35,6 +35,12 @@ namespace geode
     FORWARD_DECLARATION_DIMENSION_CLASS( BlocksBuilder );
 
     struct uuid;
+    class ZipFile;
+
+    namespace detail
+    {
+        class LazyMeshArchive;
+    } // namespace detail
 } // namespace geode
 
 namespace geode
@@ -109,6 +115,11 @@ namespace geode
          */
         void save_blocks( absl::string_view directory ) const;
 
+        /*!
+         * Save each Block as an entry of the given archive
+         */
+        void save_blocks( const ZipFile& zip_writer ) const;
+
     protected:
         Blocks();
         Blocks( Blocks&& );
@@ -139,6 +150,9 @@ namespace geode
 
         void load_blocks( absl::string_view directory );
 
+        void load_blocks( absl::string_view directory,
+            std::shared_ptr< detail::LazyMeshArchive > archive );
+
         ModifiableBlockRange modifiable_blocks();
 
         Block< dimension >& modifiable_block( const uuid& id );
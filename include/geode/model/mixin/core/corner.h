@@ -23,6 +23,9 @@
 
 #pragma once
 
+#include <functional>
+#include <memory>
+
 #include <geode/basic/passkey.h>
 #include <geode/basic/pimpl.h>
 
@@ -36,6 +39,11 @@ namespace geode
     FORWARD_DECLARATION_DIMENSION_CLASS( Corners );
     FORWARD_DECLARATION_DIMENSION_CLASS( CornersBuilder );
     FORWARD_DECLARATION_DIMENSION_CLASS( PointSet );
+
+    namespace detail
+    {
+        class LazyMeshArchive;
+    } // namespace detail
 } // namespace geode
 
 namespace geode
@@ -73,6 +81,13 @@ namespace geode
 
         const PointSet< dimension >& mesh() const;
 
+        /*!
+         * Access the mesh and keep it in memory as long as the returned
+         * pointer is alive, even if the model is read lazily with a memory
+         * budget.
+         */
+        std::shared_ptr< const PointSet< dimension > > pinned_mesh() const;
+
         PointSet< dimension >& modifiable_mesh( CornersKey )
         {
             return modifiable_mesh();
@@ -88,6 +103,13 @@ namespace geode
         void set_mesh(
             std::unique_ptr< PointSet< dimension > > mesh, CornersKey );
 
+        using MeshLoader =
+            std::function< std::unique_ptr< PointSet< dimension > >() >;
+
+        void set_mesh_loader( MeshLoader loader,
+            std::shared_ptr< detail::LazyMeshArchive > archive,
+            CornersKey );
+
         void set_mesh(
             std::unique_ptr< PointSet< dimension > > mesh, CornersBuilderKey );
 
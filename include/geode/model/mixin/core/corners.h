@@ -35,6 +35,12 @@ namespace geode
     FORWARD_DECLARATION_DIMENSION_CLASS( CornersBuilder );
 
     struct uuid;
+    class ZipFile;
+
+    namespace detail
+    {
+        class LazyMeshArchive;
+    } // namespace detail
 } // namespace geode
 
 namespace geode
@@ -108,6 +114,11 @@ namespace geode
          */
         void save_corners( absl::string_view directory ) const;
 
+        /*!
+         * Save each Corner as an entry of the given archive
+         */
+        void save_corners( const ZipFile& zip_writer ) const;
+
     protected:
         Corners();
         Corners( Corners&& );
@@ -138,6 +149,9 @@ namespace geode
 
         void load_corners( absl::string_view directory );
 
+        void load_corners( absl::string_view directory,
+            std::shared_ptr< detail::LazyMeshArchive > archive );
+
         ModifiableCornerRange modifiable_corners();
 
         Corner< dimension >& modifiable_corner( const uuid& id );
@@ -34,6 +34,7 @@
 #include <ghc/filesystem.hpp>
 
 #include <geode/basic/bitsery_archive.h>
+#include <geode/basic/zip_file.h>
 
 #include <geode/geometry/bitsery_archive.h>
 
@@ -96,15 +97,16 @@ namespace geode
             {
                 std::ofstream file{ to_string( filename ),
                     std::ofstream::binary };
-                TContext context{};
-                register_libraries_in_serialize_pcontext( context );
-                Serializer archive{ context, file };
-                archive.object( *this );
-                archive.adapter().flush();
-                OPENGEODE_EXCEPTION( std::get< 1 >( context ).isValid(),
-                    "[ComponentsStorage::save_components] Error while writing "
-                    "file: ",
-                    filename );
+                save_components( file, filename );
+            }
+
+            void save_components(
+                const ZipFile& zip_writer, absl::string_view entry_name ) const
+            {
+                zip_writer.archive_entry(
+                    entry_name, [this, &entry_name]( std::ostream& stream ) {
+                        save_components( stream, entry_name );
+                    } );
             }
 
             void delete_component( const uuid& id )
@@ -175,6 +177,20 @@ namespace geode
             }
 
         private:
+            void save_components(
+                std::ostream& stream, absl::string_view filename ) const
+            {
+                TContext context{};
+                register_libraries_in_serialize_pcontext( context );
+                Serializer archive{ context, stream };
+                archive.object( *this );
+                archive.adapter().flush();
+                OPENGEODE_EXCEPTION( std::get< 1 >( context ).isValid(),
+                    "[ComponentsStorage::save_components] Error while writing "
+                    "file: ",
+                    filename );
+            }
+
             friend class bitsery::Access;
             template < typename Archive >
             void serialize( Archive& archive )
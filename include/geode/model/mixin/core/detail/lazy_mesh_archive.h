@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2019 - 2023 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#include <absl/container/flat_hash_map.h>
+
+#include <geode/basic/uuid.h>
+#include <geode/basic/zip_file.h>
+
+#include <geode/model/common.h>
+
+namespace geode
+{
+    namespace detail
+    {
+        /*!
+         * Interface of a component mesh storage loaded on demand
+         */
+        class EvictableMesh
+        {
+        public:
+            virtual ~EvictableMesh() = default;
+
+            /*!
+             * Release the mesh if \p evict is true, and if it is not pinned
+             * and was not accessed since the previous call. The mesh is then
+             * marked as not accessed.
+             * @return true if the mesh is no longer in memory.
+             */
+            virtual bool evict_untouched_mesh( bool evict ) = 0;
+
+            /*!
+             * Release the mesh if it is not pinned and was not accessed since
+             * the previous evict_untouched_mesh call.
+             * @return true if the mesh is no longer in memory.
+             */
+            virtual bool evict_unused_mesh() = 0;
+        };
+
+        /*!
+         * Model archive read on demand: component meshes are loaded from
+         * their archive entry on first access.
+         * An optional memory budget, in bytes of serialized meshes, bounds
+         * the loaded meshes. Meshes are only released when no reference to
+         * them can be in use:
+         * - on a release_untouched_meshes call, for meshes neither pinned
+         * nor accessed since the previous call,
+         * - on the release of their last pin, for meshes not accessed
+         * without a pin since the previous release_untouched_meshes call.
+         * Released meshes are loaded again on their next access.
+         */
+        class opengeode_model_api LazyMeshArchive
+        {
+        public:
+            /*!
+             * @param[in] filename Path to the model archive.
+             * @param[in] memory_budget Maximum size of the loaded meshes,
+             * 0 means unlimited.
+             */
+            LazyMeshArchive(
+                absl::string_view filename, uint64_t memory_budget );
+
+            const UnzipFile& zip_reader() const
+            {
+                return zip_reader_;
+            }
+
+            bool has_memory_budget() const
+            {
+                return memory_budget_ != 0;
+            }
+
+            /*!
+             * Extract every entry that is not a component mesh in the
+             * temporary directory.
+             * @return The directory containing the extracted files.
+             */
+            std::string extract_model_files() const;
+
+            /*!
+             * Delete the files extracted by extract_model_files.
+             */
+            void remove_model_files() const;
+
+            /*!
+             * Name of the archive entry storing the mesh of a component
+             */
+            const std::string& mesh_entry( const uuid& component_id ) const;
+
+            /*!
+             * Register a function called each time the mesh of the given
+             * component is loaded.
+             * Callbacks should be set before any mesh is loaded.
+             */
+            void set_mesh_loaded_callback(
+                const uuid& component_id, std::function< void() > callback );
+
+            void mesh_loaded( const uuid& component_id ) const;
+
+            /*!
+             * Account for a newly loaded mesh.
+             */
+            void track_mesh( const uuid& component_id, EvictableMesh& mesh );
+
+            void untrack_mesh( const uuid& component_id );
+
+            /*!
+             * While the memory budget is exceeded, release the meshes
+             * neither pinned nor accessed since the previous call.
+             * References returned by mesh() before the previous call should
+             * no longer be used.
+             */
+            void release_untouched_meshes();
+
+            /*!
+             * Release the mesh if the memory budget is exceeded and if it is
+             * neither pinned nor accessed since the previous
+             * release_untouched_meshes call.
+             */
+            void release_unused_mesh( const uuid& component_id );
+
+            uint64_t loaded_size() const
+            {
+                return loaded_size_;
+            }
+
+        private:
+            UnzipFile zip_reader_;
+            uint64_t memory_budget_;
+            absl::flat_hash_map< std::string, std::string > mesh_entries_;
+            std::vector< std::string > model_entries_;
+            absl::flat_hash_map< uuid, std::function< void() > > callbacks_;
+            std::mutex tracking_mutex_;
+            std::vector< std::pair< uuid, EvictableMesh* > > tracked_meshes_;
+            std::atomic< uint64_t > loaded_size_{ 0 };
+        };
+    } // namespace detail
+} // namespace geode
@@ -23,39 +23,130 @@
 
 #pragma once
 
+#include <atomic>
+#include <functional>
 #include <memory>
+#include <mutex>
+
+#include <ghc/filesystem.hpp>
 
 #include <geode/basic/bitsery_archive.h>
 #include <geode/basic/identifier_builder.h>
+#include <geode/basic/output_options.h>
 #include <geode/basic/uuid.h>
+#include <geode/basic/zip_file.h>
 
 #include <geode/mesh/core/mesh_id.h>
+#include <geode/mesh/io/geode/geode_bitsery_mesh_input.h>
+#include <geode/mesh/io/geode/geode_bitsery_mesh_output.h>
+
+#include <geode/model/mixin/core/detail/lazy_mesh_archive.h>
 
 namespace geode
 {
     namespace detail
     {
         template < typename Mesh >
-        class MeshStorage
+        class MeshStorage : public EvictableMesh
         {
         public:
+            using MeshLoader = std::function< std::unique_ptr< Mesh >() >;
+
             MeshStorage() : mesh_type_{ "" } {}
 
+            ~MeshStorage()
+            {
+                if( lazy_ && mesh_ )
+                {
+                    archive_->untrack_mesh( id_ );
+                }
+            }
+
             void set_mesh( uuid new_mesh_uuid, std::unique_ptr< Mesh > mesh )
             {
+                stop_lazy_loading();
                 mesh_type_ = mesh->impl_name();
                 mesh_ = std::move( mesh );
                 IdentifierBuilder mesh_builder{ *mesh_ };
                 mesh_builder.set_id( std::move( new_mesh_uuid ) );
             }
 
+            /*!
+             * Defer the mesh loading to its first access.
+             */
+            void set_mesh_loader( uuid new_mesh_uuid,
+                MeshLoader loader,
+                std::shared_ptr< LazyMeshArchive > archive )
+            {
+                stop_lazy_loading();
+                mesh_.reset();
+                id_ = std::move( new_mesh_uuid );
+                loader_ = std::move( loader );
+                archive_ = std::move( archive );
+                lazy_ = true;
+            }
+
+            /*!
+             * Access the mesh. A lazily loaded mesh is kept in memory at
+             * least until the next LazyMeshArchive::release_untouched_meshes
+             * call.
+             */
             const Mesh& mesh() const
             {
+                if( lazy_.load( std::memory_order_acquire ) )
+                {
+                    return lazy_mesh( true );
+                }
                 return *mesh_;
             }
 
+            /*!
+             * Access the mesh and keep it in memory until the returned
+             * pointer is released: a pinned mesh is never evicted.
+             * A mesh only accessed through pins is released with its last
+             * pin if the memory budget is exceeded.
+             */
+            std::shared_ptr< const Mesh > pinned_mesh() const
+            {
+                if( !lazy_.load( std::memory_order_acquire ) )
+                {
+                    return std::shared_ptr< const Mesh >{ mesh_.get(),
+                        []( const Mesh* /*unused*/ ) {} };
+                }
+                {
+                    std::lock_guard< std::recursive_mutex > lock{
+                        lazy_mutex_
+                    };
+                    pins_++;
+                }
+                const auto* mesh = &lazy_mesh( false );
+                return std::shared_ptr< const Mesh >{ mesh,
+                    [this]( const Mesh* /*unused*/ ) {
+                        std::shared_ptr< LazyMeshArchive > archive;
+                        {
+                            std::lock_guard< std::recursive_mutex > lock{
+                                lazy_mutex_
+                            };
+                            pins_--;
+                            if( pins_ == 0 && lazy_ && !touched_ )
+                            {
+                                archive = archive_;
+                            }
+                        }
+                        if( archive )
+                        {
+                            archive->release_unused_mesh( id_ );
+                        }
+                    } };
+            }
+
             Mesh& modifiable_mesh()
             {
+                if( lazy_.load( std::memory_order_acquire ) )
+                {
+                    lazy_mesh( true );
+                    stop_lazy_loading();
+                }
                 return *mesh_;
             }
 
@@ -64,6 +155,35 @@ namespace geode
                 return mesh_type_;
             }
 
+            bool evict_untouched_mesh( bool evict ) final
+            {
+                std::unique_lock< std::recursive_mutex > lock{ lazy_mutex_,
+                    std::try_to_lock };
+                if( !lock.owns_lock() )
+                {
+                    return false;
+                }
+                const auto was_touched = touched_.exchange( false );
+                if( !evict || was_touched || !lazy_ || pins_ > 0 )
+                {
+                    return false;
+                }
+                mesh_.reset();
+                return true;
+            }
+
+            bool evict_unused_mesh() final
+            {
+                std::unique_lock< std::recursive_mutex > lock{ lazy_mutex_,
+                    std::try_to_lock };
+                if( !lock.owns_lock() || touched_ || !lazy_ || pins_ > 0 )
+                {
+                    return false;
+                }
+                mesh_.reset();
+                return true;
+            }
+
             template < typename Archive >
             void serialize( Archive& archive )
             {
@@ -75,8 +195,144 @@ namespace geode
             }
 
         private:
-            std::unique_ptr< Mesh > mesh_;
+            const Mesh& lazy_mesh( bool touch ) const
+            {
+                bool loaded{ false };
+                const Mesh* mesh{ nullptr };
+                {
+                    std::lock_guard< std::recursive_mutex > lock{
+                        lazy_mutex_
+                    };
+                    if( touch )
+                    {
+                        touched_ = true;
+                    }
+                    if( !mesh_ )
+                    {
+                        mesh_ = loader_();
+                        IdentifierBuilder mesh_builder{ *mesh_ };
+                        mesh_builder.set_id( id_ );
+                        loaded = true;
+                        // Accesses from the loading callbacks do not count
+                        const bool touched = touched_;
+                        archive_->mesh_loaded( id_ );
+                        touched_ = touched;
+                    }
+                    mesh = mesh_.get();
+                }
+                if( loaded )
+                {
+                    if( archive_->has_memory_budget() )
+                    {
+                        archive_->track_mesh(
+                            id_, const_cast< MeshStorage& >( *this ) );
+                    }
+                    else
+                    {
+                        lazy_.store( false, std::memory_order_release );
+                    }
+                }
+                return *mesh;
+            }
+
+            void stop_lazy_loading()
+            {
+                std::lock_guard< std::recursive_mutex > lock{ lazy_mutex_ };
+                if( !archive_ )
+                {
+                    return;
+                }
+                if( lazy_ && mesh_ )
+                {
+                    archive_->untrack_mesh( id_ );
+                }
+                lazy_ = false;
+                loader_ = nullptr;
+                archive_.reset();
+            }
+
+        private:
+            mutable std::unique_ptr< Mesh > mesh_;
             MeshImpl mesh_type_;
+            uuid id_;
+            MeshLoader loader_;
+            std::shared_ptr< LazyMeshArchive > archive_;
+            mutable std::atomic< bool > lazy_{ false };
+            mutable std::atomic< bool > touched_{ false };
+            mutable index_t pins_{ 0 };
+            mutable std::recursive_mutex lazy_mutex_;
         };
+
+        /*!
+         * Load a mesh from an archive entry.
+         * Meshes implemented by NativeMesh are deserialized straight from
+         * the entry, other implementations are extracted in a temporary file
+         * read by the given loading function.
+         */
+        template < typename NativeMesh, typename SpecificMesh >
+        std::unique_ptr< SpecificMesh > load_archived_mesh(
+            const UnzipFile& zip_reader,
+            absl::string_view entry_name,
+            const MeshImpl& impl,
+            std::unique_ptr< SpecificMesh > ( *load )(
+                const MeshImpl&, absl::string_view ) )
+        {
+            if( impl == NativeMesh::impl_name_static() )
+            {
+                auto mesh = SpecificMesh::create( impl );
+                auto& native = dynamic_cast< NativeMesh& >( *mesh );
+                zip_reader.read_entry(
+                    entry_name, [&native, &entry_name]( std::istream& stream ) {
+                        read_native_mesh( native, stream, entry_name );
+                    } );
+                return mesh;
+            }
+            const auto file = zip_reader.extract_entry( entry_name );
+            auto mesh = load( impl, file );
+            ghc::filesystem::remove( file );
+            return mesh;
+        }
+
+        /*!
+         * Serialize the mesh straight into a new archive entry if it is
+         * implemented by NativeMesh.
+         * @return false if the mesh has another implementation.
+         */
+        template < typename NativeMesh, typename Mesh >
+        bool archive_native_mesh( const ZipFile& zip_writer,
+            absl::string_view entry_name,
+            const Mesh& mesh )
+        {
+            if( mesh.impl_name() != NativeMesh::impl_name_static() )
+            {
+                return false;
+            }
+            const auto& native = dynamic_cast< const NativeMesh& >( mesh );
+            zip_writer.archive_entry( entry_name,
+                [&native, &entry_name, &zip_writer]( std::ostream& stream ) {
+                    write_native_mesh(
+                        native, stream, entry_name, zip_writer.options() );
+                } );
+            return true;
+        }
+
+        /*!
+         * Create a loader reading a mesh from its archive entry
+         * @tparam Mesh Base mesh type stored by the component.
+         */
+        template < typename Mesh, typename NativeMesh, typename SpecificMesh >
+        std::function< std::unique_ptr< Mesh >() > archived_mesh_loader(
+            std::shared_ptr< LazyMeshArchive > archive,
+            std::string entry_name,
+            MeshImpl impl,
+            std::unique_ptr< SpecificMesh > ( *load )(
+                const MeshImpl&, absl::string_view ) )
+        {
+            return [archive, entry_name, impl,
+                       load]() -> std::unique_ptr< Mesh > {
+                return load_archived_mesh< NativeMesh >(
+                    archive->zip_reader(), entry_name, impl, load );
+            };
+        }
     } // namespace detail
 } // namespace geode
@@ -23,6 +23,9 @@
 
 #pragma once
 
+#include <functional>
+#include <memory>
+
 #include <geode/basic/passkey.h>
 #include <geode/basic/pimpl.h>
 
@@ -36,6 +39,11 @@ namespace geode
     FORWARD_DECLARATION_DIMENSION_CLASS( EdgedCurve );
     FORWARD_DECLARATION_DIMENSION_CLASS( Lines );
     FORWARD_DECLARATION_DIMENSION_CLASS( LinesBuilder );
+
+    namespace detail
+    {
+        class LazyMeshArchive;
+    } // namespace detail
 } // namespace geode
 
 namespace geode
@@ -73,6 +81,13 @@ namespace geode
 
         const EdgedCurve< dimension >& mesh() const;
 
+        /*!
+         * Access the mesh and keep it in memory as long as the returned
+         * pointer is alive, even if the model is read lazily with a memory
+         * budget.
+         */
+        std::shared_ptr< const EdgedCurve< dimension > > pinned_mesh() const;
+
         const MeshImpl& mesh_type() const;
 
         EdgedCurve< dimension >& modifiable_mesh( LinesKey )
@@ -88,6 +103,13 @@ namespace geode
         void set_mesh(
             std::unique_ptr< EdgedCurve< dimension > > mesh, LinesKey );
 
+        using MeshLoader =
+            std::function< std::unique_ptr< EdgedCurve< dimension > >() >;
+
+        void set_mesh_loader( MeshLoader loader,
+            std::shared_ptr< detail::LazyMeshArchive > archive,
+            LinesKey );
+
         void set_mesh(
             std::unique_ptr< EdgedCurve< dimension > > mesh, LinesBuilderKey );
 
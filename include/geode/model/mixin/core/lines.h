@@ -35,6 +35,12 @@ namespace geode
     FORWARD_DECLARATION_DIMENSION_CLASS( LinesBuilder );
 
     struct uuid;
+    class ZipFile;
+
+    namespace detail
+    {
+        class LazyMeshArchive;
+    } // namespace detail
 } // namespace geode
 
 namespace geode
@@ -93,6 +99,11 @@ namespace geode
 
         void save_lines( absl::string_view directory ) const;
 
+        /*!
+         * Save each Line as an entry of the given archive
+         */
+        void save_lines( const ZipFile& zip_writer ) const;
+
     protected:
         Lines();
         Lines( Lines&& );
@@ -123,6 +134,9 @@ namespace geode
 
         void load_lines( absl::string_view directory );
 
+        void load_lines( absl::string_view directory,
+            std::shared_ptr< detail::LazyMeshArchive > archive );
+
         ModifiableLineRange modifiable_lines();
 
         Line< dimension >& modifiable_line( const uuid& id );
@@ -35,6 +35,7 @@ namespace geode
     FORWARD_DECLARATION_DIMENSION_CLASS( ModelBoundariesBuilder );
 
     struct uuid;
+    class ZipFile;
 } // namespace geode
 
 namespace geode
@@ -93,6 +94,11 @@ namespace geode
 
         void save_model_boundaries( absl::string_view directory ) const;
 
+        /*!
+         * Save each ModelBoundary as an entry of the given archive
+         */
+        void save_model_boundaries( const ZipFile& zip_writer ) const;
+
     protected:
         ModelBoundaries();
         ModelBoundaries( ModelBoundaries&& );
@@ -35,6 +35,7 @@ namespace geode
     class AttributeManager;
     class RelationshipsBuilder;
     struct uuid;
+    class ZipFile;
 } // namespace geode
 
 namespace geode
@@ -388,6 +389,8 @@ namespace geode
 
         void save_relationships( absl::string_view directory ) const;
 
+        void save_relationships( const ZipFile& zip_writer ) const;
+
     public:
         /*!
          * Remove a component from the set of components registered by the
@@ -23,6 +23,9 @@
 
 #pragma once
 
+#include <functional>
+#include <memory>
+
 #include <geode/basic/passkey.h>
 #include <geode/basic/pimpl.h>
 
@@ -36,6 +39,11 @@ namespace geode
     FORWARD_DECLARATION_DIMENSION_CLASS( SurfaceMesh );
     FORWARD_DECLARATION_DIMENSION_CLASS( Surfaces );
     FORWARD_DECLARATION_DIMENSION_CLASS( SurfacesBuilder );
+
+    namespace detail
+    {
+        class LazyMeshArchive;
+    } // namespace detail
 } // namespace geode
 
 namespace geode
@@ -77,6 +85,13 @@ namespace geode
             return dynamic_cast< const Mesh& >( get_mesh() );
         }
 
+        /*!
+         * Access the mesh and keep it in memory as long as the returned
+         * pointer is alive, even if the model is read lazily with a memory
+         * budget.
+         */
+        std::shared_ptr< const SurfaceMesh< dimension > > pinned_mesh() const;
+
     public:
         Surface( SurfacesKey ) : Surface() {}
 
@@ -93,6 +108,13 @@ namespace geode
         void set_mesh(
             std::unique_ptr< SurfaceMesh< dimension > > mesh, SurfacesKey );
 
+        using MeshLoader =
+            std::function< std::unique_ptr< SurfaceMesh< dimension > >() >;
+
+        void set_mesh_loader( MeshLoader loader,
+            std::shared_ptr< detail::LazyMeshArchive > archive,
+            SurfacesKey );
+
         void set_mesh( std::unique_ptr< SurfaceMesh< dimension > > mesh,
             SurfacesBuilderKey );
 
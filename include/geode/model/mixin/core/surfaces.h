@@ -35,6 +35,12 @@ namespace geode
     FORWARD_DECLARATION_DIMENSION_CLASS( SurfacesBuilder );
 
     struct uuid;
+    class ZipFile;
+
+    namespace detail
+    {
+        class LazyMeshArchive;
+    } // namespace detail
 } // namespace geode
 
 namespace geode
@@ -93,6 +99,11 @@ namespace geode
 
         void save_surfaces( absl::string_view directory ) const;
 
+        /*!
+         * Save each Surface as an entry of the given archive
+         */
+        void save_surfaces( const ZipFile& zip_writer ) const;
+
     protected:
         Surfaces();
         Surfaces( Surfaces&& );
@@ -123,6 +134,9 @@ namespace geode
 
         void load_surfaces( absl::string_view directory );
 
+        void load_surfaces( absl::string_view directory,
+            std::shared_ptr< detail::LazyMeshArchive > archive );
+
         ModifiableSurfaceRange modifiable_surfaces();
 
         Surface< dimension >& modifiable_surface( const uuid& id );
@@ -1,5 +1,10 @@
 #pragma once
 
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
 #include <absl/types/span.h>
 
 #include <geode/basic/passkey.h>
@@ -12,6 +17,12 @@ namespace geode
 {
     struct MeshVertex;
     class VertexIdentifierBuilder;
+    class ZipFile;
+
+    namespace detail
+    {
+        class LazyMeshArchive;
+    } // namespace detail
 } // namespace geode
 
 namespace geode
@@ -41,6 +52,168 @@ namespace geode
         ComponentMeshVertex();
     };
 
+    /*!
+     * Read-only view on the component vertices identified with an unique
+     * vertex. Vertices are built on access from the compact storage of the
+     * VertexIdentifier.
+     * The view is invalidated by any modification of the VertexIdentifier.
+     */
+    class ComponentMeshVerticesView
+    {
+    public:
+        /*!
+         * Component vertex stored as an index in the component table.
+         */
+        struct CompactVertex
+        {
+            CompactVertex() = default;
+            CompactVertex( index_t component_in, index_t vertex_in )
+                : component( component_in ), vertex( vertex_in )
+            {
+            }
+
+            bool operator==( const CompactVertex& other ) const
+            {
+                return component == other.component && vertex == other.vertex;
+            }
+
+            index_t component{ NO_ID };
+            index_t vertex{ NO_ID };
+        };
+
+        /*!
+         * Input iterator building the ComponentMeshVertex on dereference.
+         * It only refers to the VertexIdentifier storage, so it remains
+         * valid after the view is destroyed, until the VertexIdentifier is
+         * modified.
+         */
+        class Iterator
+        {
+        public:
+            /*!
+             * Holder of a dereferenced vertex to support operator->.
+             */
+            class ArrowProxy
+            {
+            public:
+                explicit ArrowProxy( ComponentMeshVertex vertex )
+                    : vertex_( std::move( vertex ) )
+                {
+                }
+
+                const ComponentMeshVertex* operator->() const
+                {
+                    return &vertex_;
+                }
+
+            private:
+                ComponentMeshVertex vertex_;
+            };
+
+            using iterator_category = std::input_iterator_tag;
+            using value_type = ComponentMeshVertex;
+            using difference_type = std::ptrdiff_t;
+            using pointer = ArrowProxy;
+            using reference = ComponentMeshVertex;
+
+            Iterator( const CompactVertex* vertex,
+                absl::Span< const ComponentID > components )
+                : vertex_( vertex ), components_( components )
+            {
+            }
+
+            bool operator==( const Iterator& other ) const
+            {
+                return vertex_ == other.vertex_;
+            }
+
+            bool operator!=( const Iterator& other ) const
+            {
+                return !( *this == other );
+            }
+
+            Iterator& operator++()
+            {
+                vertex_++;
+                return *this;
+            }
+
+            Iterator operator++( int )
+            {
+                auto previous = *this;
+                vertex_++;
+                return previous;
+            }
+
+            reference operator*() const
+            {
+                return { components_[vertex_->component], vertex_->vertex };
+            }
+
+            pointer operator->() const
+            {
+                return ArrowProxy{ operator*() };
+            }
+
+        private:
+            const CompactVertex* vertex_;
+            absl::Span< const ComponentID > components_;
+        };
+
+        ComponentMeshVerticesView( absl::Span< const CompactVertex > vertices,
+            absl::Span< const ComponentID > components )
+            : vertices_( vertices ), components_( components )
+        {
+        }
+
+        index_t size() const
+        {
+            return static_cast< index_t >( vertices_.size() );
+        }
+
+        bool empty() const
+        {
+            return vertices_.empty();
+        }
+
+        ComponentMeshVertex operator[]( index_t index ) const
+        {
+            const auto& vertex = vertices_[index];
+            return { components_[vertex.component], vertex.vertex };
+        }
+
+        ComponentMeshVertex front() const
+        {
+            return operator[]( 0 );
+        }
+
+        Iterator begin() const
+        {
+            return { vertices_.data(), components_ };
+        }
+
+        Iterator end() const
+        {
+            return { vertices_.data() + vertices_.size(), components_ };
+        }
+
+        std::vector< ComponentMeshVertex > to_vector() const
+        {
+            std::vector< ComponentMeshVertex > result;
+            result.reserve( vertices_.size() );
+            for( const auto& vertex : vertices_ )
+            {
+                result.emplace_back(
+                    components_[vertex.component], vertex.vertex );
+            }
+            return result;
+        }
+
+    private:
+        absl::Span< const CompactVertex > vertices_;
+        absl::Span< const ComponentID > components_;
+    };
+
     /*!
      * This class identifies groups of geometric component vertices
      * as unique vertices.
@@ -60,9 +233,11 @@ namespace geode
 
         /*!
          * Return the component vertices identified with an unique vertex.
+         * The returned view is invalidated by any modification of the
+         * VertexIdentifier.
          * @param[in] unique_vertex_id Indice of the unique vertex.
          */
-        const std::vector< ComponentMeshVertex >& component_mesh_vertices(
+        ComponentMeshVerticesView component_mesh_vertices(
             index_t unique_vertex_id ) const;
 
         /*!
@@ -111,14 +286,26 @@ namespace geode
          */
         void save_unique_vertices( absl::string_view directory ) const;
 
+        void save_unique_vertices( const ZipFile& zip_writer ) const;
+
     public:
         /*!
-         * Add a component in the VertexIdentifier
+         * Add a component in the VertexIdentifier.
+         * Different components can be registered concurrently.
          */
         template < typename MeshComponent >
         void register_mesh_component(
             const MeshComponent& component, BuilderKey );
 
+        /*!
+         * Add a component whose mesh is loaded lazily from the archive.
+         * The component is registered when its mesh is loaded.
+         */
+        template < typename MeshComponent >
+        void register_lazy_mesh_component( const MeshComponent& component,
+            detail::LazyMeshArchive& archive,
+            BuilderKey );
+
         /*!
          * Remove a component from the VertexIdentifier and delete corresponding
          * information (i.e. the attribute on component mesh).
@@ -141,6 +328,7 @@ namespace geode
 
         /*!
          * Identify a component vertex to an existing unique vertex index.
+         * Different unique vertices can be set concurrently.
          * @param[in] component_vertex_id Index of the vertex in the component.
          * @param[in] unique_vertex_id Unique vertex index.
          */
@@ -44,6 +44,17 @@ namespace geode
     void opengeode_model_api save_brep(
         const BRep& brep, absl::string_view filename );
 
+    /*!
+     * API function for saving a BoundaryRepresentation with given options.
+     * The adequate saver is called depending on the given filename extension.
+     * @param[in] brep BRep to save.
+     * @param[in] filename Path to the file where save the brep.
+     * @param[in] options Writing options, e.g. the archive compression.
+     */
+    void opengeode_model_api save_brep( const BRep& brep,
+        absl::string_view filename,
+        const OutputOptions& options );
+
     class BRepOutput : public Output< BRep >
     {
     protected:
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2019 - 2023 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <async++.h>
+
+#include <geode/basic/logger.h>
+#include <geode/basic/timer.h>
+
+#include <geode/model/common.h>
+
+namespace geode
+{
+    namespace detail
+    {
+        /*!
+         * Durations of the phases of a model loading.
+         * Phases may run concurrently.
+         */
+        class ModelLoadingPhases
+        {
+        public:
+            template < typename Phase >
+            void run( std::string name, const Phase& phase )
+            {
+                Timer timer;
+                phase();
+                std::lock_guard< std::mutex > lock{ mutex_ };
+                durations_.emplace_back( std::move( name ), timer.duration() );
+            }
+
+            void log( absl::string_view model ) const
+            {
+                for( const auto& duration : durations_ )
+                {
+                    Logger::debug( "[", model, "] ", duration.first, " in ",
+                        duration.second );
+                }
+            }
+
+        private:
+            std::mutex mutex_;
+            std::vector< std::pair< std::string, std::string > > durations_;
+        };
+
+        /*!
+         * Register in parallel the given components in the VertexIdentifier.
+         */
+        template < typename Component, typename Builder, typename Components >
+        void register_mesh_components( Builder& builder, Components components )
+        {
+            std::vector< const Component* > to_register;
+            for( const auto& component : components )
+            {
+                to_register.push_back( &component );
+            }
+            async::parallel_for(
+                to_register, [&builder]( const Component* component ) {
+                    builder.register_mesh_component( *component );
+                } );
+        }
+
+        /*!
+         * Run the phase in a new task.
+         */
+        template < typename Phase >
+        async::task< void > spawn_phase(
+            ModelLoadingPhases& phases, std::string name, Phase phase )
+        {
+            return async::spawn( [&phases, name, phase] {
+                phases.run( name, phase );
+            } );
+        }
+
+        /*!
+         * Load the components of one type in a new task, then register them
+         * in the VertexIdentifier once the unique vertices are loaded.
+         * @param[in] type Name of the component type, used in phase names.
+         * @param[in] loading Loads the component meshes.
+         * @param[in] components Returns the range of loaded components.
+         */
+        template < typename Component,
+            typename Builder,
+            typename Loading,
+            typename Components >
+        async::task< void > load_and_register_components(
+            ModelLoadingPhases& phases,
+            const std::string& type,
+            Builder& builder,
+            async::shared_task< void > unique_vertices_loading,
+            Loading loading,
+            Components components )
+        {
+            using Loadings = std::tuple< async::task< void >,
+                async::shared_task< void > >;
+            auto components_loading =
+                spawn_phase( phases, type + " loading", loading );
+            const auto registration = type + " registration";
+            return async::when_all( std::move( components_loading ),
+                std::move( unique_vertices_loading ) )
+                .then( [&phases, &builder, registration, components](
+                           Loadings loadings ) {
+                    std::get< 0 >( loadings ).get();
+                    std::get< 1 >( loadings ).get();
+                    phases.run( registration, [&builder, &components] {
+                        register_mesh_components< Component >(
+                            builder, components() );
+                    } );
+                } );
+        }
+    } // namespace detail
+} // namespace geode
@@ -51,6 +51,12 @@ namespace geode
         void save_brep_files(
             const BRep& brep, absl::string_view directory ) const;
 
+        /*!
+         * Serialize each part of the BRep directly as an archive entry
+         */
+        void save_brep_files(
+            const BRep& brep, const ZipFile& zip_writer ) const;
+
         void write( const BRep& brep ) const final;
     };
 } // namespace geode
@@ -23,9 +23,19 @@
 
 #pragma once
 
+#include <memory>
+
 #include <geode/model/representation/core/section.h>
 #include <geode/model/representation/io/section_input.h>
 
+namespace geode
+{
+    namespace detail
+    {
+        class LazyMeshArchive;
+    } // namespace detail
+} // namespace geode
+
 namespace geode
 {
     class opengeode_model_api OpenGeodeSectionInput final : public SectionInput
@@ -45,5 +55,28 @@ namespace geode
             Section& section, absl::string_view directory );
 
         Section read() final;
+
+        /*!
+         * Read the Section without loading its component meshes.
+         * Each mesh is loaded from the archive on its first access.
+         * @param[in] memory_budget Maximum size (in bytes of archived data)
+         * of loaded meshes, 0 means no limit. When exceeded, meshes are
+         * released by release_untouched_meshes, or when their last pin is
+         * released, and will be loaded again on their next access.
+         * Modified meshes are never released.
+         */
+        Section read_lazily( uint64_t memory_budget = 0 );
+
+        /*!
+         * Release the meshes of the last Section read lazily that are neither
+         * pinned nor accessed since the previous call, while its memory
+         * budget is exceeded.
+         * @warning References returned by component mesh() before the
+         * previous call should no longer be used.
+         */
+        void release_untouched_meshes();
+
+    private:
+        std::shared_ptr< detail::LazyMeshArchive > lazy_archive_;
     };
 } // namespace geode
@@ -50,6 +50,12 @@ namespace geode
         void save_section_files(
             const Section& section, absl::string_view directory ) const;
 
+        /*!
+         * Serialize each part of the Section directly as an archive entry
+         */
+        void save_section_files(
+            const Section& section, const ZipFile& zip_writer ) const;
+
         void archive_section_files( const ZipFile& zip_writer ) const;
 
         void write( const Section& section ) const final;
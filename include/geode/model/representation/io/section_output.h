@@ -44,6 +44,17 @@ namespace geode
     void opengeode_model_api save_section(
         const Section& section, absl::string_view filename );
 
+    /*!
+     * API function for saving a Section with given options.
+     * The adequate saver is called depending on the given filename extension.
+     * @param[in] section Section to save.
+     * @param[in] filename Path to the file where save the section.
+     * @param[in] options Writing options, e.g. the archive compression.
+     */
+    void opengeode_model_api save_section( const Section& section,
+        absl::string_view filename,
+        const OutputOptions& options );
+
     class SectionOutput : public Output< Section >
     {
     protected:
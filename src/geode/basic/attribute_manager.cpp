@@ -24,11 +24,18 @@
 #include <geode/basic/attribute_manager.h>
 
 #include <algorithm>
+#include <array>
+#include <istream>
+#include <limits>
+#include <ostream>
 
 #include <absl/container/flat_hash_map.h>
+#include <absl/container/flat_hash_set.h>
 
+#include <bitsery/details/serialization_common.h>
 #include <bitsery/traits/string.h>
 
+#include <geode/basic/detail/memory_stream_buffer.h>
 #include <geode/basic/logger.h>
 #include <geode/basic/pimpl_impl.h>
 
@@ -213,6 +220,9 @@ namespace geode
             const AttributeBase::AttributeKey &key )
         {
             nb_elements_ = attribute_manager.nb_elements_;
+            structural_names_.insert(
+                attribute_manager.structural_names_.begin(),
+                attribute_manager.structural_names_.end() );
             for( const auto &attribute : attribute_manager.attributes_ )
             {
                 const auto it = attributes_.find( attribute.first );
@@ -287,28 +297,188 @@ namespace geode
             it->second->set_name( new_name, key );
             attributes_.emplace( new_name, it->second );
             attributes_.erase( it );
+            const auto structural = structural_names_.find( old_name );
+            if( structural != structural_names_.end() )
+            {
+                structural_names_.erase( structural );
+                structural_names_.emplace( new_name );
+            }
+        }
+
+        void set_attribute_structural( absl::string_view name )
+        {
+            structural_names_.emplace( name );
+        }
+
+        bool is_attribute_structural( absl::string_view name ) const
+        {
+            return structural_names_.contains( name );
         }
 
         template < typename Archive >
         void serialize( Archive &archive )
         {
             archive.ext( *this,
-                Growable< Archive, Impl >{ { []( Archive &a, Impl &impl ) {
-                    a.value4b( impl.nb_elements_ );
-                    a.ext( impl.attributes_,
-                        bitsery::ext::StdMap{ impl.attributes_.max_size() },
-                        []( Archive &a2, std::string &name,
-                            std::shared_ptr< AttributeBase > &attribute ) {
-                            a2.text1b( name, name.max_size() );
-                            a2.ext( attribute, bitsery::ext::StdSmartPtr{} );
-                        } );
-                } } } );
+                Growable< Archive, Impl >{
+                    { []( Archive &a, Impl &impl ) {
+                         a.value4b( impl.nb_elements_ );
+                         a.ext( impl.attributes_,
+                             bitsery::ext::StdMap{
+                                 impl.attributes_.max_size() },
+                             []( Archive &a2, std::string &name,
+                                 std::shared_ptr< AttributeBase > &attribute ) {
+                                 a2.text1b( name, name.max_size() );
+                                 a2.ext(
+                                     attribute, bitsery::ext::StdSmartPtr{} );
+                             } );
+                     },
+                        []( Archive &a, Impl &impl ) {
+                            a.value4b( impl.nb_elements_ );
+                            serialize_columns( a, impl, false );
+                        },
+                        []( Archive &a, Impl &impl ) {
+                            a.value4b( impl.nb_elements_ );
+                            serialize_columns( a, impl, true );
+                        } },
+                    written_version( archive ) } );
         }
 
     private:
+        template < typename Archive >
+        static index_t written_version( Archive &archive )
+        {
+            return archive.template context< detail::AttributeColumnContext >()
+                               .layout
+                           == AttributeSerializationLayout::row
+                       ? 1
+                       : 3;
+        }
+
+        static void serialize_columns(
+            Serializer &archive, Impl &impl, bool with_structural_flag )
+        {
+            auto &context = archive.context< TContext >();
+            auto &column_context =
+                archive.context< detail::AttributeColumnContext >();
+            column_context.encode_values =
+                column_context.layout
+                == AttributeSerializationLayout::encoded_columnar;
+            index_t nb_attributes = impl.attributes_.size();
+            archive.value4b( nb_attributes );
+            for( const auto &attribute : impl.attributes_ )
+            {
+                detail::StringStreamBuffer column_buffer;
+                {
+                    std::ostream column{ &column_buffer };
+                    Serializer column_archive{ context, column };
+                    column_context.raw_values = true;
+                    column_archive.ext(
+                        attribute.second, bitsery::ext::StdSmartPtr{} );
+                    column_context.raw_values = false;
+                    column_archive.adapter().flush();
+                }
+                archive.text1b( attribute.first, attribute.first.max_size() );
+                if( with_structural_flag )
+                {
+                    const auto is_structural =
+                        impl.is_attribute_structural( attribute.first );
+                    archive.value1b( is_structural );
+                }
+                const auto chunk = column_buffer.release();
+                archive.text1b( chunk, chunk.max_size() );
+            }
+        }
+
+        static void serialize_columns(
+            Deserializer &archive, Impl &impl, bool with_structural_flag )
+        {
+            auto &context = archive.context< TContext >();
+            auto &column_context =
+                archive.context< detail::AttributeColumnContext >();
+            column_context.layout = AttributeSerializationLayout::columnar;
+            index_t nb_attributes;
+            archive.value4b( nb_attributes );
+            impl.attributes_.clear();
+            for( index_t a = 0; a < nb_attributes; a++ )
+            {
+                std::string name;
+                bool is_structural{ false };
+                archive.text1b( name, name.max_size() );
+                if( with_structural_flag )
+                {
+                    archive.value1b( is_structural );
+                }
+                if( is_structural )
+                {
+                    impl.set_attribute_structural( name );
+                }
+                else
+                {
+                    is_structural = impl.is_attribute_structural( name );
+                }
+                auto &adapter = archive.adapter();
+                const auto chunk_size = read_chunk_size( adapter );
+                if( !is_structural
+                    && !column_context.filter.is_loaded( name ) )
+                {
+                    skip_chunk( adapter, chunk_size );
+                    continue;
+                }
+                std::string chunk( chunk_size, '\0' );
+                if( chunk_size > 0 )
+                {
+                    adapter.readBuffer< 1 >( &chunk[0], chunk_size );
+                }
+                detail::MemoryStreamBuffer buffer{ chunk.data(), chunk.size() };
+                std::istream column{ &buffer };
+                Deserializer column_archive{ context, column };
+                std::shared_ptr< AttributeBase > attribute;
+                column_archive.ext( attribute, bitsery::ext::StdSmartPtr{} );
+                const auto &column_adapter = column_archive.adapter();
+                OPENGEODE_EXCEPTION(
+                    column_adapter.error() == bitsery::ReaderError::NoError
+                        && column_adapter.isCompletedSuccessfully(),
+                    "[AttributeManager] Error while reading attribute ",
+                    name );
+                impl.attributes_.emplace(
+                    std::move( name ), std::move( attribute ) );
+            }
+        }
+
+        /*!
+         * Read the size prefix written by text1b in front of a chunk.
+         */
+        template < typename Adapter >
+        static size_t read_chunk_size( Adapter &adapter )
+        {
+            size_t size{ 0 };
+            bitsery::details::readSize( adapter, size,
+                std::numeric_limits< size_t >::max(),
+                std::integral_constant< bool,
+                    Adapter::TConfig::CheckDataErrors >{} );
+            return size;
+        }
+
+        /*!
+         * Advance the input past a chunk without keeping its bytes.
+         */
+        template < typename Adapter >
+        static void skip_chunk( Adapter &adapter, size_t size )
+        {
+            std::array< char, 4096 > discarded;
+            while( size > 0
+                   && adapter.error() == bitsery::ReaderError::NoError )
+            {
+                const auto count = std::min( size, discarded.size() );
+                adapter.template readBuffer< 1 >( discarded.data(), count );
+                size -= count;
+            }
+        }
+
         index_t nb_elements_{ 0 };
         absl::flat_hash_map< std::string, std::shared_ptr< AttributeBase > >
             attributes_;
+        absl::flat_hash_set< std::string > structural_names_;
     };
 
     AttributeManager::AttributeManager() {} // NOLINT
@@ -441,6 +611,17 @@ namespace geode
         impl_->rename_attribute( old_name, new_name, {} );
     }
 
+    void AttributeManager::set_attribute_structural( absl::string_view name )
+    {
+        impl_->set_attribute_structural( name );
+    }
+
+    bool AttributeManager::is_attribute_structural(
+        absl::string_view name ) const
+    {
+        return impl_->is_attribute_structural( name );
+    }
+
     template < typename Archive >
     void AttributeManager::serialize( Archive &archive )
     {
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2019 - 2023 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/basic/detail/column_encoding.h>
+
+#include <cstring>
+
+namespace
+{
+    size_t word_size( size_t value_size )
+    {
+        return value_size % 8 == 0 ? 8 : 4;
+    }
+
+    template < typename Word >
+    std::string delta_shuffle_encode(
+        absl::string_view values, size_t value_size )
+    {
+        const auto nb_words = values.size() / sizeof( Word );
+        const auto stride = value_size / sizeof( Word );
+        std::vector< Word > words( nb_words );
+        std::memcpy( words.data(), values.data(), values.size() );
+        for( auto w = nb_words; w > stride; w-- )
+        {
+            words[w - 1] -= words[w - 1 - stride];
+        }
+        std::string encoded( values.size(), '\0' );
+        const auto* bytes = reinterpret_cast< const char* >( words.data() );
+        for( size_t w = 0; w < nb_words; w++ )
+        {
+            for( size_t b = 0; b < sizeof( Word ); b++ )
+            {
+                encoded[b * nb_words + w] = bytes[w * sizeof( Word ) + b];
+            }
+        }
+        return encoded;
+    }
+
+    template < typename Word >
+    void delta_shuffle_decode( absl::string_view encoded,
+        size_t value_size,
+        absl::Span< char > values )
+    {
+        const auto nb_words = encoded.size() / sizeof( Word );
+        const auto stride = value_size / sizeof( Word );
+        for( size_t w = 0; w < nb_words; w++ )
+        {
+            for( size_t b = 0; b < sizeof( Word ); b++ )
+            {
+                values[w * sizeof( Word ) + b] = encoded[b * nb_words + w];
+            }
+        }
+        std::vector< Word > words( nb_words );
+        std::memcpy( words.data(), values.data(), values.size() );
+        for( auto w = stride; w < nb_words; w++ )
+        {
+            words[w] += words[w - stride];
+        }
+        std::memcpy( values.data(), words.data(), values.size() );
+    }
+} // namespace
+
+namespace geode
+{
+    namespace detail
+    {
+        std::string encode_column( absl::string_view values,
+            size_t value_size,
+            ColumnEncoding encoding )
+        {
+            if( encoding == ColumnEncoding::raw )
+            {
+                return std::string{ values.data(), values.size() };
+            }
+            OPENGEODE_EXCEPTION( value_size % 4 == 0,
+                "[encode_column] Value size should be a multiple of 4" );
+            if( word_size( value_size ) == 8 )
+            {
+                return delta_shuffle_encode< uint64_t >( values, value_size );
+            }
+            return delta_shuffle_encode< uint32_t >( values, value_size );
+        }
+
+        void decode_column( absl::string_view encoded,
+            size_t value_size,
+            ColumnEncoding encoding,
+            absl::Span< char > values )
+        {
+            OPENGEODE_EXCEPTION( encoded.size() == values.size(),
+                "[decode_column] Wrong encoded column size" );
+            if( encoding == ColumnEncoding::raw )
+            {
+                std::memcpy( values.data(), encoded.data(), encoded.size() );
+                return;
+            }
+            OPENGEODE_EXCEPTION( encoding == ColumnEncoding::delta_shuffle
+                                     && value_size % 4 == 0,
+                "[decode_column] Unknown column encoding" );
+            if( word_size( value_size ) == 8 )
+            {
+                delta_shuffle_decode< uint64_t >( encoded, value_size, values );
+                return;
+            }
+            delta_shuffle_decode< uint32_t >( encoded, value_size, values );
+        }
+    } // namespace detail
+} // namespace geode
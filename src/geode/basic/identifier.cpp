@@ -28,6 +28,7 @@
 #include <geode/basic/bitsery_archive.h>
 #include <geode/basic/pimpl_impl.h>
 #include <geode/basic/uuid.h>
+#include <geode/basic/zip_file.h>
 
 namespace geode
 {
@@ -60,9 +61,22 @@ namespace geode
         {
             const auto filename = absl::StrCat( directory, "/identifier" );
             std::ofstream file{ filename, std::ofstream::binary };
+            save( file, filename );
+        }
+
+        void save( const ZipFile& zip_writer ) const
+        {
+            zip_writer.archive_entry(
+                "identifier", [this]( std::ostream& stream ) {
+                    save( stream, "identifier" );
+                } );
+        }
+
+        void save( std::ostream& stream, absl::string_view filename ) const
+        {
             TContext context{};
             register_basic_serialize_pcontext( std::get< 0 >( context ) );
-            Serializer archive{ context, file };
+            Serializer archive{ context, stream };
             archive.object( *this );
             archive.adapter().flush();
             OPENGEODE_EXCEPTION( std::get< 1 >( context ).isValid(),
@@ -134,6 +148,11 @@ namespace geode
         impl_->save( directory );
     }
 
+    void Identifier::save_identifier( const ZipFile& zip_writer ) const
+    {
+        impl_->save( zip_writer );
+    }
+
     void Identifier::load_identifier(
         absl::string_view directory, IdentifierKey )
     {
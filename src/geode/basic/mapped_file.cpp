@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2019 - 2023 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/basic/mapped_file.h>
+
+#if defined( _WIN32 )
+#    define NOMINMAX
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+#include <geode/basic/detail/memory_stream_buffer.h>
+#include <geode/basic/pimpl_impl.h>
+
+namespace geode
+{
+    class MappedFile::Impl
+    {
+    public:
+        Impl( absl::string_view filename )
+        {
+            const auto file = to_string( filename );
+            map( file );
+            buffer_.reset( new detail::MemoryStreamBuffer{ data_, size_ } );
+            stream_.reset( new std::istream{ buffer_.get() } );
+        }
+
+        ~Impl()
+        {
+            unmap();
+        }
+
+        const char* data() const
+        {
+            return data_;
+        }
+
+        size_t size() const
+        {
+            return size_;
+        }
+
+        std::istream& stream()
+        {
+            return *stream_;
+        }
+
+    private:
+#if defined( _WIN32 )
+        void map( const std::string& file )
+        {
+            const auto handle = CreateFileA( file.c_str(), GENERIC_READ,
+                FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                FILE_FLAG_SEQUENTIAL_SCAN, NULL );
+            OPENGEODE_EXCEPTION( handle != INVALID_HANDLE_VALUE,
+                "[MappedFile] Failed to open file: ", file );
+            LARGE_INTEGER file_size;
+            const auto valid_size = GetFileSizeEx( handle, &file_size );
+            size_ =
+                valid_size ? static_cast< size_t >( file_size.QuadPart ) : 0;
+            if( size_ == 0 )
+            {
+                CloseHandle( handle );
+                OPENGEODE_EXCEPTION(
+                    valid_size, "[MappedFile] Failed to stat file: ", file );
+                return;
+            }
+            mapping_ =
+                CreateFileMappingA( handle, NULL, PAGE_READONLY, 0, 0, NULL );
+            CloseHandle( handle );
+            OPENGEODE_EXCEPTION( mapping_ != NULL,
+                "[MappedFile] Failed to map file: ", file );
+            data_ = static_cast< const char* >(
+                MapViewOfFile( mapping_, FILE_MAP_READ, 0, 0, 0 ) );
+            if( !data_ )
+            {
+                CloseHandle( mapping_ );
+                mapping_ = NULL;
+            }
+            OPENGEODE_EXCEPTION(
+                data_, "[MappedFile] Failed to map file: ", file );
+        }
+
+        void unmap()
+        {
+            if( data_ )
+            {
+                UnmapViewOfFile( data_ );
+                CloseHandle( mapping_ );
+            }
+        }
+#else
+        void map( const std::string& file )
+        {
+            const auto descriptor = open( file.c_str(), O_RDONLY );
+            OPENGEODE_EXCEPTION( descriptor != -1,
+                "[MappedFile] Failed to open file: ", file );
+            struct stat status;
+            const auto valid_size = fstat( descriptor, &status ) == 0;
+            size_ = valid_size ? static_cast< size_t >( status.st_size ) : 0;
+            if( size_ == 0 )
+            {
+                close( descriptor );
+                OPENGEODE_EXCEPTION(
+                    valid_size, "[MappedFile] Failed to stat file: ", file );
+                return;
+            }
+            auto* address =
+                mmap( nullptr, size_, PROT_READ, MAP_PRIVATE, descriptor, 0 );
+            close( descriptor );
+            OPENGEODE_EXCEPTION( address != MAP_FAILED,
+                "[MappedFile] Failed to map file: ", file );
+            madvise( address, size_, MADV_SEQUENTIAL );
+            data_ = static_cast< const char* >( address );
+        }
+
+        void unmap()
+        {
+            if( data_ )
+            {
+                munmap( const_cast< char* >( data_ ), size_ );
+            }
+        }
+#endif
+
+    private:
+        const char* data_{ nullptr };
+        size_t size_{ 0 };
+#if defined( _WIN32 )
+        HANDLE mapping_{ NULL };
+#endif
+        std::unique_ptr< detail::MemoryStreamBuffer > buffer_;
+        std::unique_ptr< std::istream > stream_;
+    };
+
+    MappedFile::MappedFile( absl::string_view filename )
+        : impl_{ filename }
+    {
+    }
+
+    MappedFile::~MappedFile() {} // NOLINT
+
+    const char* MappedFile::data() const
+    {
+        return impl_->data();
+    }
+
+    size_t MappedFile::size() const
+    {
+        return impl_->size();
+    }
+
+    std::istream& MappedFile::stream()
+    {
+        return impl_->stream();
+    }
+} // namespace geode
@@ -23,20 +23,244 @@
 
 #include <geode/basic/zip_file.h>
 
+#include <algorithm>
+#include <condition_variable>
+#include <ctime>
 #include <fstream>
+#include <mutex>
+#include <thread>
+
+#include <absl/container/flat_hash_map.h>
 
 #include <mz.h>
 #include <mz_strm.h>
+#include <mz_strm_mem.h>
 #include <mz_zip.h>
 #include <mz_zip_rw.h>
 
 #include <ghc/filesystem.hpp>
 
+#include <geode/basic/detail/memory_stream_buffer.h>
 #include <geode/basic/logger.h>
+#include <geode/basic/output_options.h>
 #include <geode/basic/pimpl_impl.h>
 
 namespace
 {
+    constexpr size_t ENTRY_CHUNK_SIZE{ 1 << 24 };
+    /* minizip memory streams use 32 bits sizes, bigger entries are
+     * compressed while writing them in the archive */
+    constexpr size_t MAX_MEMORY_ENTRY_SIZE{ 1 << 30 };
+
+    uint16_t compress_method( geode::ZipFile::Compression compression )
+    {
+        switch( compression )
+        {
+        case geode::ZipFile::Compression::deflate:
+            return MZ_COMPRESS_METHOD_DEFLATE;
+        case geode::ZipFile::Compression::zstd:
+            return MZ_COMPRESS_METHOD_ZSTD;
+        default:
+            return MZ_COMPRESS_METHOD_STORE;
+        }
+    }
+
+    void write_entry_content( void* writer,
+        const std::string& name,
+        const std::string& content,
+        uint16_t method )
+    {
+        mz_zip_file file_info{};
+        file_info.version_madeby = MZ_VERSION_MADEBY;
+        file_info.flag = MZ_ZIP_FLAG_UTF8;
+        file_info.compression_method = method;
+        file_info.modified_date = std::time( nullptr );
+        file_info.uncompressed_size = content.size();
+        file_info.filename = name.c_str();
+        auto status = mz_zip_writer_entry_open( writer, &file_info );
+        OPENGEODE_EXCEPTION( status == MZ_OK,
+            "[ZipFile::archive_entry] Error opening entry ", name );
+        size_t offset{ 0 };
+        while( offset < content.size() )
+        {
+            const auto length = static_cast< int32_t >(
+                std::min( content.size() - offset, ENTRY_CHUNK_SIZE ) );
+            const auto written = mz_zip_writer_entry_write(
+                writer, content.data() + offset, length );
+            OPENGEODE_EXCEPTION( written == length,
+                "[ZipFile::archive_entry] Error writing entry ", name );
+            offset += length;
+        }
+        status = mz_zip_writer_entry_close( writer );
+        OPENGEODE_EXCEPTION( status == MZ_OK,
+            "[ZipFile::archive_entry] Error closing entry ", name );
+    }
+
+    /*!
+     * Single entry archive compressed in memory, ready to be copied without
+     * recompression into another archive.
+     */
+    class CompressedEntry
+    {
+    public:
+        CompressedEntry( const std::string& name,
+            const std::string& content,
+            uint16_t method,
+            int16_t level )
+        {
+            mz_stream_mem_create( &stream_ );
+            mz_zip_writer_create( &writer_ );
+            mz_zip_reader_create( &reader_ );
+            try
+            {
+                compress( name, content, method, level );
+            }
+            catch( ... )
+            {
+                release();
+                throw;
+            }
+        }
+
+        ~CompressedEntry()
+        {
+            release();
+        }
+
+        void* reader() const
+        {
+            return reader_;
+        }
+
+    private:
+        void compress( const std::string& name,
+            const std::string& content,
+            uint16_t method,
+            int16_t level )
+        {
+            mz_stream_mem_set_grow_size( stream_,
+                static_cast< int32_t >(
+                    std::max( content.size() / 2, ENTRY_CHUNK_SIZE ) ) );
+            mz_stream_open( stream_, nullptr, MZ_OPEN_MODE_CREATE );
+            mz_zip_writer_set_compress_method( writer_, method );
+            mz_zip_writer_set_compress_level( writer_, level );
+            auto status = mz_zip_writer_open( writer_, stream_, 0 );
+            OPENGEODE_EXCEPTION( status == MZ_OK,
+                "[ZipFile::archive_entry] Error opening memory archive" );
+            write_entry_content( writer_, name, content, method );
+            status = mz_zip_writer_close( writer_ );
+            OPENGEODE_EXCEPTION( status == MZ_OK,
+                "[ZipFile::archive_entry] Error compressing entry ", name );
+            mz_stream_seek( stream_, 0, MZ_SEEK_SET );
+            status = mz_zip_reader_open( reader_, stream_ );
+            if( status == MZ_OK )
+            {
+                status = mz_zip_reader_goto_first_entry( reader_ );
+            }
+            OPENGEODE_EXCEPTION( status == MZ_OK,
+                "[ZipFile::archive_entry] Error reading compressed entry ",
+                name );
+        }
+
+        void release()
+        {
+            mz_zip_reader_close( reader_ );
+            mz_zip_reader_delete( &reader_ );
+            mz_zip_writer_delete( &writer_ );
+            mz_stream_mem_delete( &stream_ );
+        }
+
+    private:
+        void* stream_{ nullptr };
+        void* writer_{ nullptr };
+        void* reader_{ nullptr };
+    };
+
+    /*!
+     * Bounds the number of entries serialized in memory at the same time,
+     * each one holding a full copy of its content until it is archived.
+     */
+    class EntrySlots
+    {
+    public:
+        class Slot
+        {
+        public:
+            explicit Slot( const EntrySlots& slots ) : slots_( slots )
+            {
+                slots_.acquire();
+            }
+
+            ~Slot()
+            {
+                slots_.release();
+            }
+
+        private:
+            const EntrySlots& slots_;
+        };
+
+        EntrySlots()
+            : available_{ std::max( 2u, std::thread::hardware_concurrency() ) }
+        {
+        }
+
+    private:
+        void acquire() const
+        {
+            std::unique_lock< std::mutex > lock{ mutex_ };
+            condition_.wait( lock, [this] {
+                return available_ > 0;
+            } );
+            available_--;
+        }
+
+        void release() const
+        {
+            {
+                std::lock_guard< std::mutex > lock{ mutex_ };
+                available_++;
+            }
+            condition_.notify_one();
+        }
+
+    private:
+        mutable std::mutex mutex_;
+        mutable std::condition_variable condition_;
+        mutable unsigned int available_;
+    };
+
+    /*!
+     * Try to open an entry compressed with the given method in a memory
+     * archive: minizip fails if the method backend has not been built.
+     */
+    bool is_method_available( uint16_t method )
+    {
+        void* stream{ nullptr };
+        void* writer{ nullptr };
+        mz_stream_mem_create( &stream );
+        mz_zip_writer_create( &writer );
+        mz_stream_open( stream, nullptr, MZ_OPEN_MODE_CREATE );
+        mz_zip_writer_set_compress_method( writer, method );
+        auto status = mz_zip_writer_open( writer, stream, 0 );
+        if( status == MZ_OK )
+        {
+            mz_zip_file file_info{};
+            file_info.version_madeby = MZ_VERSION_MADEBY;
+            file_info.compression_method = method;
+            file_info.filename = "probe";
+            status = mz_zip_writer_entry_open( writer, &file_info );
+            if( status == MZ_OK )
+            {
+                status = mz_zip_writer_entry_close( writer );
+            }
+            mz_zip_writer_close( writer );
+        }
+        mz_zip_writer_delete( &writer );
+        mz_stream_mem_delete( &stream );
+        return status == MZ_OK;
+    }
+
     ghc::filesystem::path create_directory(
         absl::string_view file, absl::string_view temp_filename )
     {
@@ -54,25 +278,38 @@ namespace geode
     class ZipFile::Impl
     {
     public:
-        Impl( absl::string_view file, absl::string_view archive_temp_filename )
+        Impl( absl::string_view file,
+            absl::string_view archive_temp_filename,
+            const OutputOptions& options )
+            : file_{ to_string( file ) },
+              temp_filename_{ to_string( archive_temp_filename ) },
+              options_( options ),
+              method_{ compress_method( options.compression ) },
+              level_{ options.compression_level }
         {
-            directory_ = create_directory( file, archive_temp_filename );
+            OPENGEODE_EXCEPTION(
+                is_compression_available( options.compression ),
+                "[ZipFile] Compression method not available in this build "
+                "of minizip" );
             mz_zip_writer_create( &writer_ );
-            mz_zip_writer_set_compress_method(
-                writer_, MZ_COMPRESS_METHOD_STORE );
-            const auto status = mz_zip_writer_open_file(
-                writer_, to_string( file ).c_str(), 0, 0 );
+            mz_zip_writer_set_compress_method( writer_, method_ );
+            mz_zip_writer_set_compress_level( writer_, level_ );
+            const auto status =
+                mz_zip_writer_open_file( writer_, file_.c_str(), 0, 0 );
             OPENGEODE_EXCEPTION(
                 status == MZ_OK, "[ZipFile] Error opening zip for writing." );
         }
 
         ~Impl()
         {
-            ghc::filesystem::remove( directory_ );
+            if( !directory_.empty() )
+            {
+                ghc::filesystem::remove( directory_ );
+            }
             const auto status = mz_zip_writer_close( writer_ );
             if( status != MZ_OK )
             {
-                Logger::error( "[ZipFile] Error closing zip for writing" );
+                Logger::error( "[ZipFile] Error closing zip for writing" );
             }
             mz_zip_writer_delete( &writer_ );
         }
@@ -88,26 +325,105 @@ namespace geode
         void archive_file( absl::string_view file ) const
         {
             const ghc::filesystem::path file_path{ to_string( file ) };
-            const auto status = mz_zip_writer_add_path(
-                writer_, file_path.string().c_str(), NULL, 0, 1 );
-            OPENGEODE_EXCEPTION( status == MZ_OK,
-                "[ZipFile::archive_file] Error adding path to zip" );
+            if( method_ == MZ_COMPRESS_METHOD_STORE )
+            {
+                std::lock_guard< std::mutex > lock{ writer_mutex_ };
+                const auto status = mz_zip_writer_add_path(
+                    writer_, file_path.string().c_str(), NULL, 0, 1 );
+                OPENGEODE_EXCEPTION( status == MZ_OK,
+                    "[ZipFile::archive_file] Error adding path to zip" );
+            }
+            else
+            {
+                std::ifstream input{ file_path.string(),
+                    std::ifstream::binary };
+                OPENGEODE_EXCEPTION( input,
+                    "[ZipFile::archive_file] Error opening file ",
+                    file_path.string() );
+                const EntrySlots::Slot slot{ slots_ };
+                input.seekg( 0, std::ios::end );
+                std::string content(
+                    static_cast< size_t >( input.tellg() ), '\0' );
+                input.seekg( 0, std::ios::beg );
+                input.read( &content[0], content.size() );
+                OPENGEODE_EXCEPTION( input,
+                    "[ZipFile::archive_file] Error reading file ",
+                    file_path.string() );
+                input.close();
+                write_entry( file_path.filename().string(), content );
+            }
             ghc::filesystem::remove( file_path );
         }
 
+        void archive_entry( absl::string_view entry_name,
+            const std::function< void( std::ostream& ) >& writer ) const
+        {
+            const EntrySlots::Slot slot{ slots_ };
+            detail::StringStreamBuffer buffer;
+            std::ostream stream{ &buffer };
+            writer( stream );
+            write_entry( to_string( entry_name ), buffer.release() );
+        }
+
         std::string directory() const
         {
+            std::call_once( directory_flag_, [this] {
+                directory_ = create_directory( file_, temp_filename_ );
+            } );
             return directory_.string();
         }
 
+        const OutputOptions& options() const
+        {
+            return options_;
+        }
+
+    private:
+        /*!
+         * Compressed entries are compressed by the calling thread, only the
+         * copy of their compressed data in the archive is serialized.
+         */
+        void write_entry(
+            const std::string& name, const std::string& content ) const
+        {
+            if( method_ == MZ_COMPRESS_METHOD_STORE
+                || content.size() > MAX_MEMORY_ENTRY_SIZE )
+            {
+                std::lock_guard< std::mutex > lock{ writer_mutex_ };
+                write_entry_content( writer_, name, content, method_ );
+                return;
+            }
+            const CompressedEntry entry{ name, content, method_, level_ };
+            std::lock_guard< std::mutex > lock{ writer_mutex_ };
+            const auto status =
+                mz_zip_writer_copy_from_reader( writer_, entry.reader() );
+            OPENGEODE_EXCEPTION( status == MZ_OK,
+                "[ZipFile::archive_entry] Error copying entry ", name );
+        }
+
     private:
-        ghc::filesystem::path directory_;
+        std::string file_;
+        std::string temp_filename_;
+        mutable ghc::filesystem::path directory_;
+        mutable std::once_flag directory_flag_;
+        const OutputOptions options_;
+        const uint16_t method_;
+        const int16_t level_;
+        mutable std::mutex writer_mutex_;
+        EntrySlots slots_;
         void* writer_{ nullptr };
     };
 
     ZipFile::ZipFile(
         absl::string_view file, absl::string_view archive_temp_filename )
-        : impl_{ file, archive_temp_filename }
+        : ZipFile( file, archive_temp_filename, OutputOptions{} )
+    {
+    }
+
+    ZipFile::ZipFile( absl::string_view file,
+        absl::string_view archive_temp_filename,
+        const OutputOptions& options )
+        : impl_{ file, archive_temp_filename, options }
     {
     }
 
@@ -124,33 +440,57 @@ namespace geode
         impl_->archive_files( files );
     }
 
+    void ZipFile::archive_entry( absl::string_view entry_name,
+        const std::function< void( std::ostream& ) >& writer ) const
+    {
+        impl_->archive_entry( entry_name, writer );
+    }
+
     std::string ZipFile::directory() const
     {
         return impl_->directory();
     }
 
+    const OutputOptions& ZipFile::options() const
+    {
+        return impl_->options();
+    }
+
+    bool ZipFile::is_compression_available( Compression compression )
+    {
+        return compression == Compression::store
+               || is_method_available( compress_method( compression ) );
+    }
+
     class UnzipFile::Impl
     {
     public:
         Impl(
             absl::string_view file, absl::string_view unarchive_temp_filename )
+            : file_{ to_string( file ) },
+              temp_filename_{ to_string( unarchive_temp_filename ) }
         {
-            directory_ = create_directory( file, unarchive_temp_filename );
             mz_zip_reader_create( &reader_ );
             const auto status =
-                mz_zip_reader_open_file( reader_, to_string( file ).c_str() );
+                mz_zip_reader_open_file( reader_, file_.c_str() );
             OPENGEODE_EXCEPTION(
                 status == MZ_OK, "[UnzipFile] Error opening zip for reading" );
+            read_central_directory();
         }
 
         ~Impl()
         {
-            ghc::filesystem::remove_all( directory_ );
+            if( !directory_.empty() )
+            {
+                ghc::filesystem::remove_all( directory_ );
+            }
             mz_zip_reader_delete( &reader_ );
         }
 
         void extract_all() const
         {
+            const ghc::filesystem::path directory{ this->directory() };
+            std::lock_guard< std::mutex > lock{ reader_mutex_ };
             auto status = mz_zip_reader_goto_first_entry( reader_ );
             while( status == MZ_OK )
             {
@@ -160,7 +500,7 @@ namespace geode
                                                       " Error getting entry "
                                                       "info in zip file" );
 
-                auto file = directory_ / file_info->filename;
+                auto file = directory / file_info->filename;
                 status = mz_zip_reader_entry_save_file(
                     reader_, file.string().c_str() );
                 OPENGEODE_EXCEPTION( status == MZ_OK,
@@ -169,13 +509,108 @@ namespace geode
             }
         }
 
+        std::vector< std::string > entries() const
+        {
+            std::vector< std::string > names;
+            names.reserve( entry_sizes_.size() );
+            for( const auto& entry : entry_sizes_ )
+            {
+                names.push_back( entry.first );
+            }
+            return names;
+        }
+
+        uint64_t entry_size( absl::string_view entry_name ) const
+        {
+            const auto entry = entry_sizes_.find( entry_name );
+            OPENGEODE_EXCEPTION( entry != entry_sizes_.end(),
+                "[UnzipFile::entry_size] Unknown entry ", entry_name );
+            return entry->second;
+        }
+
+        void read_entry( absl::string_view entry_name,
+            const std::function< void( std::istream& ) >& reader ) const
+        {
+            std::string content( entry_size( entry_name ), '\0' );
+            {
+                std::lock_guard< std::mutex > lock{ reader_mutex_ };
+                locate_entry( entry_name );
+                auto status = mz_zip_reader_entry_open( reader_ );
+                OPENGEODE_EXCEPTION( status == MZ_OK,
+                    "[UnzipFile::read_entry] Error opening entry ",
+                    entry_name );
+                size_t offset{ 0 };
+                while( offset < content.size() )
+                {
+                    const auto length = static_cast< int32_t >(
+                        std::min( content.size() - offset, ENTRY_CHUNK_SIZE ) );
+                    const auto read = mz_zip_reader_entry_read(
+                        reader_, &content[offset], length );
+                    OPENGEODE_EXCEPTION( read > 0,
+                        "[UnzipFile::read_entry] Error reading entry ",
+                        entry_name );
+                    offset += read;
+                }
+                mz_zip_reader_entry_close( reader_ );
+            }
+            detail::MemoryStreamBuffer buffer{ content.data(), content.size() };
+            std::istream stream{ &buffer };
+            reader( stream );
+        }
+
+        std::string extract_entry( absl::string_view entry_name ) const
+        {
+            const auto file =
+                ghc::filesystem::path{ directory() } / to_string( entry_name );
+            std::lock_guard< std::mutex > lock{ reader_mutex_ };
+            locate_entry( entry_name );
+            const auto status =
+                mz_zip_reader_entry_save_file( reader_, file.string().c_str() );
+            OPENGEODE_EXCEPTION( status == MZ_OK,
+                "[UnzipFile::extract_entry] Error extracting entry ",
+                entry_name );
+            return file.string();
+        }
+
         std::string directory() const
         {
+            std::call_once( directory_flag_, [this] {
+                directory_ = create_directory( file_, temp_filename_ );
+            } );
             return directory_.string();
         }
 
     private:
-        ghc::filesystem::path directory_;
+        void read_central_directory()
+        {
+            auto status = mz_zip_reader_goto_first_entry( reader_ );
+            while( status == MZ_OK )
+            {
+                mz_zip_file* file_info{ nullptr };
+                status = mz_zip_reader_entry_get_info( reader_, &file_info );
+                OPENGEODE_EXCEPTION( status == MZ_OK,
+                    "[UnzipFile] Error getting entry info in zip file" );
+                entry_sizes_.emplace( file_info->filename,
+                    static_cast< uint64_t >( file_info->uncompressed_size ) );
+                status = mz_zip_reader_goto_next_entry( reader_ );
+            }
+        }
+
+        void locate_entry( absl::string_view entry_name ) const
+        {
+            const auto status = mz_zip_reader_locate_entry(
+                reader_, to_string( entry_name ).c_str(), 0 );
+            OPENGEODE_EXCEPTION( status == MZ_OK,
+                "[UnzipFile] Cannot find entry ", entry_name );
+        }
+
+    private:
+        std::string file_;
+        std::string temp_filename_;
+        mutable ghc::filesystem::path directory_;
+        mutable std::once_flag directory_flag_;
+        mutable std::mutex reader_mutex_;
+        absl::flat_hash_map< std::string, uint64_t > entry_sizes_;
         void* reader_{ nullptr };
     };
 
@@ -192,6 +627,27 @@ namespace geode
         impl_->extract_all();
     }
 
+    std::vector< std::string > UnzipFile::entries() const
+    {
+        return impl_->entries();
+    }
+
+    uint64_t UnzipFile::entry_size( absl::string_view entry_name ) const
+    {
+        return impl_->entry_size( entry_name );
+    }
+
+    void UnzipFile::read_entry( absl::string_view entry_name,
+        const std::function< void( std::istream& ) >& reader ) const
+    {
+        impl_->read_entry( entry_name, reader );
+    }
+
+    std::string UnzipFile::extract_entry( absl::string_view entry_name ) const
+    {
+        return impl_->extract_entry( entry_name );
+    }
+
     std::string UnzipFile::directory() const
     {
         return impl_->directory();
@@ -31,6 +31,8 @@
 
 #include <async++.h>
 
+#include <geode/basic/range.h>
+
 #include <geode/geometry/point.h>
 #include <geode/geometry/points_sort.h>
 #include <geode/geometry/vector.h>
@@ -40,6 +42,13 @@
 
 namespace
 {
+    constexpr geode::index_t QUERIES_CHUNK_SIZE{ 1024 };
+
+    /*
+     * Below this number of boxes, the sub-tree is built serially.
+     */
+    constexpr geode::index_t BUILD_PARALLEL_CUTOFF{ 10000 };
+
     template < geode::index_t dimension >
     std::vector< geode::index_t > sort(
         absl::Span< const geode::BoundingBox< dimension > > bboxes )
@@ -59,16 +68,80 @@ namespace geode
     template < index_t dimension >
     AABBTree< dimension >::Impl::Impl(
         absl::Span< const BoundingBox< dimension > > bboxes )
-        : tree_( bboxes.empty()
-                     ? ROOT_INDEX
-                     : max_node_index_recursive( ROOT_INDEX, 0, bboxes.size() )
-                           + ROOT_INDEX ),
+        : nodes_( bboxes.empty()
+                      ? PAIR_SIZE
+                      : ( max_node_index_recursive(
+                              ROOT_INDEX, 0, bboxes.size() )
+                              / 2
+                          + 1 )
+                            * PAIR_SIZE ),
           mapping_morton_( sort( bboxes ) )
     {
         if( !bboxes.empty() )
         {
+            refit( bboxes );
+            build_cost_ = cost_;
+        }
+    }
+
+    template < index_t dimension >
+    void AABBTree< dimension >::Impl::refit(
+        absl::Span< const BoundingBox< dimension > > bboxes )
+    {
+        OPENGEODE_EXCEPTION( bboxes.size() == nb_bboxes(),
+            "[AABBTree::refit] Wrong number of boxes, expected ",
+            nb_bboxes(), " and got ", bboxes.size() );
+        if( bboxes.empty() )
+        {
+            return;
+        }
+        const auto internal_nodes_surface =
             initialize_tree_recursive( bboxes, ROOT_INDEX, 0, bboxes.size() );
+        bbox_ = node( ROOT_INDEX );
+        cost_ = traversal_cost( internal_nodes_surface );
+    }
+
+    template < index_t dimension >
+    double AABBTree< dimension >::Impl::refit_quality() const
+    {
+        if( cost_ == 0 )
+        {
+            return 1;
+        }
+        return build_cost_ / cost_;
+    }
+
+    template < index_t dimension >
+    double AABBTree< dimension >::Impl::traversal_cost(
+        double internal_nodes_surface ) const
+    {
+        const auto root_surface = node_surface( ROOT_INDEX );
+        if( root_surface == 0 )
+        {
+            return 0;
+        }
+        return internal_nodes_surface / root_surface;
+    }
+
+    template < index_t dimension >
+    double AABBTree< dimension >::Impl::node_surface(
+        index_t node_index ) const
+    {
+        std::array< double, dimension > extent;
+        for( const auto c : LRange{ dimension } )
+        {
+            extent[c] = node_max( node_index, c ) - node_min( node_index, c );
+        }
+        if( dimension == 2 )
+        {
+            return extent[0] + extent[1];
+        }
+        double surface{ 0 };
+        for( const auto c : LRange{ dimension } )
+        {
+            surface += extent[c] * extent[c == dimension - 1 ? 0 : c + 1];
         }
+        return surface;
     }
 
     template < index_t dimension >
@@ -96,36 +169,57 @@ namespace geode
     }
 
     template < index_t dimension >
-    bool AABBTree< dimension >::Impl::is_leaf(
-        index_t box_begin, index_t box_end )
+    const BoundingBox< dimension >&
+        AABBTree< dimension >::Impl::bounding_box() const
     {
-        return box_begin + 1 == box_end;
+        return bbox_;
     }
 
     template < index_t dimension >
-    typename AABBTree< dimension >::Impl::Iterator
-        AABBTree< dimension >::Impl::get_recursive_iterators(
-            index_t node_index, index_t box_begin, index_t box_end )
+    BoundingBox< dimension > AABBTree< dimension >::Impl::node(
+        index_t index ) const
     {
-        Iterator it;
-        it.middle_box = box_begin + ( box_end - box_begin ) / 2;
-        it.child_left = 2 * node_index;
-        it.child_right = 2 * node_index + 1;
-        return it;
+        OPENGEODE_ASSERT(
+            node_offset( index ) < nodes_.size(), "query out of tree" );
+        Point< dimension > min;
+        Point< dimension > max;
+        for( const auto c : LRange{ dimension } )
+        {
+            min.set_value( c, node_min( index, c ) );
+            max.set_value( c, node_max( index, c ) );
+        }
+        BoundingBox< dimension > box;
+        box.add_point( min );
+        box.add_point( max );
+        return box;
     }
 
     template < index_t dimension >
-    const BoundingBox< dimension >& AABBTree< dimension >::Impl::node(
-        index_t index ) const
+    void AABBTree< dimension >::Impl::set_node(
+        index_t node_index, const BoundingBox< dimension >& box )
     {
-        OPENGEODE_ASSERT( index < tree_.size(), "query out of tree" );
-        return tree_[index];
+        const auto offset = node_offset( node_index );
+        for( const auto c : LRange{ dimension } )
+        {
+            nodes_[offset + 2 * c] = box.min().value( c );
+            nodes_[offset + 2 * ( dimension + c )] = box.max().value( c );
+        }
     }
 
     template < index_t dimension >
-    index_t AABBTree< dimension >::Impl::mapping_morton( index_t index ) const
+    void AABBTree< dimension >::Impl::set_node_from_children(
+        index_t node_index )
     {
-        return mapping_morton_[index];
+        const auto offset = node_offset( node_index );
+        const auto* children = &nodes_[node_index * PAIR_SIZE];
+        for( const auto c : LRange{ dimension } )
+        {
+            const auto* mins = children + 2 * c;
+            const auto* maxs = children + 2 * ( dimension + c );
+            nodes_[offset + 2 * c] = std::min( mins[0], mins[1] );
+            nodes_[offset + 2 * ( dimension + c )] =
+                std::max( maxs[0], maxs[1] );
+        }
     }
 
     template < index_t dimension >
@@ -158,6 +252,19 @@ namespace geode
         return *this;
     }
 
+    template < index_t dimension >
+    void AABBTree< dimension >::refit(
+        absl::Span< const BoundingBox< dimension > > bboxes )
+    {
+        impl_->refit( bboxes );
+    }
+
+    template < index_t dimension >
+    double AABBTree< dimension >::refit_quality() const
+    {
+        return impl_->refit_quality();
+    }
+
     template < index_t dimension >
     index_t AABBTree< dimension >::nb_bboxes() const
     {
@@ -170,7 +277,7 @@ namespace geode
         OPENGEODE_EXCEPTION( impl_->nb_bboxes() != 0,
             "[AABBTree::bounding_box] Cannot return "
             "the bounding_box of an empty AABBTree." );
-        return impl_->node( Impl::ROOT_INDEX );
+        return impl_->bounding_box();
     }
 
     template < index_t dimension >
@@ -182,37 +289,107 @@ namespace geode
             return {};
         }
         std::vector< index_t > result;
-        impl_->containing_boxes_recursive(
-            Impl::ROOT_INDEX, 0, nb_bboxes(), query, result );
+        impl_->containing_boxes( query, result );
         return result;
     }
 
     template < index_t dimension >
-    void AABBTree< dimension >::Impl::containing_boxes_recursive(
-        index_t node_index,
-        index_t element_begin,
-        index_t element_end,
-        const Point< dimension >& query,
-        std::vector< index_t >& result ) const
+    typename AABBTree< dimension >::ContainingBoxes
+        AABBTree< dimension >::containing_boxes(
+            absl::Span< const Point< dimension > > queries ) const
     {
-        OPENGEODE_ASSERT( node_index < tree_.size(), "Node index out of tree" );
-        OPENGEODE_ASSERT( element_begin != element_end,
-            "Begin and End indices should be different" );
-        if( !node( node_index ).contains( query ) )
+        ContainingBoxes result;
+        result.offsets.resize( queries.size() + 1, 0 );
+        if( nb_bboxes() == 0 || queries.empty() )
         {
-            return;
+            return result;
         }
-        if( is_leaf( element_begin, element_end ) )
+        const auto order = morton_mapping< dimension >( queries );
+        const index_t nb_chunks =
+            ( queries.size() + QUERIES_CHUNK_SIZE - 1 ) / QUERIES_CHUNK_SIZE;
+        std::vector< std::vector< index_t > > chunk_boxes( nb_chunks );
+        async::parallel_for( async::irange( index_t{ 0 }, nb_chunks ),
+            [&result, &queries, &order, &chunk_boxes, this]( index_t chunk ) {
+                const auto begin = chunk * QUERIES_CHUNK_SIZE;
+                const auto end = std::min< index_t >(
+                    begin + QUERIES_CHUNK_SIZE, order.size() );
+                auto& boxes = chunk_boxes[chunk];
+                for( const auto i : Range{ begin, end } )
+                {
+                    const auto query = order[i];
+                    const auto nb_previous_boxes = boxes.size();
+                    impl_->containing_boxes( queries[query], boxes );
+                    result.offsets[query + 1] =
+                        boxes.size() - nb_previous_boxes;
+                }
+            } );
+        std::partial_sum( result.offsets.begin(), result.offsets.end(),
+            result.offsets.begin() );
+        result.boxes.resize( result.offsets.back() );
+        async::parallel_for( async::irange( index_t{ 0 }, nb_chunks ),
+            [&result, &order, &chunk_boxes]( index_t chunk ) {
+                const auto begin = chunk * QUERIES_CHUNK_SIZE;
+                const auto end = std::min< index_t >(
+                    begin + QUERIES_CHUNK_SIZE, order.size() );
+                auto chunk_it = chunk_boxes[chunk].begin();
+                for( const auto i : Range{ begin, end } )
+                {
+                    const auto query = order[i];
+                    const auto nb_boxes =
+                        result.offsets[query + 1] - result.offsets[query];
+                    std::copy( chunk_it, chunk_it + nb_boxes,
+                        result.boxes.begin() + result.offsets[query] );
+                    chunk_it += nb_boxes;
+                }
+            } );
+        return result;
+    }
+
+    template < index_t dimension >
+    void AABBTree< dimension >::Impl::parallel_morton_queries(
+        absl::Span< const Point< dimension > > queries,
+        const std::function< void( index_t ) >& action )
+    {
+        const auto order = morton_mapping< dimension >( queries );
+        async::parallel_for( async::irange( size_t{ 0 }, order.size() ),
+            [&order, &action]( size_t i ) {
+                action( order[i] );
+            } );
+    }
+
+    template < index_t dimension >
+    void AABBTree< dimension >::Impl::containing_boxes(
+        const Point< dimension >& query, std::vector< index_t >& result ) const
+    {
+        if( !children_contain( ROOT_PARENT_INDEX, query )[1] )
         {
-            result.push_back( mapping_morton( element_begin ) );
             return;
         }
-        const auto it =
-            get_recursive_iterators( node_index, element_begin, element_end );
-        containing_boxes_recursive(
-            it.child_left, element_begin, it.middle_box, query, result );
-        containing_boxes_recursive(
-            it.child_right, it.middle_box, element_end, query, result );
+        Stack stack;
+        stack.push_back( { ROOT_INDEX, 0, nb_bboxes(), 0 } );
+        while( !stack.empty() )
+        {
+            const auto current = stack.back();
+            stack.pop_back();
+            if( is_leaf( current.element_begin, current.element_end ) )
+            {
+                result.push_back( mapping_morton( current.element_begin ) );
+                continue;
+            }
+            const auto it = get_recursive_iterators( current.node_index,
+                current.element_begin, current.element_end );
+            const auto contain = children_contain( current.node_index, query );
+            if( contain[1] )
+            {
+                stack.push_back(
+                    { it.child_right, it.middle_box, current.element_end, 0 } );
+            }
+            if( contain[0] )
+            {
+                stack.push_back( { it.child_left, current.element_begin,
+                    it.middle_box, 0 } );
+            }
+        }
     }
 
     /**
@@ -223,35 +400,52 @@ namespace geode
      * \param[in] element_end one position past the last box index in the vector
      * \p
      * bboxes
+     * \return the sum of the subtree internal node surfaces
      */
     template < index_t dimension >
-    void AABBTree< dimension >::Impl::initialize_tree_recursive(
+    double AABBTree< dimension >::Impl::initialize_tree_recursive(
         absl::Span< const BoundingBox< dimension > > bboxes,
         index_t node_index,
         index_t element_begin,
         index_t element_end )
     {
-        OPENGEODE_ASSERT( node_index < tree_.size(), "Node index out of tree" );
+        OPENGEODE_ASSERT( node_offset( node_index ) < nodes_.size(),
+            "Node index out of tree" );
         OPENGEODE_ASSERT( element_begin != element_end,
             "Begin and End indices should be different" );
         if( is_leaf( element_begin, element_end ) )
         {
-            tree_[node_index] = bboxes[mapping_morton_[element_begin]];
-            return;
+            set_node( node_index, bboxes[mapping_morton_[element_begin]] );
+            return 0;
         }
         const auto it =
             get_recursive_iterators( node_index, element_begin, element_end );
-        OPENGEODE_ASSERT(
-            it.child_left < tree_.size(), "Left index out of tree" );
-        OPENGEODE_ASSERT(
-            it.child_right < tree_.size(), "Right index out of tree" );
-        initialize_tree_recursive(
-            bboxes, it.child_left, element_begin, it.middle_box );
-        initialize_tree_recursive(
-            bboxes, it.child_right, it.middle_box, element_end );
-        // before box_union
-        tree_[node_index].add_box( node( it.child_left ) );
-        tree_[node_index].add_box( node( it.child_right ) );
+        OPENGEODE_ASSERT( node_offset( it.child_right ) < nodes_.size(),
+            "Right index out of tree" );
+        double left_surface{ 0 };
+        double right_surface{ 0 };
+        if( element_end - element_begin < BUILD_PARALLEL_CUTOFF )
+        {
+            left_surface = initialize_tree_recursive(
+                bboxes, it.child_left, element_begin, it.middle_box );
+            right_surface = initialize_tree_recursive(
+                bboxes, it.child_right, it.middle_box, element_end );
+        }
+        else
+        {
+            // Both children fill disjoint parts of the tree
+            async::parallel_invoke(
+                [&bboxes, &it, &left_surface, element_begin, this] {
+                    left_surface = initialize_tree_recursive(
+                        bboxes, it.child_left, element_begin, it.middle_box );
+                },
+                [&bboxes, &it, &right_surface, element_end, this] {
+                    right_surface = initialize_tree_recursive(
+                        bboxes, it.child_right, it.middle_box, element_end );
+                } );
+        }
+        set_node_from_children( node_index );
+        return node_surface( node_index ) + left_surface + right_surface;
     }
 
     template < index_t dimension >
@@ -265,8 +459,9 @@ namespace geode
         {
             const auto it =
                 get_recursive_iterators( node_index, box_begin, box_end );
-            if( node( it.child_left ).signed_distance( query )
-                < node( it.child_right ).signed_distance( query ) )
+            const auto distances =
+                children_signed_distances( node_index, query );
+            if( distances[0] < distances[1] )
             {
                 box_end = it.middle_box;
                 node_index = it.child_left;
@@ -0,0 +1,283 @@
+/*
+ * Copyright (c) 2019 - 2023 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/geometry/colocation.h>
+
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+#include <absl/algorithm/container.h>
+#include <absl/container/fixed_array.h>
+#include <absl/container/flat_hash_map.h>
+
+#include <async++.h>
+
+#include <geode/basic/logger.h>
+#include <geode/basic/private/parallel_sort.h>
+
+#include <geode/geometry/point.h>
+#include <geode/geometry/private/colocated_clusters.h>
+
+namespace
+{
+    constexpr geode::index_t BUCKETS_CHUNK_SIZE{ 16384 };
+
+    template < geode::index_t dimension >
+    using Cell = std::array< std::int64_t, dimension >;
+
+    /*!
+     * Range of each non-empty cell in the points sorted by cell.
+     */
+    template < geode::index_t dimension >
+    using Buckets = absl::flat_hash_map< Cell< dimension >,
+        std::pair< geode::index_t, geode::index_t > >;
+
+    /*!
+     * Offsets of a cell and all its neighboring cells (3^dimension cells).
+     */
+    template < geode::index_t dimension >
+    std::vector< Cell< dimension > > neighbor_cell_offsets()
+    {
+        std::vector< Cell< dimension > > offsets( 1 );
+        offsets.front().fill( -1 );
+        for( const auto d : geode::LRange{ dimension } )
+        {
+            const auto nb_offsets = offsets.size();
+            for( const auto shift : geode::LRange{ 1, 3 } )
+            {
+                for( const auto o : geode::Range{ nb_offsets } )
+                {
+                    auto offset = offsets[o];
+                    offset[d] += shift;
+                    offsets.push_back( offset );
+                }
+            }
+        }
+        return offsets;
+    }
+
+    template < geode::index_t dimension >
+    double squared_distance( const geode::Point< dimension >& point0,
+        const geode::Point< dimension >& point1 )
+    {
+        double result{ 0 };
+        for( const auto d : geode::LRange{ dimension } )
+        {
+            const auto diff = point0.value( d ) - point1.value( d );
+            result += diff * diff;
+        }
+        return result;
+    }
+
+    /*!
+     * Checks that the cell coordinates of all the points, and of their
+     * neighboring cells, can be stored as 64-bit integers.
+     */
+    template < geode::index_t dimension >
+    bool fits_in_grid( absl::Span< const geode::Point< dimension > > points,
+        double epsilon )
+    {
+        // Keep a margin for the neighboring cell offsets
+        const auto max_cell =
+            static_cast< double >( std::numeric_limits< std::int64_t >::max()
+                                   / 2 );
+        return absl::c_all_of( points,
+            [epsilon, max_cell]( const geode::Point< dimension >& point ) {
+                for( const auto d : geode::LRange{ dimension } )
+                {
+                    const auto cell = std::fabs( point.value( d ) / epsilon );
+                    if( !( cell < max_cell ) )
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            } );
+    }
+
+    /*!
+     * Each chunk of sorted points stores the buckets starting in it, then
+     * the chunk buckets are merged.
+     */
+    template < geode::index_t dimension >
+    Buckets< dimension > compute_buckets(
+        const absl::FixedArray< Cell< dimension > >& cells,
+        absl::Span< const geode::index_t > order )
+    {
+        const auto nb_points = static_cast< geode::index_t >( order.size() );
+        const auto nb_chunks =
+            ( nb_points + BUCKETS_CHUNK_SIZE - 1 ) / BUCKETS_CHUNK_SIZE;
+        std::vector< Buckets< dimension > > chunk_buckets( nb_chunks );
+        async::parallel_for( async::irange( geode::index_t{ 0 }, nb_chunks ),
+            [&cells, &order, &chunk_buckets, nb_points](
+                geode::index_t chunk ) {
+                const auto chunk_begin = chunk * BUCKETS_CHUNK_SIZE;
+                const auto chunk_end = std::min< geode::index_t >(
+                    chunk_begin + BUCKETS_CHUNK_SIZE, nb_points );
+                auto& buckets = chunk_buckets[chunk];
+                for( auto begin = chunk_begin; begin < chunk_end; )
+                {
+                    const auto& cell = cells[order[begin]];
+                    auto end = begin + 1;
+                    while( end < nb_points && cells[order[end]] == cell )
+                    {
+                        end++;
+                    }
+                    // A bucket started in the previous chunk is stored there
+                    if( begin == 0 || cells[order[begin - 1]] != cell )
+                    {
+                        buckets.emplace( cell, std::make_pair( begin, end ) );
+                    }
+                    begin = end;
+                }
+            } );
+        if( chunk_buckets.empty() )
+        {
+            return {};
+        }
+        auto buckets = std::move( chunk_buckets.front() );
+        size_t nb_buckets{ 0 };
+        for( const auto& chunk : chunk_buckets )
+        {
+            nb_buckets += chunk.size();
+        }
+        buckets.reserve( nb_buckets );
+        for( const auto chunk : geode::Range{ 1, nb_chunks } )
+        {
+            buckets.insert(
+                chunk_buckets[chunk].begin(), chunk_buckets[chunk].end() );
+        }
+        return buckets;
+    }
+
+    template < geode::index_t dimension >
+    typename geode::NNSearch< dimension >::ColocatedInfo
+        grid_colocated_index_mapping(
+            absl::Span< const geode::Point< dimension > > points,
+            double epsilon )
+    {
+        OPENGEODE_EXCEPTION( epsilon >= geode::global_epsilon,
+            "[colocated_index_mapping] Given epsilon too small, should be "
+            "bigger than global_epsilon (i.e. ",
+            geode::global_epsilon, ")" );
+        const geode::index_t nb_points = points.size();
+        absl::FixedArray< Cell< dimension > > cells( nb_points );
+        async::parallel_for( async::irange( geode::index_t{ 0 }, nb_points ),
+            [&points, &cells, epsilon]( geode::index_t p ) {
+                for( const auto d : geode::LRange{ dimension } )
+                {
+                    cells[p][d] = static_cast< std::int64_t >(
+                        std::floor( points[p].value( d ) / epsilon ) );
+                }
+            } );
+
+        // Points sorted by cell, each cell stores its range in this order
+        std::vector< geode::index_t > order( nb_points );
+        absl::c_iota( order, 0 );
+        geode::detail::parallel_stable_sort(
+            order, [&cells]( geode::index_t p0, geode::index_t p1 ) {
+                return cells[p0] < cells[p1];
+            } );
+        const auto buckets = compute_buckets< dimension >( cells, order );
+
+        // Two points closer than epsilon are in the same or in neighboring
+        // cells
+        const auto offsets = neighbor_cell_offsets< dimension >();
+        const auto squared_epsilon = epsilon * epsilon;
+        geode::detail::ColocatedClusters clusters{ nb_points };
+        async::parallel_for( async::irange( geode::index_t{ 0 }, nb_points ),
+            [&points, &cells, &order, &buckets, &offsets, &clusters,
+                squared_epsilon]( geode::index_t p ) {
+                const auto& point = points[p];
+                for( const auto& offset : offsets )
+                {
+                    auto cell = cells[p];
+                    for( const auto d : geode::LRange{ dimension } )
+                    {
+                        cell[d] += offset[d];
+                    }
+                    const auto bucket = buckets.find( cell );
+                    if( bucket == buckets.end() )
+                    {
+                        continue;
+                    }
+                    for( const auto i : geode::Range{
+                             bucket->second.first, bucket->second.second } )
+                    {
+                        // The neighborhood is symmetric, link each pair once
+                        const auto q = order[i];
+                        if( q > p
+                            && squared_distance( point, points[q] )
+                                   < squared_epsilon )
+                        {
+                            clusters.link( p, q );
+                        }
+                    }
+                }
+            } );
+
+        std::vector< geode::index_t > mapping;
+        std::vector< geode::index_t > representatives;
+        std::tie( mapping, representatives ) = clusters.compute_mapping();
+        std::vector< geode::Point< dimension > > unique_points(
+            representatives.size() );
+        async::parallel_for(
+            async::irange( size_t{ 0 }, unique_points.size() ),
+            [&unique_points, &representatives, &points]( size_t u ) {
+                unique_points[u] = points[representatives[u]];
+            } );
+        return { std::move( mapping ), std::move( unique_points ) };
+    }
+} // namespace
+
+namespace geode
+{
+    template < index_t dimension >
+    typename NNSearch< dimension >::ColocatedInfo colocated_index_mapping(
+        std::vector< Point< dimension > > points,
+        double epsilon,
+        ColocationMethod method )
+    {
+        if( method == ColocationMethod::grid_hashing )
+        {
+            if( fits_in_grid< dimension >( points, epsilon ) )
+            {
+                return grid_colocated_index_mapping< dimension >(
+                    points, epsilon );
+            }
+            Logger::debug( "[colocated_index_mapping] Point coordinates too "
+                           "large compared to epsilon for grid hashing, "
+                           "using nn_search" );
+        }
+        const NNSearch< dimension > nnsearch{ std::move( points ) };
+        return nnsearch.colocated_index_mapping( epsilon );
+    }
+
+    template NNSearch< 2 >::ColocatedInfo opengeode_geometry_api
+        colocated_index_mapping(
+            std::vector< Point< 2 > >, double, ColocationMethod );
+    template NNSearch< 3 >::ColocatedInfo opengeode_geometry_api
+        colocated_index_mapping(
+            std::vector< Point< 3 > >, double, ColocationMethod );
+} // namespace geode
@@ -25,8 +25,6 @@
 
 #include <numeric>
 
-#include <absl/algorithm/container.h>
-
 #include <async++.h>
 
 #include <nanoflann.hpp>
@@ -34,6 +32,36 @@
 #include <geode/basic/logger.h>
 #include <geode/basic/pimpl_impl.h>
 
+#include <geode/geometry/points_sort.h>
+#include <geode/geometry/private/colocated_clusters.h>
+
+namespace
+{
+    constexpr geode::index_t QUERIES_CHUNK_SIZE{ 1024 };
+
+    geode::index_t nb_chunks( geode::index_t nb_queries )
+    {
+        return ( nb_queries + QUERIES_CHUNK_SIZE - 1 ) / QUERIES_CHUNK_SIZE;
+    }
+
+    /*
+     * Calls action( chunk, begin, end ) in parallel on each chunk of
+     * consecutive queries in the given order.
+     */
+    template < typename Action >
+    void parallel_chunks( geode::index_t nb_queries, const Action& action )
+    {
+        async::parallel_for(
+            async::irange( geode::index_t{ 0 }, nb_chunks( nb_queries ) ),
+            [nb_queries, &action]( geode::index_t chunk ) {
+                const auto begin = chunk * QUERIES_CHUNK_SIZE;
+                const auto end = std::min< geode::index_t >(
+                    begin + QUERIES_CHUNK_SIZE, nb_queries );
+                action( chunk, begin, end );
+            } );
+    }
+} // namespace
+
 namespace geode
 {
     template < index_t dimension >
@@ -60,16 +88,28 @@ namespace geode
             const Point< dimension >& point,
             const double threshold_distance ) const
         {
-            std::vector< std::pair< index_t, double > > results;
-            const auto nb_results = nn_tree_.radiusSearch( &copy( point )[0],
-                threshold_distance * threshold_distance, results, {} );
+            std::vector< std::pair< index_t, double > > scratch;
             std::vector< index_t > indices;
-            indices.reserve( nb_results );
-            for( auto&& result : results )
+            radius_neighbors( point, threshold_distance * threshold_distance,
+                scratch, indices );
+            return indices;
+        }
+
+        /*!
+         * Appends the neighbors inside the sphere to the indices vector.
+         * The scratch vector is only given to reuse its memory between calls.
+         */
+        void radius_neighbors( const Point< dimension >& point,
+            const double squared_threshold_distance,
+            std::vector< std::pair< index_t, double > >& scratch,
+            std::vector< index_t >& indices ) const
+        {
+            nn_tree_.radiusSearch( &copy( point )[0],
+                squared_threshold_distance, scratch, {} );
+            for( const auto& result : scratch )
             {
                 indices.emplace_back( result.first );
             }
-            return indices;
         }
 
         std::vector< index_t > neighbors(
@@ -77,12 +117,21 @@ namespace geode
         {
             std::vector< index_t > results( nb_neighbors );
             std::vector< double > distances( nb_neighbors );
-            const auto new_nb_neighbors = nn_tree_.knnSearch(
-                &copy( point )[0], nb_neighbors, &results[0], &distances[0] );
+            const auto new_nb_neighbors = neighbors(
+                point, nb_neighbors, results.data(), distances.data() );
             results.resize( new_nb_neighbors );
             return results;
         }
 
+        index_t neighbors( const Point< dimension >& point,
+            const index_t nb_neighbors,
+            index_t* indices,
+            double* squared_distances ) const
+        {
+            return nn_tree_.knnSearch( &copy( point )[0], nb_neighbors,
+                indices, squared_distances );
+        }
+
     private:
         std::array< double, dimension > copy(
             const Point< dimension >& point ) const
@@ -182,6 +231,115 @@ namespace geode
         return impl_->neighbors( point, nb_neighbors );
     }
 
+    template < index_t dimension >
+    std::vector< index_t > NNSearch< dimension >::closest_neighbors(
+        absl::Span< const Point< dimension > > points ) const
+    {
+        OPENGEODE_EXCEPTION( nb_points() > 0 || points.empty(),
+            "[NNSearch::closest_neighbors] No point in the tree" );
+        std::vector< index_t > result( points.size() );
+        const auto order = morton_mapping< dimension >( points );
+        parallel_chunks( points.size(),
+            [&result, &points, &order, this](
+                index_t /*chunk*/, index_t begin, index_t end ) {
+                double distance;
+                for( const auto i : Range{ begin, end } )
+                {
+                    const auto query = order[i];
+                    impl_->neighbors(
+                        points[query], 1, &result[query], &distance );
+                }
+            } );
+        return result;
+    }
+
+    template < index_t dimension >
+    typename NNSearch< dimension >::BatchNeighbors
+        NNSearch< dimension >::radius_neighbors(
+            absl::Span< const Point< dimension > > points,
+            double threshold_distance ) const
+    {
+        BatchNeighbors result;
+        result.offsets.resize( points.size() + 1, 0 );
+        if( points.empty() )
+        {
+            return result;
+        }
+        const auto squared_threshold_distance =
+            threshold_distance * threshold_distance;
+        const auto order = morton_mapping< dimension >( points );
+        std::vector< std::vector< index_t > > chunk_neighbors(
+            nb_chunks( points.size() ) );
+        parallel_chunks( points.size(),
+            [&result, &points, &order, &chunk_neighbors,
+                squared_threshold_distance, this](
+                index_t chunk, index_t begin, index_t end ) {
+                std::vector< std::pair< index_t, double > > scratch;
+                auto& neighbors = chunk_neighbors[chunk];
+                for( const auto i : Range{ begin, end } )
+                {
+                    const auto query = order[i];
+                    const auto nb_previous_neighbors = neighbors.size();
+                    impl_->radius_neighbors( points[query],
+                        squared_threshold_distance, scratch, neighbors );
+                    result.offsets[query + 1] =
+                        neighbors.size() - nb_previous_neighbors;
+                }
+            } );
+        std::partial_sum( result.offsets.begin(), result.offsets.end(),
+            result.offsets.begin() );
+        result.neighbors.resize( result.offsets.back() );
+        parallel_chunks( points.size(),
+            [&result, &order, &chunk_neighbors](
+                index_t chunk, index_t begin, index_t end ) {
+                auto chunk_it = chunk_neighbors[chunk].begin();
+                for( const auto i : Range{ begin, end } )
+                {
+                    const auto query = order[i];
+                    const auto nb_neighbors =
+                        result.offsets[query + 1] - result.offsets[query];
+                    std::copy( chunk_it, chunk_it + nb_neighbors,
+                        result.neighbors.begin() + result.offsets[query] );
+                    chunk_it += nb_neighbors;
+                }
+            } );
+        return result;
+    }
+
+    template < index_t dimension >
+    typename NNSearch< dimension >::BatchNeighbors
+        NNSearch< dimension >::neighbors(
+            absl::Span< const Point< dimension > > points,
+            index_t nb_neighbors ) const
+    {
+        const auto nb_results = std::min( nb_neighbors, nb_points() );
+        BatchNeighbors result;
+        result.offsets.resize( points.size() + 1 );
+        for( const auto q : Indices{ result.offsets } )
+        {
+            result.offsets[q] = q * nb_results;
+        }
+        result.neighbors.resize( result.offsets.back() );
+        if( nb_results == 0 )
+        {
+            return result;
+        }
+        const auto order = morton_mapping< dimension >( points );
+        parallel_chunks( points.size(),
+            [&result, &points, &order, nb_results, this](
+                index_t /*chunk*/, index_t begin, index_t end ) {
+                std::vector< double > distances( nb_results );
+                for( const auto i : Range{ begin, end } )
+                {
+                    const auto query = order[i];
+                    impl_->neighbors( points[query], nb_results,
+                        &result.neighbors[result.offsets[query]],
+                        distances.data() );
+                }
+            } );
+        return result;
+    }
+
     template < index_t dimension >
     typename NNSearch< dimension >::ColocatedInfo
         NNSearch< dimension >::colocated_index_mapping( double epsilon ) const
@@ -190,45 +348,38 @@ namespace geode
             "[NNSearch::colocated_index_mapping] Given epsilon too small, "
             "should be bigger than global_epsilon (i.e. ",
             global_epsilon, ")" );
-        std::vector< index_t > mapping( nb_points() );
-        absl::c_iota( mapping, 0 );
-        async::parallel_for( async::irange( index_t{ 0 }, nb_points() ),
-            [&epsilon, &mapping, this]( index_t p ) {
-                if( mapping[p] == p )
+        detail::ColocatedClusters clusters{ nb_points() };
+        parallel_chunks( nb_points(),
+            [&clusters, epsilon, this](
+                index_t /*chunk*/, index_t begin, index_t end ) {
+                const auto squared_epsilon = epsilon * epsilon;
+                std::vector< std::pair< index_t, double > > scratch;
+                std::vector< index_t > vertices;
+                for( const auto p : Range{ begin, end } )
                 {
-                    const auto vertices =
-                        radius_neighbors( point( p ), epsilon );
-                    const auto min_index = *absl::c_min_element( vertices );
+                    vertices.clear();
+                    impl_->radius_neighbors(
+                        point( p ), squared_epsilon, scratch, vertices );
                     for( const auto id : vertices )
                     {
-                        mapping[id] = min_index;
+                        // The neighborhood is symmetric, link each pair once
+                        if( id > p )
+                        {
+                            clusters.link( p, id );
+                        }
                     }
                 }
             } );
-        index_t nb_unique_points{ 0 };
-        for( const auto p : Range{ nb_points() } )
-        {
-            if( mapping[p] == p )
-            {
-                nb_unique_points++;
-            }
-        }
-        index_t nb_colocated{ 0 };
-        index_t count{ 0 };
-        std::vector< Point< dimension > > unique_points( nb_unique_points );
-        for( const auto p : Range{ nb_points() } )
-        {
-            if( mapping[p] == p )
-            {
-                mapping[p] -= nb_colocated;
-                unique_points[count++] = point( p );
-            }
-            else
-            {
-                nb_colocated++;
-                mapping[p] = mapping[mapping[p]];
-            }
-        }
+        std::vector< index_t > mapping;
+        std::vector< index_t > representatives;
+        std::tie( mapping, representatives ) = clusters.compute_mapping();
+        std::vector< Point< dimension > > unique_points(
+            representatives.size() );
+        async::parallel_for(
+            async::irange( size_t{ 0 }, unique_points.size() ),
+            [&unique_points, &representatives, this]( size_t u ) {
+                unique_points[u] = point( representatives[u] );
+            } );
         return { std::move( mapping ), std::move( unique_points ) };
     }
 
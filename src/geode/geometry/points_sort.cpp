@@ -35,6 +35,12 @@ namespace
 {
     using itr = std::vector< geode::index_t >::iterator;
 
+    /*
+     * Below this number of elements, the Morton recursion is run serially:
+     * spawning tasks would cost more than the sort itself.
+     */
+    constexpr std::ptrdiff_t MORTON_PARALLEL_CUTOFF{ 10000 };
+
     template < geode::index_t dimension >
     class Morton_cmp
     {
@@ -108,21 +114,73 @@ namespace
 
         const auto m0 = begin;
         const auto m8 = end;
+        if( end - begin < MORTON_PARALLEL_CUTOFF )
+        {
+            const auto m4 = split( m0, m8, compX );
+            const auto m2 = split( m0, m4, compY );
+            const auto m1 = split( m0, m2, compZ );
+            const auto m3 = split( m2, m4, compZ );
+            const auto m6 = split( m4, m8, compY );
+            const auto m5 = split( m4, m6, compZ );
+            const auto m7 = split( m6, m8, compZ );
+            morton_mapping< COORDZ >( points, m0, m1 );
+            morton_mapping< COORDY >( points, m1, m2 );
+            morton_mapping< COORDY >( points, m2, m3 );
+            morton_mapping< COORDX >( points, m3, m4 );
+            morton_mapping< COORDX >( points, m4, m5 );
+            morton_mapping< COORDY >( points, m5, m6 );
+            morton_mapping< COORDY >( points, m6, m7 );
+            morton_mapping< COORDZ >( points, m7, m8 );
+            return;
+        }
         const auto m4 = split( m0, m8, compX );
-        const auto m2 = split( m0, m4, compY );
-        const auto m1 = split( m0, m2, compZ );
-        const auto m3 = split( m2, m4, compZ );
-        const auto m6 = split( m4, m8, compY );
-        const auto m5 = split( m4, m6, compZ );
-        const auto m7 = split( m6, m8, compZ );
-        morton_mapping< COORDZ >( points, m0, m1 );
-        morton_mapping< COORDY >( points, m1, m2 );
-        morton_mapping< COORDY >( points, m2, m3 );
-        morton_mapping< COORDX >( points, m3, m4 );
-        morton_mapping< COORDX >( points, m4, m5 );
-        morton_mapping< COORDY >( points, m5, m6 );
-        morton_mapping< COORDY >( points, m6, m7 );
-        morton_mapping< COORDZ >( points, m7, m8 );
+        itr m2, m6;
+        async::parallel_invoke(
+            [&m2, &m0, &m4, &compY] {
+                m2 = split( m0, m4, compY );
+            },
+            [&m6, &m4, &m8, &compY] {
+                m6 = split( m4, m8, compY );
+            } );
+        itr m1, m3, m5, m7;
+        async::parallel_invoke(
+            [&m1, &m0, &m2, &compZ] {
+                m1 = split( m0, m2, compZ );
+            },
+            [&m3, &m2, &m4, &compZ] {
+                m3 = split( m2, m4, compZ );
+            },
+            [&m5, &m4, &m6, &compZ] {
+                m5 = split( m4, m6, compZ );
+            },
+            [&m7, &m6, &m8, &compZ] {
+                m7 = split( m6, m8, compZ );
+            } );
+        async::parallel_invoke(
+            [&points, &m0, &m1] {
+                morton_mapping< COORDZ >( points, m0, m1 );
+            },
+            [&points, &m1, &m2] {
+                morton_mapping< COORDY >( points, m1, m2 );
+            },
+            [&points, &m2, &m3] {
+                morton_mapping< COORDY >( points, m2, m3 );
+            },
+            [&points, &m3, &m4] {
+                morton_mapping< COORDX >( points, m3, m4 );
+            },
+            [&points, &m4, &m5] {
+                morton_mapping< COORDX >( points, m4, m5 );
+            },
+            [&points, &m5, &m6] {
+                morton_mapping< COORDY >( points, m5, m6 );
+            },
+            [&points, &m6, &m7] {
+                morton_mapping< COORDY >( points, m6, m7 );
+            },
+            [&points, &m7, &m8] {
+                morton_mapping< COORDZ >( points, m7, m8 );
+            } );
     }
 
     template < geode::local_index_t COORDX >
@@ -142,13 +200,39 @@ namespace
 
         const auto m0 = begin;
         const auto m4 = end;
+        if( end - begin < MORTON_PARALLEL_CUTOFF )
+        {
+            const auto m2 = split( m0, m4, compX );
+            const auto m1 = split( m0, m2, compY );
+            const auto m3 = split( m2, m4, compY );
+            morton_mapping< COORDY >( points, m0, m1 );
+            morton_mapping< COORDX >( points, m1, m2 );
+            morton_mapping< COORDX >( points, m2, m3 );
+            morton_mapping< COORDY >( points, m3, m4 );
+            return;
+        }
         const auto m2 = split( m0, m4, compX );
-        const auto m1 = split( m0, m2, compY );
-        const auto m3 = split( m2, m4, compY );
-        morton_mapping< COORDY >( points, m0, m1 );
-        morton_mapping< COORDX >( points, m1, m2 );
-        morton_mapping< COORDX >( points, m2, m3 );
-        morton_mapping< COORDY >( points, m3, m4 );
+        itr m1, m3;
+        async::parallel_invoke(
+            [&m1, &m0, &m2, &compY] {
+                m1 = split( m0, m2, compY );
+            },
+            [&m3, &m2, &m4, &compY] {
+                m3 = split( m2, m4, compY );
+            } );
+        async::parallel_invoke(
+            [&points, &m0, &m1] {
+                morton_mapping< COORDY >( points, m0, m1 );
+            },
+            [&points, &m1, &m2] {
+                morton_mapping< COORDX >( points, m1, m2 );
+            },
+            [&points, &m2, &m3] {
+                morton_mapping< COORDX >( points, m2, m3 );
+            },
+            [&points, &m3, &m4] {
+                morton_mapping< COORDY >( points, m3, m4 );
+            } );
     }
 
     /*
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2019 - 2023 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/geometry/private/colocated_clusters.h>
+
+#include <numeric>
+
+#include <async++.h>
+
+#include <geode/basic/range.h>
+
+namespace
+{
+    constexpr geode::index_t CHUNK_SIZE{ 1024 };
+
+    /*
+     * Calls action( chunk, begin, end ) in parallel on each chunk of
+     * consecutive points.
+     */
+    template < typename Action >
+    void parallel_chunks( geode::index_t nb_points, const Action& action )
+    {
+        const auto nb_chunks = ( nb_points + CHUNK_SIZE - 1 ) / CHUNK_SIZE;
+        async::parallel_for( async::irange( geode::index_t{ 0 }, nb_chunks ),
+            [nb_points, &action]( geode::index_t chunk ) {
+                const auto begin = chunk * CHUNK_SIZE;
+                const auto end =
+                    std::min< geode::index_t >( begin + CHUNK_SIZE, nb_points );
+                action( chunk, begin, end );
+            } );
+    }
+} // namespace
+
+namespace geode
+{
+    namespace detail
+    {
+        ColocatedClusters::ColocatedClusters( index_t nb_points )
+            : parents_( nb_points )
+        {
+            async::parallel_for( async::irange( index_t{ 0 }, nb_points ),
+                [this]( index_t p ) {
+                    parents_[p].store( p, std::memory_order_relaxed );
+                } );
+        }
+
+        index_t ColocatedClusters::find_root( index_t point )
+        {
+            auto parent = parents_[point].load( std::memory_order_acquire );
+            while( parent != point )
+            {
+                // Path halving, a failed exchange only means another thread
+                // already shortened the path
+                const auto grand_parent =
+                    parents_[parent].load( std::memory_order_acquire );
+                parents_[point].compare_exchange_weak(
+                    parent, grand_parent, std::memory_order_acq_rel );
+                point = parent;
+                parent = parents_[point].load( std::memory_order_acquire );
+            }
+            return point;
+        }
+
+        void ColocatedClusters::link( index_t point0, index_t point1 )
+        {
+            while( true )
+            {
+                auto root0 = find_root( point0 );
+                auto root1 = find_root( point1 );
+                if( root0 == root1 )
+                {
+                    return;
+                }
+                if( root0 < root1 )
+                {
+                    std::swap( root0, root1 );
+                }
+                // Link the biggest root only if it is still a root
+                auto expected = root0;
+                if( parents_[root0].compare_exchange_strong(
+                        expected, root1, std::memory_order_acq_rel ) )
+                {
+                    return;
+                }
+            }
+        }
+
+        std::tuple< std::vector< index_t >, std::vector< index_t > >
+            ColocatedClusters::compute_mapping()
+        {
+            const index_t nb_points = parents_.size();
+            std::vector< index_t > mapping( nb_points );
+            std::vector< index_t > chunk_offsets(
+                ( nb_points + CHUNK_SIZE - 1 ) / CHUNK_SIZE + 1, 0 );
+            parallel_chunks( nb_points,
+                [&mapping, &chunk_offsets, this](
+                    index_t chunk, index_t begin, index_t end ) {
+                    for( const auto p : Range{ begin, end } )
+                    {
+                        mapping[p] = find_root( p );
+                        if( mapping[p] == p )
+                        {
+                            chunk_offsets[chunk + 1]++;
+                        }
+                    }
+                } );
+            std::partial_sum( chunk_offsets.begin(), chunk_offsets.end(),
+                chunk_offsets.begin() );
+            std::vector< index_t > representatives( chunk_offsets.back() );
+            parallel_chunks( nb_points,
+                [&mapping, &chunk_offsets, &representatives](
+                    index_t chunk, index_t begin, index_t end ) {
+                    auto count = chunk_offsets[chunk];
+                    for( const auto p : Range{ begin, end } )
+                    {
+                        if( mapping[p] == p )
+                        {
+                            representatives[count] = p;
+                            mapping[p] = count++;
+                        }
+                    }
+                } );
+            // The root slots now store the cluster indices
+            parallel_chunks( nb_points,
+                [&mapping, this](
+                    index_t /*chunk*/, index_t begin, index_t end ) {
+                    for( const auto p : Range{ begin, end } )
+                    {
+                        if( parents_[p].load( std::memory_order_relaxed )
+                            != p )
+                        {
+                            mapping[p] = mapping[mapping[p]];
+                        }
+                    }
+                } );
+            return std::make_tuple(
+                std::move( mapping ), std::move( representatives ) );
+        }
+    } // namespace detail
+} // namespace geode
@@ -23,7 +23,12 @@
 
 #include <geode/mesh/builder/solid_mesh_builder.h>
 
+#include <iterator>
+
+#include <async++.h>
+
 #include <geode/basic/attribute_manager.h>
+#include <geode/basic/private/parallel_sort.h>
 
 #include <geode/geometry/point.h>
 
@@ -37,6 +42,64 @@
 
 namespace
 {
+    constexpr geode::index_t ADJACENCY_CHUNK_SIZE{ 4096 };
+
+    using BorderFacet = std::pair<
+        geode::detail::VertexCycle< geode::PolyhedronFacetVertices >,
+        geode::PolyhedronFacet >;
+
+    template < geode::index_t dimension >
+    std::vector< BorderFacet > sorted_border_facets(
+        const geode::SolidMesh< dimension >& solid,
+        absl::Span< const geode::index_t > polyhedra )
+    {
+        const auto nb_polyhedra = static_cast< geode::index_t >(
+            polyhedra.size() );
+        const auto nb_chunks = ( nb_polyhedra + ADJACENCY_CHUNK_SIZE - 1 )
+                               / ADJACENCY_CHUNK_SIZE;
+        std::vector< std::vector< BorderFacet > > chunk_facets( nb_chunks );
+        async::parallel_for( async::irange( geode::index_t{ 0 }, nb_chunks ),
+            [&solid, &polyhedra, &chunk_facets, nb_polyhedra](
+                geode::index_t chunk ) {
+                const auto begin = chunk * ADJACENCY_CHUNK_SIZE;
+                const auto end =
+                    std::min( begin + ADJACENCY_CHUNK_SIZE, nb_polyhedra );
+                auto& facets = chunk_facets[chunk];
+                for( const auto p : geode::Range{ begin, end } )
+                {
+                    const auto polyhedron = polyhedra[p];
+                    for( const auto f : geode::LRange{
+                             solid.nb_polyhedron_facets( polyhedron ) } )
+                    {
+                        const geode::PolyhedronFacet facet{ polyhedron, f };
+                        if( solid.is_polyhedron_facet_on_border( facet ) )
+                        {
+                            facets.emplace_back(
+                                solid.polyhedron_facet_vertices( facet ),
+                                facet );
+                        }
+                    }
+                }
+            } );
+        std::vector< BorderFacet > facets;
+        size_t nb_facets{ 0 };
+        for( const auto& chunk : chunk_facets )
+        {
+            nb_facets += chunk.size();
+        }
+        facets.reserve( nb_facets );
+        for( auto& chunk : chunk_facets )
+        {
+            std::move( chunk.begin(), chunk.end(),
+                std::back_inserter( facets ) );
+        }
+        geode::detail::parallel_stable_sort( facets,
+            []( const BorderFacet& lhs, const BorderFacet& rhs ) {
+                return lhs.first < rhs.first;
+            } );
+        return facets;
+    }
+
     template < geode::index_t dimension >
     void check_polyhedron_id( const geode::SolidMesh< dimension >& solid,
         const geode::index_t polyhedron_id )
@@ -630,29 +693,27 @@ namespace geode
     void SolidMeshBuilder< dimension >::compute_polyhedron_adjacencies(
         absl::Span< const index_t > polyhedra_to_connect )
     {
-        using Facet = detail::VertexCycle< PolyhedronFacetVertices >;
-        absl::flat_hash_map< Facet, PolyhedronFacet > facets;
-        for( const auto polyhedron : polyhedra_to_connect )
-        {
-            for( const auto f :
-                LRange{ solid_mesh_.nb_polyhedron_facets( polyhedron ) } )
+        // Border facets are sorted by vertex cycle, facets sharing the same
+        // cycle keep the order in which they are given. Consecutive facets
+        // of each group are then paired two by two, an odd remaining facet
+        // stays on border.
+        const auto facets =
+            sorted_border_facets( solid_mesh_, polyhedra_to_connect );
+        index_t f{ 0 };
+        while( f + 1 < facets.size() )
+        {
+            const auto& facet = facets[f];
+            const auto& next_facet = facets[f + 1];
+            if( facet.first != next_facet.first )
             {
-                const PolyhedronFacet facet{ polyhedron, f };
-                if( !solid_mesh_.is_polyhedron_facet_on_border( facet ) )
-                {
-                    continue;
-                }
-                const auto output = facets.emplace(
-                    solid_mesh_.polyhedron_facet_vertices( facet ), facet );
-                if( !output.second )
-                {
-                    const auto it = output.first;
-                    do_set_polyhedron_adjacent( it->second, polyhedron );
-                    do_set_polyhedron_adjacent(
-                        facet, it->second.polyhedron_id );
-                    facets.erase( it );
-                }
+                f++;
+                continue;
             }
+            do_set_polyhedron_adjacent(
+                facet.second, next_facet.second.polyhedron_id );
+            do_set_polyhedron_adjacent(
+                next_facet.second, facet.second.polyhedron_id );
+            f += 2;
         }
     }
 
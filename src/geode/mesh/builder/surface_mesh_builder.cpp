@@ -23,18 +23,80 @@
 
 #include <geode/mesh/builder/surface_mesh_builder.h>
 
+#include <async++.h>
+
 #include <geode/basic/attribute_manager.h>
+#include <geode/basic/private/parallel_sort.h>
 
 #include <geode/geometry/point.h>
 
 #include <geode/mesh/builder/mesh_builder_factory.h>
 #include <geode/mesh/builder/surface_edges_builder.h>
-#include <geode/mesh/core/detail/vertex_cycle.h>
 #include <geode/mesh/core/surface_edges.h>
 #include <geode/mesh/core/surface_mesh.h>
 
 namespace
 {
+    constexpr geode::index_t ADJACENCY_CHUNK_SIZE{ 4096 };
+
+    using BorderEdge = std::pair< std::array< geode::index_t, 2 >,
+        geode::PolygonEdge >;
+
+    template < geode::index_t dimension >
+    std::vector< BorderEdge > sorted_border_edges(
+        const geode::SurfaceMesh< dimension >& surface,
+        absl::Span< const geode::index_t > polygons )
+    {
+        const auto nb_polygons = static_cast< geode::index_t >(
+            polygons.size() );
+        const auto nb_chunks = ( nb_polygons + ADJACENCY_CHUNK_SIZE - 1 )
+                               / ADJACENCY_CHUNK_SIZE;
+        std::vector< std::vector< BorderEdge > > chunk_edges( nb_chunks );
+        async::parallel_for( async::irange( geode::index_t{ 0 }, nb_chunks ),
+            [&surface, &polygons, &chunk_edges, nb_polygons](
+                geode::index_t chunk ) {
+                const auto begin = chunk * ADJACENCY_CHUNK_SIZE;
+                const auto end =
+                    std::min( begin + ADJACENCY_CHUNK_SIZE, nb_polygons );
+                auto& edges = chunk_edges[chunk];
+                for( const auto p : geode::Range{ begin, end } )
+                {
+                    const auto polygon = polygons[p];
+                    for( const auto e : geode::LRange{
+                             surface.nb_polygon_edges( polygon ) } )
+                    {
+                        const geode::PolygonEdge edge{ polygon, e };
+                        if( !surface.is_edge_on_border( edge ) )
+                        {
+                            continue;
+                        }
+                        auto vertices = surface.polygon_edge_vertices( edge );
+                        if( vertices[0] > vertices[1] )
+                        {
+                            std::swap( vertices[0], vertices[1] );
+                        }
+                        edges.emplace_back( vertices, edge );
+                    }
+                }
+            } );
+        std::vector< BorderEdge > edges;
+        size_t nb_edges{ 0 };
+        for( const auto& chunk : chunk_edges )
+        {
+            nb_edges += chunk.size();
+        }
+        edges.reserve( nb_edges );
+        for( const auto& chunk : chunk_edges )
+        {
+            edges.insert( edges.end(), chunk.begin(), chunk.end() );
+        }
+        geode::detail::parallel_stable_sort(
+            edges, []( const BorderEdge& lhs, const BorderEdge& rhs ) {
+                return lhs.first < rhs.first;
+            } );
+        return edges;
+    }
+
     template < geode::index_t dimension >
     void check_polygon_id( const geode::SurfaceMesh< dimension >& surface,
         const geode::index_t polygon_id )
@@ -140,33 +202,6 @@ namespace
         return vertices_id;
     }
 
-    template < geode::index_t dimension >
-    absl::optional< geode::PolygonEdge > find_polygon_adjacent_edge(
-        const geode::SurfaceMesh< dimension >& surface,
-        const geode::PolygonEdge& polygon_edge,
-        const std::array< geode::index_t, 2 >& vertices )
-    {
-        const auto polygon_adj = surface.polygon_adjacent( polygon_edge );
-        if( !polygon_adj )
-        {
-            return absl::nullopt;
-        }
-        const auto polygon_adj_id = polygon_adj.value();
-        for( const auto e :
-            geode::LRange{ surface.nb_polygon_edges( polygon_adj_id ) } )
-        {
-            const geode::PolygonEdge adj_edge{ polygon_adj_id, e };
-            const auto adj_v0 = surface.polygon_vertex( adj_edge );
-            const auto adj_v1 = surface.polygon_edge_vertex( adj_edge, 1 );
-            if( ( vertices[0] == adj_v1 && vertices[1] == adj_v0 )
-                || ( vertices[0] == adj_v0 && vertices[1] == adj_v1 ) )
-            {
-                return adj_edge;
-            }
-        }
-        return absl::nullopt;
-    }
-
     template < geode::index_t dimension >
     void update_polygon_around( const geode::SurfaceMesh< dimension >& surface,
         geode::SurfaceMeshBuilder< dimension >& builder,
@@ -216,31 +251,6 @@ namespace
         }
     }
 
-    template < geode::index_t dimension >
-    absl::optional< geode::PolygonEdge > non_manifold_polygon_adjacent_edge(
-        const geode::SurfaceMesh< dimension >& surface,
-        const geode::PolygonEdge& polygon_edge,
-        const std::array< geode::index_t, 2 >& vertices )
-    {
-        const auto adj_edge =
-            find_polygon_adjacent_edge( surface, polygon_edge, vertices );
-        if( !adj_edge )
-        {
-            return absl::nullopt;
-        }
-        const auto polygon = surface.polygon_adjacent( adj_edge.value() );
-        if( !polygon )
-        {
-            return absl::nullopt;
-        }
-        // Non-manifold edge
-        if( polygon != polygon_edge.polygon_id )
-        {
-            return adj_edge;
-        }
-        return absl::nullopt;
-    }
-
     template < geode::index_t dimension >
     void reset_polygons_around_edge_vertices(
         const geode::SurfaceMesh< dimension >& surface,
@@ -580,51 +590,28 @@ namespace geode
         }
         else
         {
-            using Edge = detail::VertexCycle< std::array< index_t, 2 > >;
-            absl::flat_hash_map< Edge, PolygonEdge > edges;
-            for( const auto polygon : polygons_to_connect )
+            // Border edges are sorted by vertices, only edges shared by
+            // exactly two polygons are connected, non-manifold edges stay on
+            // border.
+            const auto edges =
+                sorted_border_edges( surface_mesh_, polygons_to_connect );
+            index_t begin{ 0 };
+            while( begin < edges.size() )
             {
-                for( const auto e :
-                    LRange{ surface_mesh_.nb_polygon_edges( polygon ) } )
+                auto end = begin + 1;
+                while( end < edges.size()
+                       && edges[end].first == edges[begin].first )
                 {
-                    const PolygonEdge edge{ polygon, e };
-                    if( !surface_mesh_.is_edge_on_border( edge ) )
-                    {
-                        continue;
-                    }
-                    auto output = edges.emplace(
-                        surface_mesh_.polygon_edge_vertices( edge ), edge );
-                    if( !output.second )
-                    {
-                        auto& adj_edge = output.first->second;
-                        do_set_polygon_adjacent( edge, adj_edge.polygon_id );
-                        if( surface_mesh_.is_edge_on_border( adj_edge ) )
-                        {
-                            do_set_polygon_adjacent( adj_edge, polygon );
-                        }
-                        else
-                        {
-                            const auto adj_adj_edge =
-                                find_polygon_adjacent_edge( surface_mesh_,
-                                    adj_edge,
-                                    surface_mesh_.polygon_edge_vertices(
-                                        edge ) );
-                            do_unset_polygon_adjacent( adj_adj_edge.value() );
-                        }
-                        adj_edge = edge;
-                    }
+                    end++;
                 }
-            }
-            for( const auto& polygon_edges : edges )
-            {
-                const auto& polygon_edge = polygon_edges.second;
-                if( const auto polygon_adj =
-                        non_manifold_polygon_adjacent_edge( surface_mesh_,
-                            polygon_edge, polygon_edges.first.vertices() ) )
+                if( end - begin == 2 )
                 {
-                    do_unset_polygon_adjacent( polygon_edge );
-                    do_unset_polygon_adjacent( polygon_adj.value() );
+                    const auto& edge0 = edges[begin].second;
+                    const auto& edge1 = edges[begin + 1].second;
+                    do_set_polygon_adjacent( edge0, edge1.polygon_id );
+                    do_set_polygon_adjacent( edge1, edge0.polygon_id );
                 }
+                begin = end;
             }
         }
     }
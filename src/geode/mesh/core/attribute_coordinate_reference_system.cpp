@@ -102,6 +102,13 @@ namespace geode
         impl_->set_point( point_id, std::move( point ) );
     }
 
+    template < index_t dimension >
+    absl::Span< const Point< dimension > >
+        AttributeCoordinateReferenceSystem< dimension >::points() const
+    {
+        return impl_->points();
+    }
+
     template < index_t dimension >
     absl::string_view
         AttributeCoordinateReferenceSystem< dimension >::attribute_name() const
@@ -67,6 +67,13 @@ namespace geode
                 .point( vertex );
         }
 
+        absl::Span< const Point< dimension > > points() const
+        {
+            return main_coordinate_reference_system_manager()
+                .active_coordinate_reference_system()
+                .points();
+        }
+
         CoordinateReferenceSystemManager1D&
             coordinate_reference_system_manager1D()
         {
@@ -202,6 +209,13 @@ namespace geode
         return impl_->point( vertex );
     }
 
+    template < index_t dimension >
+    absl::Span< const Point< dimension > >
+        CoordinateReferenceSystemManagers< dimension >::points() const
+    {
+        return impl_->points();
+    }
+
     template < index_t dimension >
     CoordinateReferenceSystemManager1D& CoordinateReferenceSystemManagers<
         dimension >::coordinate_reference_system_manager1D( CRSManagersKey )
@@ -63,6 +63,10 @@ namespace geode
                               NO_ID, NO_ID, NO_ID, NO_ID },
                           { false, false } ) )
         {
+            mesh.polyhedron_attribute_manager().set_attribute_structural(
+                "tetrahedron_vertices" );
+            mesh.polyhedron_attribute_manager().set_attribute_structural(
+                "tetrahedron_adjacents" );
         }
 
         index_t get_polyhedron_vertex(
@@ -94,6 +98,18 @@ namespace geode
             return adj;
         }
 
+        absl::Span< const std::array< index_t, 4 > >
+            tetrahedron_vertices_storage() const
+        {
+            return tetrahedron_vertices_->values();
+        }
+
+        absl::Span< const std::array< index_t, 4 > >
+            tetrahedron_adjacents_storage() const
+        {
+            return tetrahedron_adjacents_->values();
+        }
+
         void set_polyhedron_vertex(
             const PolyhedronVertex& polyhedron_vertex, const index_t vertex_id )
         {
@@ -197,6 +213,20 @@ namespace geode
         return impl_->get_polyhedron_adjacent( polyhedron_facet );
     }
 
+    template < index_t dimension >
+    absl::Span< const std::array< index_t, 4 > > OpenGeodeTetrahedralSolid<
+        dimension >::tetrahedron_vertices_storage() const
+    {
+        return impl_->tetrahedron_vertices_storage();
+    }
+
+    template < index_t dimension >
+    absl::Span< const std::array< index_t, 4 > > OpenGeodeTetrahedralSolid<
+        dimension >::tetrahedron_adjacents_storage() const
+    {
+        return impl_->tetrahedron_adjacents_storage();
+    }
+
     template < index_t dimension >
     template < typename Archive >
     void OpenGeodeTetrahedralSolid< dimension >::serialize( Archive& archive )
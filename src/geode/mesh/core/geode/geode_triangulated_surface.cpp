@@ -60,6 +60,10 @@ namespace geode
                           std::array< index_t, 3 >{ NO_ID, NO_ID, NO_ID },
                           { false, false } ) )
         {
+            mesh.polygon_attribute_manager().set_attribute_structural(
+                "triangle_vertices" );
+            mesh.polygon_attribute_manager().set_attribute_structural(
+                "triangle_adjacents" );
         }
 
         index_t get_polygon_vertex( const PolygonVertex& polygon_vertex ) const
@@ -81,6 +85,18 @@ namespace geode
             return adj;
         }
 
+        absl::Span< const std::array< index_t, 3 > >
+            triangle_vertices_storage() const
+        {
+            return triangle_vertices_->values();
+        }
+
+        absl::Span< const std::array< index_t, 3 > >
+            triangle_adjacents_storage() const
+        {
+            return triangle_adjacents_->values();
+        }
+
         void set_polygon_vertex(
             const PolygonVertex& polygon_vertex, const index_t vertex_id )
         {
@@ -173,6 +189,20 @@ namespace geode
         return impl_->get_polygon_adjacent( polygon_edge );
     }
 
+    template < index_t dimension >
+    absl::Span< const std::array< index_t, 3 > > OpenGeodeTriangulatedSurface<
+        dimension >::triangle_vertices_storage() const
+    {
+        return impl_->triangle_vertices_storage();
+    }
+
+    template < index_t dimension >
+    absl::Span< const std::array< index_t, 3 > > OpenGeodeTriangulatedSurface<
+        dimension >::triangle_adjacents_storage() const
+    {
+        return impl_->triangle_adjacents_storage();
+    }
+
     template < index_t dimension >
     template < typename Archive >
     void OpenGeodeTriangulatedSurface< dimension >::serialize(
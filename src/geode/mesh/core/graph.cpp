@@ -50,6 +50,8 @@ namespace geode
                         EdgesAroundVertex >(
                         attribute_name, EdgesAroundVertex{} ) )
         {
+            graph.vertex_attribute_manager().set_attribute_structural(
+                attribute_name );
         }
 
         Impl( Impl&& other ) = default;
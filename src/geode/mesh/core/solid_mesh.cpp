@@ -378,6 +378,9 @@ namespace geode
                           CachedPolyhedra >(
                           polyhedra_around_vertex_name, CachedPolyhedra{} ) )
         {
+            auto& manager = solid.vertex_attribute_manager();
+            manager.set_attribute_structural( "polyhedron_around_vertex" );
+            manager.set_attribute_structural( polyhedra_around_vertex_name );
         }
 
         absl::optional< PolyhedronVertex > polyhedron_around_vertex(
@@ -226,6 +226,9 @@ namespace geode
                           CachedPolygons >(
                           polygons_around_vertex_name, CachedPolygons{} ) )
         {
+            auto& manager = surface.vertex_attribute_manager();
+            manager.set_attribute_structural( "polygon_around_vertex" );
+            manager.set_attribute_structural( polygons_around_vertex_name );
         }
 
         absl::optional< PolygonVertex > polygon_around_vertex(
@@ -37,24 +37,44 @@
 #include <geode/geometry/point.h>
 #include <geode/geometry/projection.h>
 
+#include <geode/mesh/core/detail/mesh_points.h>
 #include <geode/mesh/core/edged_curve.h>
 
+namespace
+{
+    template < geode::index_t dimension >
+    absl::FixedArray< geode::BoundingBox< dimension > > mesh_boxes(
+        const geode::EdgedCurve< dimension >& mesh )
+    {
+        absl::FixedArray< geode::BoundingBox< dimension > > box_vector(
+            mesh.nb_edges() );
+        const geode::detail::MeshPoints< dimension > points{ mesh };
+        async::parallel_for(
+            async::irange( geode::index_t{ 0 }, mesh.nb_edges() ),
+            [&box_vector, &mesh, &points]( geode::index_t e ) {
+                geode::BoundingBox< dimension > bbox;
+                bbox.add_point( points.point( mesh.edge_vertex( { e, 0 } ) ) );
+                bbox.add_point( points.point( mesh.edge_vertex( { e, 1 } ) ) );
+                box_vector[e] = std::move( bbox );
+            } );
+        return box_vector;
+    }
+} // namespace
+
 namespace geode
 {
     template < index_t dimension >
     AABBTree< dimension > create_aabb_tree(
         const EdgedCurve< dimension >& mesh )
     {
-        absl::FixedArray< BoundingBox< dimension > > box_vector(
-            mesh.nb_edges() );
-        async::parallel_for( async::irange( index_t{ 0 }, mesh.nb_edges() ),
-            [&box_vector, &mesh]( index_t e ) {
-                BoundingBox< dimension > bbox;
-                bbox.add_point( mesh.point( mesh.edge_vertex( { e, 0 } ) ) );
-                bbox.add_point( mesh.point( mesh.edge_vertex( { e, 1 } ) ) );
-                box_vector[e] = std::move( bbox );
-            } );
-        return { box_vector };
+        return { mesh_boxes( mesh ) };
+    }
+
+    template < index_t dimension >
+    void refit_aabb_tree(
+        AABBTree< dimension >& tree, const EdgedCurve< dimension >& mesh )
+    {
+        tree.refit( mesh_boxes( mesh ) );
     }
 
     template < index_t dimension >
@@ -71,6 +91,10 @@ namespace geode
         const EdgedCurve2D& );
     template opengeode_mesh_api AABBTree3D create_aabb_tree< 3 >(
         const EdgedCurve3D& );
+    template opengeode_mesh_api void refit_aabb_tree< 2 >(
+        AABBTree2D&, const EdgedCurve2D& );
+    template opengeode_mesh_api void refit_aabb_tree< 3 >(
+        AABBTree3D&, const EdgedCurve3D& );
 
     template class opengeode_mesh_api DistanceToEdge< 2 >;
     template class opengeode_mesh_api DistanceToEdge< 3 >;
@@ -30,26 +30,63 @@
 #include <geode/geometry/distance.h>
 #include <geode/geometry/point.h>
 
+#include <geode/mesh/core/detail/mesh_points.h>
+#include <geode/mesh/core/geode/geode_tetrahedral_solid_view.h>
 #include <geode/mesh/core/tetrahedral_solid.h>
 
-namespace geode
+namespace
 {
-    template < index_t dimension >
-    AABBTree< dimension > create_aabb_tree( const SolidMesh< dimension >& mesh )
+    template < geode::index_t dimension, typename Mesh, typename Points >
+    absl::FixedArray< geode::BoundingBox< dimension > > mesh_boxes(
+        const Mesh& mesh, const Points& points )
     {
-        absl::FixedArray< BoundingBox< dimension > > box_vector(
+        absl::FixedArray< geode::BoundingBox< dimension > > box_vector(
             mesh.nb_polyhedra() );
-        async::parallel_for( async::irange( index_t{ 0 }, mesh.nb_polyhedra() ),
-            [&box_vector, &mesh]( index_t p ) {
-                BoundingBox< dimension > bbox;
-                for( const auto v : LRange{ mesh.nb_polyhedron_vertices( p ) } )
+        async::parallel_for(
+            async::irange( geode::index_t{ 0 }, mesh.nb_polyhedra() ),
+            [&box_vector, &mesh, &points]( geode::index_t p ) {
+                geode::BoundingBox< dimension > bbox;
+                for( const auto v :
+                    geode::LRange{ mesh.nb_polyhedron_vertices( p ) } )
                 {
                     bbox.add_point(
-                        mesh.point( mesh.polyhedron_vertex( { p, v } ) ) );
+                        points.point( mesh.polyhedron_vertex( { p, v } ) ) );
                 }
                 box_vector[p] = std::move( bbox );
             } );
-        return { box_vector };
+        return box_vector;
+    }
+
+    template < geode::index_t dimension >
+    absl::FixedArray< geode::BoundingBox< dimension > > mesh_boxes(
+        const geode::SolidMesh< dimension >& mesh )
+    {
+        if( const auto* native = dynamic_cast<
+                const geode::OpenGeodeTetrahedralSolid< dimension >* >(
+                &mesh ) )
+        {
+            const geode::TetrahedralSolidView< dimension > view{ *native };
+            return mesh_boxes< dimension >( view, view );
+        }
+        const geode::detail::MeshPoints< dimension > points{ mesh };
+        return mesh_boxes< dimension >( mesh, points );
+    }
+} // namespace
+
+namespace geode
+{
+    template < index_t dimension >
+    AABBTree< dimension > create_aabb_tree(
+        const SolidMesh< dimension >& mesh )
+    {
+        return { mesh_boxes( mesh ) };
+    }
+
+    template < index_t dimension >
+    void refit_aabb_tree(
+        AABBTree< dimension >& tree, const SolidMesh< dimension >& mesh )
+    {
+        tree.refit( mesh_boxes( mesh ) );
     }
 
     template < index_t dimension >
@@ -63,6 +100,8 @@ namespace geode
 
     template opengeode_mesh_api AABBTree3D create_aabb_tree< 3 >(
         const SolidMesh3D& );
+    template opengeode_mesh_api void refit_aabb_tree< 3 >(
+        AABBTree3D&, const SolidMesh3D& );
 
     template class opengeode_mesh_api DistanceToTetrahedron< 3 >;
 
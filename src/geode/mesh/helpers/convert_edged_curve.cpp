@@ -82,16 +82,19 @@ namespace geode
 
     template < index_t dimension >
     std::unique_ptr< EdgedCurve< dimension > > merge_edged_curves( absl::Span<
-        const std::reference_wrapper< const EdgedCurve< dimension > > > curves )
+        const std::reference_wrapper< const EdgedCurve< dimension > > > curves,
+        ColocationMethod method )
     {
         detail::EdgedCurveMerger< dimension > merger{ curves, global_epsilon };
-        return merger.merge();
+        return merger.merge( method );
     }
 
     template std::unique_ptr< EdgedCurve< 2 > >
         opengeode_mesh_api merge_edged_curves( absl::Span<
-            const std::reference_wrapper< const EdgedCurve< 2 > > > );
+            const std::reference_wrapper< const EdgedCurve< 2 > > >,
+        ColocationMethod );
     template std::unique_ptr< EdgedCurve< 3 > >
         opengeode_mesh_api merge_edged_curves( absl::Span<
-            const std::reference_wrapper< const EdgedCurve< 3 > > > );
+            const std::reference_wrapper< const EdgedCurve< 3 > > >,
+        ColocationMethod );
 } // namespace geode
@@ -86,9 +86,10 @@ namespace geode
     }
 
     std::unique_ptr< SolidMesh3D > merge_solid_meshes(
-        absl::Span< const std::reference_wrapper< const SolidMesh3D > > solids )
+        absl::Span< const std::reference_wrapper< const SolidMesh3D > > solids,
+        ColocationMethod method )
     {
         detail::SolidMeshMerger3D merger{ solids, global_epsilon };
-        return merger.merge();
+        return merger.merge( method );
     }
 } // namespace geode
@@ -261,11 +261,12 @@ namespace geode
     std::unique_ptr< SurfaceMesh< dimension > > merge_surface_meshes(
         absl::Span<
             const std::reference_wrapper< const SurfaceMesh< dimension > > >
-            surfaces )
+            surfaces,
+        ColocationMethod method )
     {
         detail::SurfaceMeshMerger< dimension > merger{ surfaces,
             global_epsilon };
-        return merger.merge();
+        return merger.merge( method );
     }
 
     template absl::optional< std::unique_ptr< TriangulatedSurface2D > >
@@ -284,9 +285,13 @@ namespace geode
         const SurfaceMesh3D&, SurfaceMeshBuilder3D& );
 
     template std::unique_ptr< SurfaceMesh< 2 > >
-        opengeode_mesh_api merge_surface_meshes( absl::Span<
-            const std::reference_wrapper< const SurfaceMesh< 2 > > > );
+        opengeode_mesh_api merge_surface_meshes(
+            absl::Span<
+                const std::reference_wrapper< const SurfaceMesh< 2 > > >,
+            ColocationMethod );
     template std::unique_ptr< SurfaceMesh< 3 > >
-        opengeode_mesh_api merge_surface_meshes( absl::Span<
-            const std::reference_wrapper< const SurfaceMesh< 3 > > > );
+        opengeode_mesh_api merge_surface_meshes(
+            absl::Span<
+                const std::reference_wrapper< const SurfaceMesh< 3 > > >,
+            ColocationMethod );
 } // namespace geode
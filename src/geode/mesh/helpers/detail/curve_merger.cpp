@@ -65,9 +65,10 @@ namespace geode
                 curve_id_.reserve( nb_edges );
             }
 
-            std::unique_ptr< EdgedCurve< dimension > > merge()
+            std::unique_ptr< EdgedCurve< dimension > > merge(
+                ColocationMethod method )
             {
-                create_curve_step();
+                create_curve_step( method );
                 return this->steal_mesh();
             }
 
@@ -87,9 +88,9 @@ namespace geode
             }
 
         private:
-            void create_curve_step()
+            void create_curve_step( ColocationMethod method )
             {
-                this->create_points();
+                this->create_points( method );
                 create_edges();
                 clean_curve();
                 curve_id_.clear();
@@ -195,9 +196,9 @@ namespace geode
 
         template < index_t dimension >
         std::unique_ptr< EdgedCurve< dimension > >
-            EdgedCurveMerger< dimension >::merge()
+            EdgedCurveMerger< dimension >::merge( ColocationMethod method )
         {
-            return impl_->merge();
+            return impl_->merge( method );
         }
 
         template < index_t dimension >
@@ -65,9 +65,10 @@ namespace geode
                 solid_id_.reserve( nb_polyhedra );
             }
 
-            std::unique_ptr< SolidMesh< dimension > > merge()
+            std::unique_ptr< SolidMesh< dimension > > merge(
+                ColocationMethod method )
             {
-                create_solid_step();
+                create_solid_step( method );
                 return this->steal_mesh();
             }
 
@@ -91,9 +92,9 @@ namespace geode
             }
 
         private:
-            void create_solid_step()
+            void create_solid_step( ColocationMethod method )
             {
-                this->create_points();
+                this->create_points( method );
                 create_polyhedra();
                 create_adjacencies();
                 clean_solid();
@@ -279,9 +280,9 @@ namespace geode
 
         template < index_t dimension >
         std::unique_ptr< SolidMesh< dimension > >
-            SolidMeshMerger< dimension >::merge()
+            SolidMeshMerger< dimension >::merge( ColocationMethod method )
         {
-            return impl_->merge();
+            return impl_->merge( method );
         }
 
         template < index_t dimension >
@@ -66,9 +66,10 @@ namespace geode
                 surface_id_.reserve( nb_polygons );
             }
 
-            std::unique_ptr< SurfaceMesh< dimension > > merge()
+            std::unique_ptr< SurfaceMesh< dimension > > merge(
+                ColocationMethod method )
             {
-                create_surface_step();
+                create_surface_step( method );
                 return this->steal_mesh();
             }
 
@@ -89,9 +90,9 @@ namespace geode
             }
 
         private:
-            void create_surface_step()
+            void create_surface_step( ColocationMethod method )
             {
-                this->create_points();
+                this->create_points( method );
                 create_polygons();
                 create_adjacencies();
                 clean_surface();
@@ -263,9 +264,9 @@ namespace geode
 
         template < index_t dimension >
         std::unique_ptr< SurfaceMesh< dimension > >
-            SurfaceMeshMerger< dimension >::merge()
+            SurfaceMeshMerger< dimension >::merge( ColocationMethod method )
         {
-            return impl_->merge();
+            return impl_->merge( method );
         }
 
         template < index_t dimension >
@@ -70,13 +70,13 @@ namespace geode
 
         void squared_root_filter()
         {
-            async::parallel_for(
-                async::irange( index_t{ 0 }, grid_.nb_cells() ),
-                [this]( index_t cell ) {
-                    distance_map_->modify_value( cell, []( double& value ) {
-                        value = std::sqrt( value );
+            distance_map_->modify_values( []( absl::Span< double > values ) {
+                async::parallel_for(
+                    async::irange( size_t{ 0 }, values.size() ),
+                    [&values]( size_t cell ) {
+                        values[cell] = std::sqrt( values[cell] );
                     } );
-                } );
+            } );
             return;
         }
 
@@ -29,6 +29,7 @@
 #include <geode/geometry/aabb.h>
 #include <geode/geometry/point.h>
 
+#include <geode/mesh/core/detail/mesh_points.h>
 #include <geode/mesh/core/triangulated_surface.h>
 #include <geode/mesh/helpers/aabb_surface_helpers.h>
 #include <geode/mesh/io/triangulated_surface_input.h>
@@ -43,10 +44,11 @@ namespace
     {
         const auto mesh_B_tree = geode::create_aabb_tree( mesh_B );
         const geode::DistanceToTriangle3D distance_action{ mesh_B };
+        const geode::detail::MeshPoints3D points_A{ mesh_A };
         double min_dist = 0;
         for( auto v : geode::Range{ mesh_A.nb_vertices() } )
         {
-            const auto& query = mesh_A.point( v );
+            const auto& query = points_A.point( v );
             const auto closest_element =
                 mesh_B_tree.closest_element_box( query, distance_action );
             const auto distance = std::get< 2 >( closest_element );
@@ -23,9 +23,14 @@
 
 #include <geode/mesh/helpers/ray_tracing.h>
 
+#include <async++.h>
+
+#include <absl/container/inlined_vector.h>
+
 #include <geode/basic/algorithm.h>
 #include <geode/basic/pimpl_impl.h>
 
+#include <geode/geometry/aabb.h>
 #include <geode/geometry/basic_objects/segment.h>
 #include <geode/geometry/basic_objects/triangle.h>
 #include <geode/geometry/bounding_box.h>
@@ -34,6 +39,7 @@
 #include <geode/geometry/intersection.h>
 #include <geode/geometry/intersection_detection.h>
 
+#include <geode/mesh/core/detail/mesh_points.h>
 #include <geode/mesh/core/surface_mesh.h>
 
 namespace
@@ -56,6 +62,45 @@ namespace
         return line.origin() + line.direction() * diagonal.length();
     }
 
+    constexpr geode::index_t RAYS_CHUNK_SIZE{ 256 };
+
+    /*
+     * Intersection points between a segment and a triangle: the intersection
+     * point or, if they are coplanar, the points of the segment closest to
+     * the triangle edges.
+     */
+    absl::InlinedVector< geode::Point3D, 3 > segment_triangle_intersections(
+        const geode::Segment3D& segment, const geode::Triangle3D& triangle )
+    {
+        absl::InlinedVector< geode::Point3D, 3 > result;
+        if( auto intersection =
+                geode::segment_triangle_intersection( segment, triangle ) )
+        {
+            result.emplace_back( std::move( intersection.result.value() ) );
+            return result;
+        }
+        for( const auto e : geode::LRange{ 3 } )
+        {
+            result.emplace_back(
+                std::get< 1 >( geode::segment_segment_distance( segment,
+                    { triangle.vertices()[e].get(),
+                        triangle.vertices()[( e + 1 ) % 3].get() } ) ) );
+        }
+        return result;
+    }
+
+    double signed_distance( const geode::Point3D& origin,
+        const geode::Point3D& point,
+        const geode::Vector3D& direction )
+    {
+        const auto distance = geode::point_point_distance( origin, point );
+        if( geode::Vector3D{ origin, point }.dot( direction ) < 0 )
+        {
+            return -distance;
+        }
+        return distance;
+    }
+
     bool test_vertex_mode( const geode::SurfaceMesh3D& mesh,
         const geode::RayTracing3D::PolygonDistance& polygon0,
         const geode::RayTracing3D::PolygonDistance& polygon1 )
@@ -173,6 +218,7 @@ namespace geode
     public:
         Impl( const SurfaceMesh3D& mesh, const Ray3D& ray )
             : mesh_( mesh ),
+              points_( mesh ),
               origin_( ray.origin() ),
               segment_{ ray.origin(), end( mesh, ray ) }
         {
@@ -180,6 +226,7 @@ namespace geode
 
         Impl( const SurfaceMesh3D& mesh, const InfiniteLine3D& infinite_line )
             : mesh_( mesh ),
+              points_( mesh ),
               origin_( infinite_line.origin() ),
               segment_{ begin( mesh, infinite_line ),
                   end( mesh, infinite_line ) }
@@ -227,54 +274,28 @@ namespace geode
         bool compute( index_t polygon_id )
         {
             const auto& p0 =
-                mesh_.point( mesh_.polygon_vertex( { polygon_id, 0 } ) );
+                points_.point( mesh_.polygon_vertex( { polygon_id, 0 } ) );
             for( const auto e :
                 LRange{ 1, mesh_.nb_polygon_edges( polygon_id ) - 1 } )
             {
                 const auto edge_vertices =
                     mesh_.polygon_edge_vertices( { polygon_id, e } );
                 const Triangle3D triangle{ p0,
-                    mesh_.point( edge_vertices.front() ),
-                    mesh_.point( edge_vertices.back() ) };
+                    points_.point( edge_vertices.front() ),
+                    points_.point( edge_vertices.back() ) };
                 const auto result = segment_triangle_intersection_detection(
                     segment_, triangle );
                 if( result.first == Position::outside )
                 {
                     continue;
                 }
-                if( auto intersection =
-                        segment_triangle_intersection( segment_, triangle ) )
+                for( auto& point : segment_triangle_intersections(
+                         Segment3D{ segment_ }, triangle ) )
                 {
-                    auto& intersection_result = intersection.result.value();
-                    auto distance =
-                        point_point_distance( origin_, intersection_result );
-                    if( Vector3D{ origin_, intersection_result }.dot(
-                            segment_.direction() )
-                        < 0 )
-                    {
-                        distance *= -1.;
-                    }
+                    const auto distance = signed_distance(
+                        origin_, point, segment_.direction() );
                     results_.emplace_back( polygon_id, distance, result.second,
-                        std::move( intersection_result ) );
-                }
-                else
-                {
-                    for( const auto e2 : LRange{ 3 } )
-                    {
-                        auto point = std::get< 1 >( segment_segment_distance(
-                            Segment3D{ segment_ },
-                            { triangle.vertices()[e2].get(),
-                                triangle.vertices()[( e2 + 1 ) % 3].get() } ) );
-                        auto distance = point_point_distance( origin_, point );
-                        if( Vector3D{ origin_, point }.dot(
-                                segment_.direction() )
-                            < 0 )
-                        {
-                            distance *= -1.;
-                        }
-                        results_.emplace_back( polygon_id, distance,
-                            result.second, std::move( point ) );
-                    }
+                        std::move( point ) );
                 }
                 break;
             }
@@ -300,6 +321,7 @@ namespace geode
 
     private:
         const SurfaceMesh3D& mesh_;
+        detail::MeshPoints3D points_;
         const Point3D& origin_;
         DEBUG_CONST OwnerSegment3D segment_;
         mutable std::vector< PolygonDistance > results_;
@@ -346,4 +368,145 @@ namespace geode
     {
         return impl_->compute( polygon_id );
     }
+
+    class RayPacketTracing3D::Impl
+    {
+        class ClosestIntersection
+        {
+        public:
+            ClosestIntersection( const Impl& impl,
+                absl::Span< const Ray3D > rays,
+                absl::Span< double > max_distances,
+                ClosestPolygons& result,
+                index_t first_ray )
+                : impl_( impl ),
+                  rays_( rays ),
+                  max_distances_( max_distances ),
+                  result_( result ),
+                  first_ray_( first_ray )
+            {
+            }
+
+            bool operator()( index_t ray_id, index_t polygon_id )
+            {
+                const auto& ray = rays_[ray_id];
+                auto& max_distance = max_distances_[ray_id];
+                const OwnerSegment3D segment{ ray.origin(),
+                    ray.origin() + ray.direction() * max_distance };
+                const auto& mesh = impl_.mesh_;
+                const auto& p0 = impl_.points_.point(
+                    mesh.polygon_vertex( { polygon_id, 0 } ) );
+                for( const auto e :
+                    LRange{ 1, mesh.nb_polygon_edges( polygon_id ) - 1 } )
+                {
+                    const auto edge_vertices =
+                        mesh.polygon_edge_vertices( { polygon_id, e } );
+                    const Triangle3D triangle{ p0,
+                        impl_.points_.point( edge_vertices.front() ),
+                        impl_.points_.point( edge_vertices.back() ) };
+                    const auto position =
+                        segment_triangle_intersection_detection(
+                            segment, triangle )
+                            .second;
+                    if( position == Position::outside )
+                    {
+                        continue;
+                    }
+                    const auto id = first_ray_ + ray_id;
+                    for( auto& point : segment_triangle_intersections(
+                             Segment3D{ segment }, triangle ) )
+                    {
+                        const auto distance =
+                            point_point_distance( ray.origin(), point );
+                        if( result_.polygons[id] != NO_ID
+                            && distance >= result_.distances[id] )
+                        {
+                            continue;
+                        }
+                        result_.polygons[id] = polygon_id;
+                        result_.distances[id] = distance;
+                        result_.positions[id] = position;
+                        result_.points[id] = std::move( point );
+                        max_distance = distance;
+                    }
+                    break;
+                }
+                // No intersection can be closer than the ray origin
+                return max_distance <= global_epsilon;
+            }
+
+        private:
+            const Impl& impl_;
+            absl::Span< const Ray3D > rays_;
+            absl::Span< double > max_distances_;
+            ClosestPolygons& result_;
+            index_t first_ray_;
+        };
+
+    public:
+        Impl( const SurfaceMesh3D& mesh, const AABBTree3D& aabb )
+            : mesh_( mesh ), points_( mesh ), aabb_( aabb )
+        {
+        }
+
+        ClosestPolygons closest_polygons( absl::Span< const Ray3D > rays ) const
+        {
+            const auto nb_rays = static_cast< index_t >( rays.size() );
+            ClosestPolygons result{ nb_rays };
+            std::vector< double > max_distances( nb_rays );
+            for( const auto r : Range{ nb_rays } )
+            {
+                auto bbox = aabb_.bounding_box();
+                bbox.add_point( rays[r].origin() );
+                max_distances[r] = bbox.diagonal().length();
+            }
+            const auto nb_chunks =
+                ( nb_rays + RAYS_CHUNK_SIZE - 1 ) / RAYS_CHUNK_SIZE;
+            async::parallel_for( async::irange( index_t{ 0 }, nb_chunks ),
+                [nb_rays, &rays, &max_distances, &result, this](
+                    index_t chunk ) {
+                    const auto begin = chunk * RAYS_CHUNK_SIZE;
+                    const auto size =
+                        std::min( RAYS_CHUNK_SIZE, nb_rays - begin );
+                    const auto chunk_rays = rays.subspan( begin, size );
+                    const auto chunk_distances =
+                        absl::MakeSpan( max_distances ).subspan( begin, size );
+                    ClosestIntersection action{ *this, chunk_rays,
+                        chunk_distances, result, begin };
+                    aabb_.compute_rays_element_bbox_intersections(
+                        chunk_rays, chunk_distances, action );
+                } );
+            return result;
+        }
+
+    private:
+        const SurfaceMesh3D& mesh_;
+        detail::MeshPoints3D points_;
+        const AABBTree3D& aabb_;
+    };
+
+    RayPacketTracing3D::ClosestPolygons::ClosestPolygons( index_t nb_rays )
+        : polygons( nb_rays, NO_ID ),
+          distances( nb_rays, 0 ),
+          positions( nb_rays, Position::outside ),
+          points( nb_rays )
+    {
+    }
+
+    RayPacketTracing3D::RayPacketTracing3D(
+        const SurfaceMesh3D& mesh, const AABBTree3D& aabb )
+        : impl_{ mesh, aabb }
+    {
+    }
+
+    RayPacketTracing3D::RayPacketTracing3D( RayPacketTracing3D&& ) = default;
+
+    RayPacketTracing3D::~RayPacketTracing3D() = default;
+
+    RayPacketTracing3D::ClosestPolygons
+        RayPacketTracing3D::closest_polygons(
+            absl::Span< const Ray3D > rays ) const
+    {
+        return impl_->closest_polygons( rays );
+    }
 } // namespace geode
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2019 - 2023 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/mesh/helpers/vertex_incidence.h>
+
+#include <atomic>
+#include <numeric>
+
+#include <absl/algorithm/container.h>
+#include <absl/container/fixed_array.h>
+
+#include <async++.h>
+
+namespace
+{
+    /*!
+     * Parallel counting sort of the element vertices by vertex.
+     * Elements are processed concurrently so each vertex incidence list is
+     * sorted afterwards to get a deterministic result.
+     * @param[in] nb_element_vertices Functor returning the number of vertices
+     * of an element
+     * @param[in] element_vertex Functor returning the ElementVertex and its
+     * mesh vertex for given element and local vertex indices
+     */
+    template < typename ElementVertex,
+        typename NbElementVertices,
+        typename ElementVertexFunctor >
+    void compute_incidence( geode::index_t nb_vertices,
+        geode::index_t nb_elements,
+        const NbElementVertices& nb_element_vertices,
+        const ElementVertexFunctor& element_vertex,
+        std::vector< geode::index_t >& offsets,
+        std::vector< ElementVertex >& element_vertices )
+    {
+        absl::FixedArray< std::atomic< geode::index_t > > counters(
+            nb_vertices );
+        async::parallel_for( async::irange( geode::index_t{ 0 }, nb_vertices ),
+            [&counters]( geode::index_t v ) {
+                counters[v].store( 0, std::memory_order_relaxed );
+            } );
+        async::parallel_for( async::irange( geode::index_t{ 0 }, nb_elements ),
+            [&counters, &nb_element_vertices, &element_vertex](
+                geode::index_t e ) {
+                for( const auto v : geode::LRange{ nb_element_vertices( e ) } )
+                {
+                    counters[element_vertex( e, v ).second].fetch_add(
+                        1, std::memory_order_relaxed );
+                }
+            } );
+
+        offsets.resize( nb_vertices + 1 );
+        offsets[0] = 0;
+        for( const auto v : geode::Range{ nb_vertices } )
+        {
+            offsets[v + 1] =
+                offsets[v] + counters[v].load( std::memory_order_relaxed );
+            counters[v].store( offsets[v], std::memory_order_relaxed );
+        }
+
+        element_vertices.resize( offsets.back() );
+        async::parallel_for( async::irange( geode::index_t{ 0 }, nb_elements ),
+            [&counters, &nb_element_vertices, &element_vertex,
+                &element_vertices]( geode::index_t e ) {
+                for( const auto v : geode::LRange{ nb_element_vertices( e ) } )
+                {
+                    const auto incidence = element_vertex( e, v );
+                    const auto position = counters[incidence.second].fetch_add(
+                        1, std::memory_order_relaxed );
+                    element_vertices[position] = incidence.first;
+                }
+            } );
+        async::parallel_for( async::irange( geode::index_t{ 0 }, nb_vertices ),
+            [&offsets, &element_vertices]( geode::index_t v ) {
+                std::sort( element_vertices.begin() + offsets[v],
+                    element_vertices.begin() + offsets[v + 1] );
+            } );
+    }
+} // namespace
+
+namespace geode
+{
+    template < index_t dimension >
+    SurfaceVertexIncidence< dimension >::SurfaceVertexIncidence(
+        const SurfaceMesh< dimension >& mesh )
+    {
+        compute_incidence(
+            mesh.nb_vertices(), mesh.nb_polygons(),
+            [&mesh]( index_t p ) {
+                return mesh.nb_polygon_vertices( p );
+            },
+            [&mesh]( index_t p, local_index_t v ) {
+                const PolygonVertex polygon_vertex{ p, v };
+                return std::make_pair(
+                    polygon_vertex, mesh.polygon_vertex( polygon_vertex ) );
+            },
+            offsets_, polygon_vertices_ );
+    }
+
+    template < index_t dimension >
+    SolidVertexIncidence< dimension >::SolidVertexIncidence(
+        const SolidMesh< dimension >& mesh )
+    {
+        compute_incidence(
+            mesh.nb_vertices(), mesh.nb_polyhedra(),
+            [&mesh]( index_t p ) {
+                return mesh.nb_polyhedron_vertices( p );
+            },
+            [&mesh]( index_t p, local_index_t v ) {
+                const PolyhedronVertex polyhedron_vertex{ p, v };
+                return std::make_pair( polyhedron_vertex,
+                    mesh.polyhedron_vertex( polyhedron_vertex ) );
+            },
+            offsets_, polyhedron_vertices_ );
+    }
+
+    template class opengeode_mesh_api SurfaceVertexIncidence< 2 >;
+    template class opengeode_mesh_api SurfaceVertexIncidence< 3 >;
+    template class opengeode_mesh_api SolidVertexIncidence< 3 >;
+} // namespace geode
@@ -23,69 +23,74 @@
 
 #include <geode/mesh/io/edged_curve_input.h>
 
-#include <absl/strings/ascii.h>
-
-#include <geode/basic/filename.h>
-#include <geode/basic/identifier_builder.h>
-#include <geode/basic/timer.h>
+#include <absl/strings/str_cat.h>
 
 #include <geode/mesh/core/edged_curve.h>
 #include <geode/mesh/core/mesh_factory.h>
+#include <geode/mesh/io/private/geode_mesh_input_impl.h>
 
 namespace geode
 {
     template < index_t dimension >
     std::unique_ptr< EdgedCurve< dimension > > load_edged_curve(
-        const MeshImpl& impl, absl::string_view filename )
+        const MeshImpl& impl,
+        absl::string_view filename,
+        const AttributeFilter& attribute_filter )
     {
-        try
-        {
-            Timer timer;
-            const auto extension =
-                absl::AsciiStrToLower( extension_from_filename( filename ) );
-            OPENGEODE_EXCEPTION(
-                EdgedCurveInputFactory< dimension >::has_creator( extension ),
-                "Unknown extension: ", extension );
-            auto input = EdgedCurveInputFactory< dimension >::create(
-                extension, filename );
-            auto edged_curve = input->read( impl );
-            if( edged_curve->name() == Identifier::DEFAULT_NAME )
-            {
-                IdentifierBuilder{ *edged_curve }.set_name(
-                    filename_without_extension( filename ) );
-            }
-            Logger::info( "EdgedCurve", dimension, "D loaded from ", filename,
-                " in ", timer.duration() );
-            Logger::info( "EdgedCurve", dimension,
-                "D has: ", edged_curve->nb_vertices(), " vertices, ",
-                edged_curve->nb_edges(), " edges" );
-            return edged_curve;
-        }
-        catch( const OpenGeodeException& e )
-        {
-            Logger::error( e.what() );
-            throw OpenGeodeException{ "Cannot load EdgedCurve from file: ",
-                filename };
-        }
+        auto edged_curve = detail::geode_mesh_input_impl<
+            EdgedCurve< dimension >, EdgedCurveInputFactory< dimension > >(
+            absl::StrCat( "EdgedCurve", dimension, "D" ), impl, filename,
+            attribute_filter );
+        Logger::info( "EdgedCurve", dimension,
+            "D has: ", edged_curve->nb_vertices(), " vertices, ",
+            edged_curve->nb_edges(), " edges" );
+        return edged_curve;
     }
 
     template < index_t dimension >
     std::unique_ptr< EdgedCurve< dimension > > load_edged_curve(
-        absl::string_view filename )
+        absl::string_view filename, const AttributeFilter& attribute_filter )
     {
         return load_edged_curve< dimension >(
             MeshFactory::default_impl(
                 EdgedCurve< dimension >::type_name_static() ),
-            filename );
+            filename, attribute_filter );
+    }
+
+    template < index_t dimension >
+    std::unique_ptr< EdgedCurve< dimension > > load_edged_curve(
+        absl::string_view filename )
+    {
+        return load_edged_curve< dimension >( filename, AttributeFilter{} );
+    }
+
+    template < index_t dimension >
+    std::unique_ptr< EdgedCurve< dimension > > load_edged_curve(
+        const MeshImpl& impl, absl::string_view filename )
+    {
+        return load_edged_curve< dimension >(
+            impl, filename, AttributeFilter{} );
     }
 
     template std::unique_ptr< EdgedCurve< 2 > > opengeode_mesh_api
         load_edged_curve( const MeshImpl&, absl::string_view );
+    template std::unique_ptr< EdgedCurve< 2 > > opengeode_mesh_api
+        load_edged_curve(
+            const MeshImpl&, absl::string_view, const AttributeFilter& );
     template std::unique_ptr< EdgedCurve< 3 > > opengeode_mesh_api
         load_edged_curve( const MeshImpl&, absl::string_view );
+    template std::unique_ptr< EdgedCurve< 3 > > opengeode_mesh_api
+        load_edged_curve(
+            const MeshImpl&, absl::string_view, const AttributeFilter& );
 
     template std::unique_ptr< EdgedCurve< 2 > >
         opengeode_mesh_api load_edged_curve( absl::string_view );
+    template std::unique_ptr< EdgedCurve< 2 > >
+        opengeode_mesh_api load_edged_curve(
+            absl::string_view, const AttributeFilter& );
     template std::unique_ptr< EdgedCurve< 3 > >
         opengeode_mesh_api load_edged_curve( absl::string_view );
+    template std::unique_ptr< EdgedCurve< 3 > >
+        opengeode_mesh_api load_edged_curve(
+            absl::string_view, const AttributeFilter& );
 } // namespace geode
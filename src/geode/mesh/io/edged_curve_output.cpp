@@ -31,14 +31,16 @@ namespace geode
 {
     template < index_t dimension >
     void save_edged_curve(
-        const EdgedCurve< dimension >& edged_curve, absl::string_view filename )
+        const EdgedCurve< dimension >& edged_curve,
+        absl::string_view filename,
+        const OutputOptions& options )
     {
         try
         {
             detail::geode_object_output_impl<
                 EdgedCurveOutputFactory< dimension > >(
                 absl::StrCat( "EdgedCurve", dimension, "D" ), edged_curve,
-                filename );
+                filename, options );
         }
         catch( const OpenGeodeException& e )
         {
@@ -48,8 +50,23 @@ namespace geode
         }
     }
 
+    template < index_t dimension >
+    void save_edged_curve(
+        const EdgedCurve< dimension >& edged_curve, absl::string_view filename )
+    {
+        save_edged_curve( edged_curve, filename, {} );
+    }
+
     template void opengeode_mesh_api save_edged_curve(
         const EdgedCurve< 2 >&, absl::string_view );
+    template void opengeode_mesh_api save_edged_curve(
+        const EdgedCurve< 2 >&,
+        absl::string_view,
+        const OutputOptions& );
     template void opengeode_mesh_api save_edged_curve(
         const EdgedCurve< 3 >&, absl::string_view );
+    template void opengeode_mesh_api save_edged_curve(
+        const EdgedCurve< 3 >&,
+        absl::string_view,
+        const OutputOptions& );
 } // namespace geode
@@ -23,51 +23,40 @@
 
 #include <geode/mesh/io/graph_input.h>
 
-#include <absl/strings/ascii.h>
-
-#include <geode/basic/filename.h>
-#include <geode/basic/identifier_builder.h>
-#include <geode/basic/timer.h>
-
 #include <geode/mesh/core/graph.h>
 #include <geode/mesh/core/mesh_factory.h>
+#include <geode/mesh/io/private/geode_mesh_input_impl.h>
 
 namespace geode
 {
     std::unique_ptr< Graph > load_graph(
-        const MeshImpl& impl, absl::string_view filename )
+        const MeshImpl& impl,
+        absl::string_view filename,
+        const AttributeFilter& attribute_filter )
     {
-        try
-        {
-            Timer timer;
-            const auto extension =
-                absl::AsciiStrToLower( extension_from_filename( filename ) );
-            OPENGEODE_EXCEPTION( GraphInputFactory::has_creator( extension ),
-                "Unknown extension: ", extension );
-            auto input = GraphInputFactory::create( extension, filename );
-            auto graph = input->read( impl );
-            if( graph->name() == Identifier::DEFAULT_NAME )
-            {
-                IdentifierBuilder{ *graph }.set_name(
-                    filename_without_extension( filename ) );
-            }
-            Logger::info(
-                "Graph loaded from ", filename, " in ", timer.duration() );
-            Logger::info( "Graph has: ", graph->nb_vertices(), " vertices, ",
-                graph->nb_edges(), " edges" );
-            return graph;
-        }
-        catch( const OpenGeodeException& e )
-        {
-            Logger::error( e.what() );
-            throw OpenGeodeException{ "Cannot load Graph from file: ",
-                filename };
-        }
+        auto graph = detail::geode_mesh_input_impl< Graph, GraphInputFactory >(
+            "Graph", impl, filename, attribute_filter );
+        Logger::info( "Graph has: ", graph->nb_vertices(), " vertices, ",
+            graph->nb_edges(), " edges" );
+        return graph;
     }
 
-    std::unique_ptr< Graph > load_graph( absl::string_view filename )
+    std::unique_ptr< Graph > load_graph(
+        absl::string_view filename, const AttributeFilter& attribute_filter )
     {
         return load_graph(
-            MeshFactory::default_impl( Graph::type_name_static() ), filename );
+            MeshFactory::default_impl( Graph::type_name_static() ), filename,
+            attribute_filter );
+    }
+
+    std::unique_ptr< Graph > load_graph( absl::string_view filename )
+    {
+        return load_graph( filename, AttributeFilter{} );
+    }
+
+    std::unique_ptr< Graph > load_graph(
+        const MeshImpl& impl, absl::string_view filename )
+    {
+        return load_graph( impl, filename, AttributeFilter{} );
     }
 } // namespace geode
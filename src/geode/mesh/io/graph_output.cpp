@@ -29,12 +29,14 @@
 
 namespace geode
 {
-    void save_graph( const Graph& graph, absl::string_view filename )
+    void save_graph( const Graph& graph,
+        absl::string_view filename,
+        const OutputOptions& options )
     {
         try
         {
             detail::geode_object_output_impl< GraphOutputFactory >(
-                "Graph", graph, filename );
+                "Graph", graph, filename, options );
         }
         catch( const OpenGeodeException& e )
         {
@@ -42,4 +44,9 @@ namespace geode
             throw OpenGeodeException{ "Cannot save Graph in file: ", filename };
         }
     }
+
+    void save_graph( const Graph& graph, absl::string_view filename )
+    {
+        save_graph( graph, filename, {} );
+    }
 } // namespace geode
@@ -23,65 +23,64 @@
 
 #include <geode/mesh/io/hybrid_solid_input.h>
 
-#include <absl/strings/ascii.h>
-
-#include <geode/basic/filename.h>
-#include <geode/basic/identifier_builder.h>
-#include <geode/basic/timer.h>
+#include <absl/strings/str_cat.h>
 
 #include <geode/mesh/core/hybrid_solid.h>
 #include <geode/mesh/core/mesh_factory.h>
+#include <geode/mesh/io/private/geode_mesh_input_impl.h>
 
 namespace geode
 {
     template < index_t dimension >
     std::unique_ptr< HybridSolid< dimension > > load_hybrid_solid(
-        const MeshImpl& impl, absl::string_view filename )
+        const MeshImpl& impl,
+        absl::string_view filename,
+        const AttributeFilter& attribute_filter )
     {
-        try
-        {
-            Timer timer;
-            const auto extension =
-                absl::AsciiStrToLower( extension_from_filename( filename ) );
-            OPENGEODE_EXCEPTION(
-                HybridSolidInputFactory< dimension >::has_creator( extension ),
-                "Unknown extension: ", extension );
-            auto input = HybridSolidInputFactory< dimension >::create(
-                extension, filename );
-            auto hybrid_solid = input->read( impl );
-            if( hybrid_solid->name() == Identifier::DEFAULT_NAME )
-            {
-                IdentifierBuilder{ *hybrid_solid }.set_name(
-                    filename_without_extension( filename ) );
-            }
-            Logger::info( "HybridSolid", dimension, "D loaded from ", filename,
-                " in ", timer.duration() );
-            Logger::info( "HybridSolid", dimension,
-                "D has: ", hybrid_solid->nb_vertices(), " vertices, ",
-                hybrid_solid->nb_polyhedra(), " polyhedra" );
-            return hybrid_solid;
-        }
-        catch( const OpenGeodeException& e )
-        {
-            Logger::error( e.what() );
-            throw OpenGeodeException{ "Cannot load HybridSolid from file: ",
-                filename };
-        }
+        auto hybrid_solid = detail::geode_mesh_input_impl<
+            HybridSolid< dimension >, HybridSolidInputFactory< dimension > >(
+            absl::StrCat( "HybridSolid", dimension, "D" ), impl, filename,
+            attribute_filter );
+        Logger::info( "HybridSolid", dimension,
+            "D has: ", hybrid_solid->nb_vertices(), " vertices, ",
+            hybrid_solid->nb_polyhedra(), " polyhedra" );
+        return hybrid_solid;
     }
 
     template < index_t dimension >
     std::unique_ptr< HybridSolid< dimension > > load_hybrid_solid(
-        absl::string_view filename )
+        absl::string_view filename, const AttributeFilter& attribute_filter )
     {
         return load_hybrid_solid< dimension >(
             MeshFactory::default_impl(
                 HybridSolid< dimension >::type_name_static() ),
-            filename );
+            filename, attribute_filter );
+    }
+
+    template < index_t dimension >
+    std::unique_ptr< HybridSolid< dimension > > load_hybrid_solid(
+        absl::string_view filename )
+    {
+        return load_hybrid_solid< dimension >( filename, AttributeFilter{} );
+    }
+
+    template < index_t dimension >
+    std::unique_ptr< HybridSolid< dimension > > load_hybrid_solid(
+        const MeshImpl& impl, absl::string_view filename )
+    {
+        return load_hybrid_solid< dimension >(
+            impl, filename, AttributeFilter{} );
     }
 
     template std::unique_ptr< HybridSolid< 3 > > opengeode_mesh_api
         load_hybrid_solid( const MeshImpl&, absl::string_view );
+    template std::unique_ptr< HybridSolid< 3 > > opengeode_mesh_api
+        load_hybrid_solid(
+            const MeshImpl&, absl::string_view, const AttributeFilter& );
 
     template std::unique_ptr< HybridSolid< 3 > >
         opengeode_mesh_api load_hybrid_solid( absl::string_view );
+    template std::unique_ptr< HybridSolid< 3 > >
+        opengeode_mesh_api load_hybrid_solid(
+            absl::string_view, const AttributeFilter& );
 } // namespace geode
@@ -31,14 +31,15 @@ namespace geode
 {
     template < index_t dimension >
     void save_hybrid_solid( const HybridSolid< dimension >& hybrid_solid,
-        absl::string_view filename )
+        absl::string_view filename,
+        const OutputOptions& options )
     {
         try
         {
             detail::geode_object_output_impl<
                 HybridSolidOutputFactory< dimension > >(
                 absl::StrCat( "HybridSolid", dimension, "D" ), hybrid_solid,
-                filename );
+                filename, options );
         }
         catch( const OpenGeodeException& e )
         {
@@ -48,6 +49,17 @@ namespace geode
         }
     }
 
+    template < index_t dimension >
+    void save_hybrid_solid( const HybridSolid< dimension >& hybrid_solid,
+        absl::string_view filename )
+    {
+        save_hybrid_solid( hybrid_solid, filename, {} );
+    }
+
     template void opengeode_mesh_api save_hybrid_solid(
         const HybridSolid< 3 >&, absl::string_view );
+    template void opengeode_mesh_api save_hybrid_solid(
+        const HybridSolid< 3 >&,
+        absl::string_view,
+        const OutputOptions& );
 } // namespace geode
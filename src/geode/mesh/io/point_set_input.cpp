@@ -23,68 +23,68 @@
 
 #include <geode/mesh/io/point_set_input.h>
 
-#include <absl/strings/ascii.h>
-
-#include <geode/basic/filename.h>
-#include <geode/basic/identifier_builder.h>
-#include <geode/basic/timer.h>
+#include <absl/strings/str_cat.h>
 
 #include <geode/mesh/core/mesh_factory.h>
 #include <geode/mesh/core/point_set.h>
+#include <geode/mesh/io/private/geode_mesh_input_impl.h>
 
 namespace geode
 {
     template < index_t dimension >
     std::unique_ptr< PointSet< dimension > > load_point_set(
-        const MeshImpl& impl, absl::string_view filename )
+        const MeshImpl& impl,
+        absl::string_view filename,
+        const AttributeFilter& attribute_filter )
     {
-        try
-        {
-            Timer timer;
-            const auto extension =
-                absl::AsciiStrToLower( extension_from_filename( filename ) );
-            OPENGEODE_EXCEPTION(
-                PointSetInputFactory< dimension >::has_creator( extension ),
-                "Unknown extension: ", extension );
-            auto input = PointSetInputFactory< dimension >::create(
-                extension, filename );
-            auto point_set = input->read( impl );
-            if( point_set->name() == Identifier::DEFAULT_NAME )
-            {
-                IdentifierBuilder{ *point_set }.set_name(
-                    filename_without_extension( filename ) );
-            }
-            Logger::info( "PointSet", dimension, "D loaded from ", filename,
-                " in ", timer.duration() );
-            Logger::info( "PointSet", dimension,
-                "D has: ", point_set->nb_vertices(), " vertices" );
-            return point_set;
-        }
-        catch( const OpenGeodeException& e )
-        {
-            Logger::error( e.what() );
-            throw OpenGeodeException{ "Cannot load PointSet from file: ",
-                filename };
-        }
+        auto point_set = detail::geode_mesh_input_impl<
+            PointSet< dimension >, PointSetInputFactory< dimension > >(
+            absl::StrCat( "PointSet", dimension, "D" ), impl, filename,
+            attribute_filter );
+        Logger::info( "PointSet", dimension,
+            "D has: ", point_set->nb_vertices(), " vertices" );
+        return point_set;
     }
 
     template < index_t dimension >
     std::unique_ptr< PointSet< dimension > > load_point_set(
-        absl::string_view filename )
+        absl::string_view filename, const AttributeFilter& attribute_filter )
     {
         return load_point_set< dimension >(
             MeshFactory::default_impl(
                 PointSet< dimension >::type_name_static() ),
-            filename );
+            filename, attribute_filter );
+    }
+
+    template < index_t dimension >
+    std::unique_ptr< PointSet< dimension > > load_point_set(
+        absl::string_view filename )
+    {
+        return load_point_set< dimension >( filename, AttributeFilter{} );
+    }
+
+    template < index_t dimension >
+    std::unique_ptr< PointSet< dimension > > load_point_set(
+        const MeshImpl& impl, absl::string_view filename )
+    {
+        return load_point_set< dimension >( impl, filename, AttributeFilter{} );
     }
 
     template std::unique_ptr< PointSet< 2 > > opengeode_mesh_api load_point_set(
         const MeshImpl&, absl::string_view );
+    template std::unique_ptr< PointSet< 2 > > opengeode_mesh_api load_point_set(
+        const MeshImpl&, absl::string_view, const AttributeFilter& );
     template std::unique_ptr< PointSet< 3 > > opengeode_mesh_api load_point_set(
         const MeshImpl&, absl::string_view );
+    template std::unique_ptr< PointSet< 3 > > opengeode_mesh_api load_point_set(
+        const MeshImpl&, absl::string_view, const AttributeFilter& );
 
     template std::unique_ptr< PointSet< 2 > > opengeode_mesh_api load_point_set(
         absl::string_view );
+    template std::unique_ptr< PointSet< 2 > > opengeode_mesh_api load_point_set(
+        absl::string_view, const AttributeFilter& );
     template std::unique_ptr< PointSet< 3 > > opengeode_mesh_api load_point_set(
         absl::string_view );
+    template std::unique_ptr< PointSet< 3 > > opengeode_mesh_api load_point_set(
+        absl::string_view, const AttributeFilter& );
 } // namespace geode
@@ -32,14 +32,16 @@ namespace geode
 {
     template < index_t dimension >
     void save_point_set(
-        const PointSet< dimension >& point_set, absl::string_view filename )
+        const PointSet< dimension >& point_set,
+        absl::string_view filename,
+        const OutputOptions& options )
     {
         try
         {
             detail::geode_object_output_impl<
                 PointSetOutputFactory< dimension > >(
                 absl::StrCat( "PointSet", dimension, "D" ), point_set,
-                filename );
+                filename, options );
         }
         catch( const OpenGeodeException& e )
         {
@@ -49,8 +51,23 @@ namespace geode
         }
     }
 
+    template < index_t dimension >
+    void save_point_set(
+        const PointSet< dimension >& point_set, absl::string_view filename )
+    {
+        save_point_set( point_set, filename, {} );
+    }
+
     template void opengeode_mesh_api save_point_set(
         const PointSet< 2 >&, absl::string_view );
+    template void opengeode_mesh_api save_point_set(
+        const PointSet< 2 >&,
+        absl::string_view,
+        const OutputOptions& );
     template void opengeode_mesh_api save_point_set(
         const PointSet< 3 >&, absl::string_view );
+    template void opengeode_mesh_api save_point_set(
+        const PointSet< 3 >&,
+        absl::string_view,
+        const OutputOptions& );
 } // namespace geode
@@ -23,71 +23,76 @@
 
 #include <geode/mesh/io/polygonal_surface_input.h>
 
-#include <absl/strings/ascii.h>
-
-#include <geode/basic/filename.h>
-#include <geode/basic/identifier_builder.h>
-#include <geode/basic/timer.h>
+#include <absl/strings/str_cat.h>
 
 #include <geode/mesh/core/mesh_factory.h>
 #include <geode/mesh/core/polygonal_surface.h>
+#include <geode/mesh/io/private/geode_mesh_input_impl.h>
 
 namespace geode
 {
     template < index_t dimension >
     std::unique_ptr< PolygonalSurface< dimension > > load_polygonal_surface(
-        const MeshImpl& impl, absl::string_view filename )
+        const MeshImpl& impl,
+        absl::string_view filename,
+        const AttributeFilter& attribute_filter )
     {
-        try
-        {
-            Timer timer;
-            const auto extension =
-                absl::AsciiStrToLower( extension_from_filename( filename ) );
-            OPENGEODE_EXCEPTION(
-                PolygonalSurfaceInputFactory< dimension >::has_creator(
-                    extension ),
-                "Unknown extension: ", extension );
-            auto input = PolygonalSurfaceInputFactory< dimension >::create(
-                extension, filename );
-            auto polygonal_surface = input->read( impl );
-            if( polygonal_surface->name() == Identifier::DEFAULT_NAME )
-            {
-                IdentifierBuilder{ *polygonal_surface }.set_name(
-                    filename_without_extension( filename ) );
-            }
-            Logger::info( "PolygonalSurface", dimension, "D loaded from ",
-                filename, " in ", timer.duration() );
-            Logger::info( "PolygonalSurface", dimension,
-                "D has: ", polygonal_surface->nb_vertices(), " vertices, ",
-                polygonal_surface->nb_polygons(), " polygons" );
-            return polygonal_surface;
-        }
-        catch( const OpenGeodeException& e )
-        {
-            Logger::error( e.what() );
-            throw OpenGeodeException{
-                "Cannot load PolygonalSurface from file: ", filename
-            };
-        }
+        auto polygonal_surface = detail::geode_mesh_input_impl<
+            PolygonalSurface< dimension >,
+            PolygonalSurfaceInputFactory< dimension > >(
+            absl::StrCat( "PolygonalSurface", dimension, "D" ), impl, filename,
+            attribute_filter );
+        Logger::info( "PolygonalSurface", dimension,
+            "D has: ", polygonal_surface->nb_vertices(), " vertices, ",
+            polygonal_surface->nb_polygons(), " polygons" );
+        return polygonal_surface;
     }
 
     template < index_t dimension >
     std::unique_ptr< PolygonalSurface< dimension > > load_polygonal_surface(
-        absl::string_view filename )
+        absl::string_view filename, const AttributeFilter& attribute_filter )
     {
         return load_polygonal_surface< dimension >(
             MeshFactory::default_impl(
                 PolygonalSurface< dimension >::type_name_static() ),
-            filename );
+            filename, attribute_filter );
+    }
+
+    template < index_t dimension >
+    std::unique_ptr< PolygonalSurface< dimension > > load_polygonal_surface(
+        absl::string_view filename )
+    {
+        return load_polygonal_surface< dimension >(
+            filename, AttributeFilter{} );
+    }
+
+    template < index_t dimension >
+    std::unique_ptr< PolygonalSurface< dimension > > load_polygonal_surface(
+        const MeshImpl& impl, absl::string_view filename )
+    {
+        return load_polygonal_surface< dimension >(
+            impl, filename, AttributeFilter{} );
     }
 
     template std::unique_ptr< PolygonalSurface< 2 > > opengeode_mesh_api
         load_polygonal_surface( const MeshImpl&, absl::string_view );
+    template std::unique_ptr< PolygonalSurface< 2 > > opengeode_mesh_api
+        load_polygonal_surface(
+            const MeshImpl&, absl::string_view, const AttributeFilter& );
     template std::unique_ptr< PolygonalSurface< 3 > > opengeode_mesh_api
         load_polygonal_surface( const MeshImpl&, absl::string_view );
+    template std::unique_ptr< PolygonalSurface< 3 > > opengeode_mesh_api
+        load_polygonal_surface(
+            const MeshImpl&, absl::string_view, const AttributeFilter& );
 
     template std::unique_ptr< PolygonalSurface< 2 > >
         opengeode_mesh_api load_polygonal_surface( absl::string_view );
+    template std::unique_ptr< PolygonalSurface< 2 > >
+        opengeode_mesh_api load_polygonal_surface(
+            absl::string_view, const AttributeFilter& );
     template std::unique_ptr< PolygonalSurface< 3 > >
         opengeode_mesh_api load_polygonal_surface( absl::string_view );
+    template std::unique_ptr< PolygonalSurface< 3 > >
+        opengeode_mesh_api load_polygonal_surface(
+            absl::string_view, const AttributeFilter& );
 } // namespace geode
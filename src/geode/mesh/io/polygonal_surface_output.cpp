@@ -32,14 +32,15 @@ namespace geode
     template < index_t dimension >
     void save_polygonal_surface(
         const PolygonalSurface< dimension >& polygonal_surface,
-        absl::string_view filename )
+        absl::string_view filename,
+        const OutputOptions& options )
     {
         try
         {
             detail::geode_object_output_impl<
                 PolygonalSurfaceOutputFactory< dimension > >(
                 absl::StrCat( "PolygonalSurface", dimension, "D" ),
-                polygonal_surface, filename );
+                polygonal_surface, filename, options );
         }
         catch( const OpenGeodeException& e )
         {
@@ -49,8 +50,24 @@ namespace geode
         }
     }
 
+    template < index_t dimension >
+    void save_polygonal_surface(
+        const PolygonalSurface< dimension >& polygonal_surface,
+        absl::string_view filename )
+    {
+        save_polygonal_surface( polygonal_surface, filename, {} );
+    }
+
     template void opengeode_mesh_api save_polygonal_surface(
         const PolygonalSurface< 2 >&, absl::string_view );
+    template void opengeode_mesh_api save_polygonal_surface(
+        const PolygonalSurface< 2 >&,
+        absl::string_view,
+        const OutputOptions& );
     template void opengeode_mesh_api save_polygonal_surface(
         const PolygonalSurface< 3 >&, absl::string_view );
+    template void opengeode_mesh_api save_polygonal_surface(
+        const PolygonalSurface< 3 >&,
+        absl::string_view,
+        const OutputOptions& );
 } // namespace geode
@@ -23,66 +23,66 @@
 
 #include <geode/mesh/io/polyhedral_solid_input.h>
 
-#include <absl/strings/ascii.h>
-
-#include <geode/basic/filename.h>
-#include <geode/basic/identifier_builder.h>
-#include <geode/basic/timer.h>
+#include <absl/strings/str_cat.h>
 
 #include <geode/mesh/core/mesh_factory.h>
 #include <geode/mesh/core/polyhedral_solid.h>
+#include <geode/mesh/io/private/geode_mesh_input_impl.h>
 
 namespace geode
 {
     template < index_t dimension >
     std::unique_ptr< PolyhedralSolid< dimension > > load_polyhedral_solid(
-        const MeshImpl& impl, absl::string_view filename )
+        const MeshImpl& impl,
+        absl::string_view filename,
+        const AttributeFilter& attribute_filter )
     {
-        try
-        {
-            Timer timer;
-            const auto extension =
-                absl::AsciiStrToLower( extension_from_filename( filename ) );
-            OPENGEODE_EXCEPTION(
-                PolyhedralSolidInputFactory< dimension >::has_creator(
-                    extension ),
-                "Unknown extension: ", extension );
-            auto input = PolyhedralSolidInputFactory< dimension >::create(
-                extension, filename );
-            auto polyhedral_solid = input->read( impl );
-            if( polyhedral_solid->name() == Identifier::DEFAULT_NAME )
-            {
-                IdentifierBuilder{ *polyhedral_solid }.set_name(
-                    filename_without_extension( filename ) );
-            }
-            Logger::info( "PolyhedralSolid", dimension, "D loaded from ",
-                filename, " in ", timer.duration() );
-            Logger::info( "PolyhedralSolid", dimension,
-                "D has: ", polyhedral_solid->nb_vertices(), " vertices, ",
-                polyhedral_solid->nb_polyhedra(), " polyhedra" );
-            return polyhedral_solid;
-        }
-        catch( const OpenGeodeException& e )
-        {
-            Logger::error( e.what() );
-            throw OpenGeodeException{ "Cannot load PolyhedralSolid from file: ",
-                filename };
-        }
+        auto polyhedral_solid = detail::geode_mesh_input_impl<
+            PolyhedralSolid< dimension >,
+            PolyhedralSolidInputFactory< dimension > >(
+            absl::StrCat( "PolyhedralSolid", dimension, "D" ), impl, filename,
+            attribute_filter );
+        Logger::info( "PolyhedralSolid", dimension,
+            "D has: ", polyhedral_solid->nb_vertices(), " vertices, ",
+            polyhedral_solid->nb_polyhedra(), " polyhedra" );
+        return polyhedral_solid;
     }
 
     template < index_t dimension >
     std::unique_ptr< PolyhedralSolid< dimension > > load_polyhedral_solid(
-        absl::string_view filename )
+        absl::string_view filename, const AttributeFilter& attribute_filter )
     {
         return load_polyhedral_solid< dimension >(
             MeshFactory::default_impl(
                 PolyhedralSolid< dimension >::type_name_static() ),
-            filename );
+            filename, attribute_filter );
+    }
+
+    template < index_t dimension >
+    std::unique_ptr< PolyhedralSolid< dimension > > load_polyhedral_solid(
+        absl::string_view filename )
+    {
+        return load_polyhedral_solid< dimension >(
+            filename, AttributeFilter{} );
+    }
+
+    template < index_t dimension >
+    std::unique_ptr< PolyhedralSolid< dimension > > load_polyhedral_solid(
+        const MeshImpl& impl, absl::string_view filename )
+    {
+        return load_polyhedral_solid< dimension >(
+            impl, filename, AttributeFilter{} );
     }
 
     template std::unique_ptr< PolyhedralSolid< 3 > > opengeode_mesh_api
         load_polyhedral_solid( const MeshImpl&, absl::string_view );
+    template std::unique_ptr< PolyhedralSolid< 3 > > opengeode_mesh_api
+        load_polyhedral_solid(
+            const MeshImpl&, absl::string_view, const AttributeFilter& );
 
     template std::unique_ptr< PolyhedralSolid< 3 > >
         opengeode_mesh_api load_polyhedral_solid( absl::string_view );
+    template std::unique_ptr< PolyhedralSolid< 3 > >
+        opengeode_mesh_api load_polyhedral_solid(
+            absl::string_view, const AttributeFilter& );
 } // namespace geode
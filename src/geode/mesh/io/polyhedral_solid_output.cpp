@@ -32,14 +32,15 @@ namespace geode
     template < index_t dimension >
     void save_polyhedral_solid(
         const PolyhedralSolid< dimension >& polyhedral_solid,
-        absl::string_view filename )
+        absl::string_view filename,
+        const OutputOptions& options )
     {
         try
         {
             detail::geode_object_output_impl<
                 PolyhedralSolidOutputFactory< dimension > >(
                 absl::StrCat( "PolyhedralSolid", dimension, "D" ),
-                polyhedral_solid, filename );
+                polyhedral_solid, filename, options );
         }
         catch( const OpenGeodeException& e )
         {
@@ -49,6 +50,18 @@ namespace geode
         }
     }
 
+    template < index_t dimension >
+    void save_polyhedral_solid(
+        const PolyhedralSolid< dimension >& polyhedral_solid,
+        absl::string_view filename )
+    {
+        save_polyhedral_solid( polyhedral_solid, filename, {} );
+    }
+
     template void opengeode_mesh_api save_polyhedral_solid(
         const PolyhedralSolid< 3 >&, absl::string_view );
+    template void opengeode_mesh_api save_polyhedral_solid(
+        const PolyhedralSolid< 3 >&,
+        absl::string_view,
+        const OutputOptions& );
 } // namespace geode
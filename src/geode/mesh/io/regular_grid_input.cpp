@@ -23,69 +23,74 @@
 
 #include <geode/mesh/io/regular_grid_input.h>
 
-#include <absl/strings/ascii.h>
-
-#include <geode/basic/filename.h>
-#include <geode/basic/identifier_builder.h>
-#include <geode/basic/timer.h>
+#include <absl/strings/str_cat.h>
 
 #include <geode/mesh/core/mesh_factory.h>
 #include <geode/mesh/core/regular_grid_solid.h>
 #include <geode/mesh/core/regular_grid_surface.h>
+#include <geode/mesh/io/private/geode_mesh_input_impl.h>
 
 namespace geode
 {
     template < index_t dimension >
     std::unique_ptr< RegularGrid< dimension > > load_regular_grid(
-        const MeshImpl& impl, absl::string_view filename )
+        const MeshImpl& impl,
+        absl::string_view filename,
+        const AttributeFilter& attribute_filter )
     {
-        try
-        {
-            Timer timer;
-            const auto extension =
-                absl::AsciiStrToLower( extension_from_filename( filename ) );
-            OPENGEODE_EXCEPTION(
-                RegularGridInputFactory< dimension >::has_creator( extension ),
-                "Unknown extension: ", extension );
-            auto input = RegularGridInputFactory< dimension >::create(
-                extension, filename );
-            auto grid = input->read( impl );
-            if( grid->name() == Identifier::DEFAULT_NAME )
-            {
-                IdentifierBuilder{ *grid }.set_name(
-                    filename_without_extension( filename ) );
-            }
-            Logger::info( "RegularGrid", dimension, "D loaded from ", filename,
-                " in ", timer.duration() );
-            Logger::info( "RegularGrid", dimension, "D has: ", grid->nb_cells(),
-                " cells" );
-            return grid;
-        }
-        catch( const OpenGeodeException& e )
-        {
-            Logger::error( e.what() );
-            throw OpenGeodeException{ "Cannot load RegularGrid from file: ",
-                filename };
-        }
+        auto grid = detail::geode_mesh_input_impl<
+            RegularGrid< dimension >, RegularGridInputFactory< dimension > >(
+            absl::StrCat( "RegularGrid", dimension, "D" ), impl, filename,
+            attribute_filter );
+        Logger::info( "RegularGrid", dimension, "D has: ", grid->nb_cells(),
+            " cells" );
+        return grid;
     }
 
     template < index_t dimension >
     std::unique_ptr< RegularGrid< dimension > > load_regular_grid(
-        absl::string_view filename )
+        absl::string_view filename, const AttributeFilter& attribute_filter )
     {
         return load_regular_grid< dimension >(
             MeshFactory::default_impl(
                 RegularGrid< dimension >::type_name_static() ),
-            filename );
+            filename, attribute_filter );
+    }
+
+    template < index_t dimension >
+    std::unique_ptr< RegularGrid< dimension > > load_regular_grid(
+        absl::string_view filename )
+    {
+        return load_regular_grid< dimension >( filename, AttributeFilter{} );
+    }
+
+    template < index_t dimension >
+    std::unique_ptr< RegularGrid< dimension > > load_regular_grid(
+        const MeshImpl& impl, absl::string_view filename )
+    {
+        return load_regular_grid< dimension >(
+            impl, filename, AttributeFilter{} );
     }
 
     template std::unique_ptr< RegularGrid< 2 > > opengeode_mesh_api
         load_regular_grid( const MeshImpl&, absl::string_view );
+    template std::unique_ptr< RegularGrid< 2 > > opengeode_mesh_api
+        load_regular_grid(
+            const MeshImpl&, absl::string_view, const AttributeFilter& );
     template std::unique_ptr< RegularGrid< 3 > > opengeode_mesh_api
         load_regular_grid( const MeshImpl&, absl::string_view );
+    template std::unique_ptr< RegularGrid< 3 > > opengeode_mesh_api
+        load_regular_grid(
+            const MeshImpl&, absl::string_view, const AttributeFilter& );
 
     template std::unique_ptr< RegularGrid< 2 > >
         opengeode_mesh_api load_regular_grid( absl::string_view );
+    template std::unique_ptr< RegularGrid< 2 > >
+        opengeode_mesh_api load_regular_grid(
+            absl::string_view, const AttributeFilter& );
     template std::unique_ptr< RegularGrid< 3 > >
         opengeode_mesh_api load_regular_grid( absl::string_view );
+    template std::unique_ptr< RegularGrid< 3 > >
+        opengeode_mesh_api load_regular_grid(
+            absl::string_view, const AttributeFilter& );
 } // namespace geode
@@ -32,14 +32,15 @@ namespace geode
 {
     template < index_t dimension >
     void save_regular_grid( const RegularGrid< dimension >& regular_grid,
-        absl::string_view filename )
+        absl::string_view filename,
+        const OutputOptions& options )
     {
         try
         {
             detail::geode_object_output_impl<
                 RegularGridOutputFactory< dimension > >(
                 absl::StrCat( "RegularGrid", dimension, "D" ), regular_grid,
-                filename );
+                filename, options );
         }
         catch( const OpenGeodeException& e )
         {
@@ -49,8 +50,23 @@ namespace geode
         }
     }
 
+    template < index_t dimension >
+    void save_regular_grid( const RegularGrid< dimension >& regular_grid,
+        absl::string_view filename )
+    {
+        save_regular_grid( regular_grid, filename, {} );
+    }
+
     template void opengeode_mesh_api save_regular_grid(
         const RegularGrid< 2 >&, absl::string_view );
+    template void opengeode_mesh_api save_regular_grid(
+        const RegularGrid< 2 >&,
+        absl::string_view,
+        const OutputOptions& );
     template void opengeode_mesh_api save_regular_grid(
         const RegularGrid< 3 >&, absl::string_view );
+    template void opengeode_mesh_api save_regular_grid(
+        const RegularGrid< 3 >&,
+        absl::string_view,
+        const OutputOptions& );
 } // namespace geode
@@ -23,67 +23,66 @@
 
 #include <geode/mesh/io/tetrahedral_solid_input.h>
 
-#include <absl/strings/ascii.h>
-
-#include <geode/basic/filename.h>
-#include <geode/basic/identifier_builder.h>
-#include <geode/basic/timer.h>
+#include <absl/strings/str_cat.h>
 
 #include <geode/mesh/core/mesh_factory.h>
 #include <geode/mesh/core/tetrahedral_solid.h>
+#include <geode/mesh/io/private/geode_mesh_input_impl.h>
 
 namespace geode
 {
     template < index_t dimension >
     std::unique_ptr< TetrahedralSolid< dimension > > load_tetrahedral_solid(
-        const MeshImpl& impl, absl::string_view filename )
+        const MeshImpl& impl,
+        absl::string_view filename,
+        const AttributeFilter& attribute_filter )
     {
-        try
-        {
-            Timer timer;
-            const auto extension =
-                absl::AsciiStrToLower( extension_from_filename( filename ) );
-            OPENGEODE_EXCEPTION(
-                TetrahedralSolidInputFactory< dimension >::has_creator(
-                    extension ),
-                "Unknown extension: ", extension );
-            auto input = TetrahedralSolidInputFactory< dimension >::create(
-                extension, filename );
-            auto tetrahedral_solid = input->read( impl );
-            if( tetrahedral_solid->name() == Identifier::DEFAULT_NAME )
-            {
-                IdentifierBuilder{ *tetrahedral_solid }.set_name(
-                    filename_without_extension( filename ) );
-            }
-            Logger::info( "TetrahedralSolid", dimension, "D loaded from ",
-                filename, " in ", timer.duration() );
-            Logger::info( "TetrahedralSolid", dimension,
-                "D has: ", tetrahedral_solid->nb_vertices(), " vertices, ",
-                tetrahedral_solid->nb_polyhedra(), " tetrahedra" );
-            return tetrahedral_solid;
-        }
-        catch( const OpenGeodeException& e )
-        {
-            Logger::error( e.what() );
-            throw OpenGeodeException{
-                "Cannot load TetrahedralSolid from file: ", filename
-            };
-        }
+        auto tetrahedral_solid = detail::geode_mesh_input_impl<
+            TetrahedralSolid< dimension >,
+            TetrahedralSolidInputFactory< dimension > >(
+            absl::StrCat( "TetrahedralSolid", dimension, "D" ), impl, filename,
+            attribute_filter );
+        Logger::info( "TetrahedralSolid", dimension,
+            "D has: ", tetrahedral_solid->nb_vertices(), " vertices, ",
+            tetrahedral_solid->nb_polyhedra(), " tetrahedra" );
+        return tetrahedral_solid;
     }
 
     template < index_t dimension >
     std::unique_ptr< TetrahedralSolid< dimension > > load_tetrahedral_solid(
-        absl::string_view filename )
+        absl::string_view filename, const AttributeFilter& attribute_filter )
     {
         return load_tetrahedral_solid< dimension >(
             MeshFactory::default_impl(
                 TetrahedralSolid< dimension >::type_name_static() ),
-            filename );
+            filename, attribute_filter );
+    }
+
+    template < index_t dimension >
+    std::unique_ptr< TetrahedralSolid< dimension > > load_tetrahedral_solid(
+        absl::string_view filename )
+    {
+        return load_tetrahedral_solid< dimension >(
+            filename, AttributeFilter{} );
+    }
+
+    template < index_t dimension >
+    std::unique_ptr< TetrahedralSolid< dimension > > load_tetrahedral_solid(
+        const MeshImpl& impl, absl::string_view filename )
+    {
+        return load_tetrahedral_solid< dimension >(
+            impl, filename, AttributeFilter{} );
     }
 
     template std::unique_ptr< TetrahedralSolid< 3 > > opengeode_mesh_api
         load_tetrahedral_solid( const MeshImpl&, absl::string_view );
+    template std::unique_ptr< TetrahedralSolid< 3 > > opengeode_mesh_api
+        load_tetrahedral_solid(
+            const MeshImpl&, absl::string_view, const AttributeFilter& );
 
     template std::unique_ptr< TetrahedralSolid< 3 > >
         opengeode_mesh_api load_tetrahedral_solid( absl::string_view );
+    template std::unique_ptr< TetrahedralSolid< 3 > >
+        opengeode_mesh_api load_tetrahedral_solid(
+            absl::string_view, const AttributeFilter& );
 } // namespace geode
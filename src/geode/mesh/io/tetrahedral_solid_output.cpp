@@ -32,14 +32,15 @@ namespace geode
     template < index_t dimension >
     void save_tetrahedral_solid(
         const TetrahedralSolid< dimension >& tetrahedral_solid,
-        absl::string_view filename )
+        absl::string_view filename,
+        const OutputOptions& options )
     {
         try
         {
             detail::geode_object_output_impl<
                 TetrahedralSolidOutputFactory< dimension > >(
                 absl::StrCat( "TetrahedralSolid", dimension, "D" ),
-                tetrahedral_solid, filename );
+                tetrahedral_solid, filename, options );
         }
         catch( const OpenGeodeException& e )
         {
@@ -49,6 +50,18 @@ namespace geode
         }
     }
 
+    template < index_t dimension >
+    void save_tetrahedral_solid(
+        const TetrahedralSolid< dimension >& tetrahedral_solid,
+        absl::string_view filename )
+    {
+        save_tetrahedral_solid( tetrahedral_solid, filename, {} );
+    }
+
     template void opengeode_mesh_api save_tetrahedral_solid(
         const TetrahedralSolid< 3 >&, absl::string_view );
+    template void opengeode_mesh_api save_tetrahedral_solid(
+        const TetrahedralSolid< 3 >&,
+        absl::string_view,
+        const OutputOptions& );
 } // namespace geode
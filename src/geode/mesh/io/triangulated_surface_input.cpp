@@ -23,72 +23,80 @@
 
 #include <geode/mesh/io/triangulated_surface_input.h>
 
-#include <absl/strings/ascii.h>
-
-#include <geode/basic/filename.h>
-#include <geode/basic/identifier_builder.h>
-#include <geode/basic/timer.h>
+#include <absl/strings/str_cat.h>
 
 #include <geode/mesh/core/mesh_factory.h>
 #include <geode/mesh/core/triangulated_surface.h>
+#include <geode/mesh/io/private/geode_mesh_input_impl.h>
 
 namespace geode
 {
     template < index_t dimension >
     std::unique_ptr< TriangulatedSurface< dimension > >
         load_triangulated_surface(
-            const MeshImpl& impl, absl::string_view filename )
+            const MeshImpl& impl,
+            absl::string_view filename,
+            const AttributeFilter& attribute_filter )
     {
-        try
-        {
-            Timer timer;
-            const auto extension =
-                absl::AsciiStrToLower( extension_from_filename( filename ) );
-            OPENGEODE_EXCEPTION(
-                TriangulatedSurfaceInputFactory< dimension >::has_creator(
-                    extension ),
-                "Unknown extension: ", extension );
-            auto input = TriangulatedSurfaceInputFactory< dimension >::create(
-                extension, filename );
-            auto triangulated_surface = input->read( impl );
-            if( triangulated_surface->name() == Identifier::DEFAULT_NAME )
-            {
-                IdentifierBuilder{ *triangulated_surface }.set_name(
-                    filename_without_extension( filename ) );
-            }
-            Logger::info( "TriangulatedSurface", dimension, "D loaded from ",
-                filename, " in ", timer.duration() );
-            Logger::info( "TriangulatedSurface", dimension,
-                "D has: ", triangulated_surface->nb_vertices(), " vertices, ",
-                triangulated_surface->nb_polygons(), " triangles" );
-            return triangulated_surface;
-        }
-        catch( const OpenGeodeException& e )
-        {
-            Logger::error( e.what() );
-            throw OpenGeodeException{
-                "Cannot load TriangulatedSurface from file: ", filename
-            };
-        }
+        auto triangulated_surface = detail::geode_mesh_input_impl<
+            TriangulatedSurface< dimension >,
+            TriangulatedSurfaceInputFactory< dimension > >(
+            absl::StrCat( "TriangulatedSurface", dimension, "D" ), impl,
+            filename, attribute_filter );
+        Logger::info( "TriangulatedSurface", dimension,
+            "D has: ", triangulated_surface->nb_vertices(), " vertices, ",
+            triangulated_surface->nb_polygons(), " triangles" );
+        return triangulated_surface;
     }
 
     template < index_t dimension >
     std::unique_ptr< TriangulatedSurface< dimension > >
-        load_triangulated_surface( absl::string_view filename )
+        load_triangulated_surface(
+            absl::string_view filename,
+            const AttributeFilter& attribute_filter )
     {
         return load_triangulated_surface< dimension >(
             MeshFactory::default_impl(
                 TriangulatedSurface< dimension >::type_name_static() ),
-            filename );
+            filename, attribute_filter );
+    }
+
+    template < index_t dimension >
+    std::unique_ptr< TriangulatedSurface< dimension > >
+        load_triangulated_surface( absl::string_view filename )
+    {
+        return load_triangulated_surface< dimension >(
+            filename, AttributeFilter{} );
+    }
+
+    template < index_t dimension >
+    std::unique_ptr< TriangulatedSurface< dimension > >
+        load_triangulated_surface(
+            const MeshImpl& impl, absl::string_view filename )
+    {
+        return load_triangulated_surface< dimension >(
+            impl, filename, AttributeFilter{} );
     }
 
     template std::unique_ptr< TriangulatedSurface< 2 > > opengeode_mesh_api
         load_triangulated_surface( const MeshImpl&, absl::string_view );
+    template std::unique_ptr< TriangulatedSurface< 2 > > opengeode_mesh_api
+        load_triangulated_surface(
+            const MeshImpl&, absl::string_view, const AttributeFilter& );
     template std::unique_ptr< TriangulatedSurface< 3 > > opengeode_mesh_api
         load_triangulated_surface( const MeshImpl&, absl::string_view );
+    template std::unique_ptr< TriangulatedSurface< 3 > > opengeode_mesh_api
+        load_triangulated_surface(
+            const MeshImpl&, absl::string_view, const AttributeFilter& );
 
     template std::unique_ptr< TriangulatedSurface< 2 > >
         opengeode_mesh_api load_triangulated_surface( absl::string_view );
+    template std::unique_ptr< TriangulatedSurface< 2 > >
+        opengeode_mesh_api load_triangulated_surface(
+            absl::string_view, const AttributeFilter& );
     template std::unique_ptr< TriangulatedSurface< 3 > >
         opengeode_mesh_api load_triangulated_surface( absl::string_view );
+    template std::unique_ptr< TriangulatedSurface< 3 > >
+        opengeode_mesh_api load_triangulated_surface(
+            absl::string_view, const AttributeFilter& );
 } // namespace geode
@@ -32,14 +32,15 @@ namespace geode
     template < index_t dimension >
     void save_triangulated_surface(
         const TriangulatedSurface< dimension >& triangulated_surface,
-        absl::string_view filename )
+        absl::string_view filename,
+        const OutputOptions& options )
     {
         try
         {
             detail::geode_object_output_impl<
                 TriangulatedSurfaceOutputFactory< dimension > >(
                 absl::StrCat( "TriangulatedSurface", dimension, "D" ),
-                triangulated_surface, filename );
+                triangulated_surface, filename, options );
         }
         catch( const OpenGeodeException& e )
         {
@@ -50,8 +51,24 @@ namespace geode
         }
     }
 
+    template < index_t dimension >
+    void save_triangulated_surface(
+        const TriangulatedSurface< dimension >& triangulated_surface,
+        absl::string_view filename )
+    {
+        save_triangulated_surface( triangulated_surface, filename, {} );
+    }
+
     template void opengeode_mesh_api save_triangulated_surface(
         const TriangulatedSurface< 2 >&, absl::string_view );
+    template void opengeode_mesh_api save_triangulated_surface(
+        const TriangulatedSurface< 2 >&,
+        absl::string_view,
+        const OutputOptions& );
     template void opengeode_mesh_api save_triangulated_surface(
         const TriangulatedSurface< 3 >&, absl::string_view );
+    template void opengeode_mesh_api save_triangulated_surface(
+        const TriangulatedSurface< 3 >&,
+        absl::string_view,
+        const OutputOptions& );
 } // namespace geode
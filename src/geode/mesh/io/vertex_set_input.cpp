@@ -23,53 +23,41 @@
 
 #include <geode/mesh/io/vertex_set_input.h>
 
-#include <absl/strings/ascii.h>
-
-#include <geode/basic/filename.h>
-#include <geode/basic/identifier_builder.h>
-#include <geode/basic/timer.h>
-
 #include <geode/mesh/core/mesh_factory.h>
 #include <geode/mesh/core/vertex_set.h>
+#include <geode/mesh/io/private/geode_mesh_input_impl.h>
 
 namespace geode
 {
-    std::unique_ptr< VertexSet > load_vertex_set( absl::string_view filename )
+    std::unique_ptr< VertexSet > load_vertex_set(
+        absl::string_view filename, const AttributeFilter& attribute_filter )
     {
         return load_vertex_set(
             MeshFactory::default_impl( VertexSet::type_name_static() ),
-            filename );
+            filename, attribute_filter );
+    }
+
+    std::unique_ptr< VertexSet > load_vertex_set( absl::string_view filename )
+    {
+        return load_vertex_set( filename, AttributeFilter{} );
     }
 
     std::unique_ptr< VertexSet > load_vertex_set(
         const MeshImpl& impl, absl::string_view filename )
     {
-        try
-        {
-            Timer timer;
-            const auto extension =
-                absl::AsciiStrToLower( extension_from_filename( filename ) );
-            OPENGEODE_EXCEPTION(
-                VertexSetInputFactory::has_creator( extension ),
-                "Unknown extension: ", extension );
-            auto input = VertexSetInputFactory::create( extension, filename );
-            auto vertex_set = input->read( impl );
-            if( vertex_set->name() == Identifier::DEFAULT_NAME )
-            {
-                IdentifierBuilder{ *vertex_set }.set_name(
-                    filename_without_extension( filename ) );
-            }
-            Logger::info(
-                "VertexSet loaded from ", filename, " in ", timer.duration() );
-            Logger::info(
-                "VertexSet has: ", vertex_set->nb_vertices(), " vertices" );
-            return vertex_set;
-        }
-        catch( const OpenGeodeException& e )
-        {
-            Logger::error( e.what() );
-            throw OpenGeodeException{ "Cannot load VertexSet from file: ",
-                filename };
-        }
+        return load_vertex_set( impl, filename, AttributeFilter{} );
+    }
+
+    std::unique_ptr< VertexSet > load_vertex_set(
+        const MeshImpl& impl,
+        absl::string_view filename,
+        const AttributeFilter& attribute_filter )
+    {
+        auto vertex_set = detail::geode_mesh_input_impl<
+            VertexSet, VertexSetInputFactory >(
+            "VertexSet", impl, filename, attribute_filter );
+        Logger::info(
+            "VertexSet has: ", vertex_set->nb_vertices(), " vertices" );
+        return vertex_set;
     }
 } // namespace geode
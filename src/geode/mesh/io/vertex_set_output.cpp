@@ -30,12 +30,14 @@
 namespace geode
 {
     void save_vertex_set(
-        const VertexSet& vertex_set, absl::string_view filename )
+        const VertexSet& vertex_set,
+        absl::string_view filename,
+        const OutputOptions& options )
     {
         try
         {
             detail::geode_object_output_impl< VertexSetOutputFactory >(
-                "VertexSet", vertex_set, filename );
+                "VertexSet", vertex_set, filename, options );
         }
         catch( const OpenGeodeException& e )
         {
@@ -44,4 +46,10 @@ namespace geode
                 filename };
         }
     }
+
+    void save_vertex_set(
+        const VertexSet& vertex_set, absl::string_view filename )
+    {
+        save_vertex_set( vertex_set, filename, {} );
+    }
 } // namespace geode
@@ -0,0 +1,308 @@
+/*
+ * Copyright (c) 2019 - 2023 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/model/helpers/brep_block_classifier.h>
+
+#include <memory>
+#include <vector>
+
+#include <async++.h>
+
+#include <absl/container/fixed_array.h>
+
+#include <geode/basic/logger.h>
+#include <geode/basic/pimpl_impl.h>
+#include <geode/basic/range.h>
+
+#include <geode/geometry/aabb.h>
+#include <geode/geometry/basic_objects/infinite_line.h>
+#include <geode/geometry/basic_objects/tetrahedron.h>
+#include <geode/geometry/bounding_box.h>
+#include <geode/geometry/information.h>
+#include <geode/geometry/points_sort.h>
+#include <geode/geometry/position.h>
+
+#include <geode/mesh/core/surface_mesh.h>
+#include <geode/mesh/core/tetrahedral_solid.h>
+#include <geode/mesh/helpers/aabb_solid_helpers.h>
+
+#include <geode/model/helpers/ray_tracing.h>
+#include <geode/model/mixin/core/block.h>
+#include <geode/model/mixin/core/surface.h>
+#include <geode/model/representation/core/brep.h>
+
+namespace
+{
+    constexpr geode::index_t QUERIES_CHUNK_SIZE{ 1024 };
+
+    /*
+     * Ray directions used for parity tests. They are not aligned with the
+     * axes to avoid grazing axis-aligned model features. Their number is odd
+     * so that a majority vote on their parities cannot be tied.
+     */
+    const std::array< geode::Vector3D, 5 >& ray_directions()
+    {
+        static const std::array< geode::Vector3D, 5 > directions{ {
+            geode::Vector3D{ { 0.5386, 0.6201, 0.5705 } },
+            geode::Vector3D{ { -0.7071, 0.3160, 0.6325 } },
+            geode::Vector3D{ { 0.2673, -0.8018, 0.5345 } },
+            geode::Vector3D{ { -0.4082, -0.4082, -0.8165 } },
+            geode::Vector3D{ { 0.8018, 0.2673, -0.5345 } },
+        } };
+        return directions;
+    }
+
+    bool is_tetrahedral_block( const geode::SolidMesh3D& mesh )
+    {
+        const auto* tetrahedral_mesh =
+            dynamic_cast< const geode::TetrahedralSolid3D* >( &mesh );
+        return tetrahedral_mesh && tetrahedral_mesh->nb_polyhedra() > 0;
+    }
+
+    geode::BoundingBox3D boundaries_bounding_box(
+        const geode::BRep& brep, const geode::Block3D& block )
+    {
+        geode::BoundingBox3D box;
+        for( const auto& surface : brep.boundaries( block ) )
+        {
+            box.add_box( surface.mesh().bounding_box() );
+        }
+        return box;
+    }
+} // namespace
+
+namespace geode
+{
+    class BRepBlockClassifier::Impl
+    {
+    public:
+        Impl( const BRep& brep )
+            : blocks_( brep.nb_blocks() ),
+              block_meshes_( brep.nb_blocks() ),
+              is_tetrahedral_( brep.nb_blocks() ),
+              tetrahedra_trees_( brep.nb_blocks() )
+        {
+            index_t id{ 0 };
+            bool needs_ray_tracer{ false };
+            for( const auto& block : brep.blocks() )
+            {
+                blocks_[id] = &block;
+                block_meshes_[id] = block.pinned_mesh();
+                is_tetrahedral_[id] =
+                    is_tetrahedral_block( *block_meshes_[id] );
+                needs_ray_tracer = needs_ray_tracer || !is_tetrahedral_[id];
+                id++;
+            }
+            if( needs_ray_tracer )
+            {
+                ray_tracer_.reset( new BRepRayTracer{ brep } );
+            }
+            std::vector< async::task< void > > tasks;
+            tasks.reserve( brep.nb_blocks() );
+            for( const auto b : Indices{ blocks_ } )
+            {
+                if( is_tetrahedral_[b] )
+                {
+                    tasks.emplace_back( async::spawn( [b, this] {
+                        tetrahedra_trees_[b] =
+                            create_aabb_tree( *block_meshes_[b] );
+                    } ) );
+                }
+            }
+            for( auto& task : async::when_all( tasks ).get() )
+            {
+                task.get();
+            }
+            absl::FixedArray< BoundingBox3D > boxes( brep.nb_blocks() );
+            for( const auto b : Indices{ blocks_ } )
+            {
+                boxes[b] = is_tetrahedral_[b]
+                               ? tetrahedra_trees_[b].bounding_box()
+                               : boundaries_bounding_box( brep, *blocks_[b] );
+            }
+            blocks_tree_ = AABBTree3D{ boxes };
+        }
+
+        index_t nb_blocks() const
+        {
+            return blocks_.size();
+        }
+
+        const uuid& block_id( index_t block_index ) const
+        {
+            return blocks_[block_index]->id();
+        }
+
+        index_t block_index( const Point3D& point ) const
+        {
+            for( const auto block : blocks_tree_.containing_boxes( point ) )
+            {
+                if( block_contains( block, point ) )
+                {
+                    return block;
+                }
+            }
+            return NO_ID;
+        }
+
+        std::vector< index_t > block_indices(
+            absl::Span< const Point3D > points ) const
+        {
+            std::vector< index_t > result( points.size(), NO_ID );
+            const auto order = morton_mapping< 3 >( points );
+            const auto nb_points = static_cast< index_t >( points.size() );
+            const auto nb_chunks =
+                ( nb_points + QUERIES_CHUNK_SIZE - 1 ) / QUERIES_CHUNK_SIZE;
+            async::parallel_for( async::irange( index_t{ 0 }, nb_chunks ),
+                [nb_points, &points, &order, &result, this]( index_t chunk ) {
+                    const auto begin = chunk * QUERIES_CHUNK_SIZE;
+                    const auto end = std::min< index_t >(
+                        begin + QUERIES_CHUNK_SIZE, nb_points );
+                    for( const auto i : Range{ begin, end } )
+                    {
+                        const auto query = order[i];
+                        result[query] = block_index( points[query] );
+                    }
+                } );
+            return result;
+        }
+
+    private:
+        bool block_contains( index_t block, const Point3D& point ) const
+        {
+            if( is_tetrahedral_[block] )
+            {
+                return tetrahedra_contain( block, point );
+            }
+            return boundaries_contain( block, point );
+        }
+
+        bool tetrahedra_contain( index_t block, const Point3D& point ) const
+        {
+            const auto& mesh = static_cast< const TetrahedralSolid3D& >(
+                *block_meshes_[block] );
+            for( const auto tetrahedron :
+                tetrahedra_trees_[block].containing_boxes( point ) )
+            {
+                if( point_tetrahedron_position(
+                        point, mesh.tetrahedron( tetrahedron ) )
+                    != Position::outside )
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /*
+         * Counts the boundary crossings of a ray starting at the point.
+         * A ray hitting a boundary on a polygon edge or vertex may count a
+         * single crossing twice (on two Surfaces) or miss it: such rays are
+         * discarded and cast again in another direction. If every ray is
+         * degenerated, the majority of their parities is used.
+         */
+        bool boundaries_contain( index_t block, const Point3D& point ) const
+        {
+            index_t nb_inside_votes{ 0 };
+            for( const auto& direction : ray_directions() )
+            {
+                const Ray3D ray{ direction, point };
+                const auto intersections =
+                    ray_tracer_->find_intersections_with_boundaries(
+                        ray, *blocks_[block] );
+                index_t nb_crossings{ 0 };
+                bool is_degenerated{ false };
+                for( const auto& surface_intersections : intersections )
+                {
+                    for( const auto& intersection :
+                        surface_intersections.second )
+                    {
+                        if( std::fabs( intersection.distance )
+                            <= global_epsilon )
+                        {
+                            return true;
+                        }
+                        if( intersection.position != Position::inside )
+                        {
+                            is_degenerated = true;
+                        }
+                        nb_crossings++;
+                    }
+                }
+                const auto is_inside = nb_crossings % 2 == 1;
+                if( !is_degenerated )
+                {
+                    return is_inside;
+                }
+                if( is_inside )
+                {
+                    nb_inside_votes++;
+                }
+            }
+            Logger::debug( "[BRepBlockClassifier] Every ray from ",
+                point.string(), " hits an edge or a vertex of Block ",
+                blocks_[block]->id().string(),
+                " boundaries, using a majority vote" );
+            return 2 * nb_inside_votes > ray_directions().size();
+        }
+
+    private:
+        absl::FixedArray< const Block3D* > blocks_;
+        absl::FixedArray< std::shared_ptr< const SolidMesh3D > > block_meshes_;
+        absl::FixedArray< bool > is_tetrahedral_;
+        absl::FixedArray< AABBTree3D > tetrahedra_trees_;
+        AABBTree3D blocks_tree_;
+        std::unique_ptr< BRepRayTracer > ray_tracer_;
+    };
+
+    BRepBlockClassifier::BRepBlockClassifier( const BRep& brep )
+        : impl_{ brep }
+    {
+    }
+
+    BRepBlockClassifier::BRepBlockClassifier( BRepBlockClassifier&& ) =
+        default;
+
+    BRepBlockClassifier::~BRepBlockClassifier() = default;
+
+    index_t BRepBlockClassifier::nb_blocks() const
+    {
+        return impl_->nb_blocks();
+    }
+
+    const uuid& BRepBlockClassifier::block_id( index_t block_index ) const
+    {
+        return impl_->block_id( block_index );
+    }
+
+    index_t BRepBlockClassifier::block_index( const Point3D& point ) const
+    {
+        return impl_->block_index( point );
+    }
+
+    std::vector< index_t > BRepBlockClassifier::block_indices(
+        absl::Span< const Point3D > points ) const
+    {
+        return impl_->block_indices( points );
+    }
+} // namespace geode
@@ -525,9 +525,10 @@ namespace
         const geode::ComponentType& type )
     {
         return geode::component_mesh_vertex_triplets(
-            model.component_mesh_vertices( polygon_unique_vertices[0] ),
-            model.component_mesh_vertices( polygon_unique_vertices[1] ),
-            model.component_mesh_vertices( polygon_unique_vertices[2] ), type );
+            model.component_mesh_vertices( polygon_unique_vertices[0], type ),
+            model.component_mesh_vertices( polygon_unique_vertices[1], type ),
+            model.component_mesh_vertices( polygon_unique_vertices[2], type ),
+            type );
     }
 
     geode::BRepComponentMeshPolygons::SurfacePolygons surface_polygons(
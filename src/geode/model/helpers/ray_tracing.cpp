@@ -23,6 +23,11 @@
 
 #include <geode/model/helpers/ray_tracing.h>
 
+#include <async++.h>
+
+#include <geode/basic/pimpl_impl.h>
+#include <geode/basic/range.h>
+
 #include <geode/geometry/aabb.h>
 
 #include <geode/mesh/core/surface_mesh.h>
@@ -32,8 +37,170 @@
 #include <geode/model/mixin/core/surface.h>
 #include <geode/model/representation/core/brep.h>
 
+namespace
+{
+    void compute_intersections( const geode::AABBTree3D& aabb,
+        const geode::InfiniteLine3D& infinite_line,
+        geode::RayTracing3D& ray_tracing )
+    {
+        aabb.compute_line_element_bbox_intersections(
+            infinite_line, ray_tracing );
+    }
+
+    void compute_intersections( const geode::AABBTree3D& aabb,
+        const geode::Ray3D& ray,
+        geode::RayTracing3D& ray_tracing )
+    {
+        aabb.compute_ray_element_bbox_intersections( ray, ray_tracing );
+    }
+} // namespace
+
 namespace geode
 {
+    class BRepRayTracer::Impl
+    {
+        struct BoundarySurface
+        {
+            BoundarySurface( const Surface3D& surface_in,
+                const SurfaceMesh3D& mesh_in,
+                const AABBTree3D& aabb_in )
+                : surface( surface_in ), mesh( mesh_in ), aabb( aabb_in )
+            {
+            }
+
+            const Surface3D& surface;
+            const SurfaceMesh3D& mesh;
+            const AABBTree3D& aabb;
+        };
+
+    public:
+        Impl( const BRep& brep )
+            : brep_( brep ),
+              meshes_( brep.nb_surfaces() ),
+              trees_( brep.nb_surfaces() )
+        {
+            // Meshes are all pinned before any task is spawned, so that no
+            // task is left running if pinning a mesh throws.
+            index_t id{ 0 };
+            for( const auto& surface : brep.surfaces() )
+            {
+                meshes_[id] = surface.pinned_mesh();
+                tree_ids_.emplace( meshes_[id]->id(), id );
+                id++;
+            }
+            absl::FixedArray< async::task< void > > tasks(
+                brep.nb_surfaces() );
+            for( const auto s : Indices{ meshes_ } )
+            {
+                tasks[s] = async::spawn( [s, this] {
+                    trees_[s] = create_aabb_tree( *meshes_[s] );
+                } );
+            }
+            for( auto& task : async::when_all( tasks ).get() )
+            {
+                task.get();
+            }
+        }
+
+        template < typename Line >
+        BoundarySurfaceIntersections intersections(
+            const Line& line, const Block3D& block ) const
+        {
+            return boundaries_intersections( line, boundary_surfaces( block ) );
+        }
+
+        template < typename Line >
+        std::vector< BoundarySurfaceIntersections > intersections(
+            absl::Span< const Line > lines, const Block3D& block ) const
+        {
+            const auto boundaries = boundary_surfaces( block );
+            std::vector< BoundarySurfaceIntersections > result(
+                lines.size() );
+            async::parallel_for( async::irange( size_t{ 0 }, lines.size() ),
+                [&lines, &boundaries, &result, this]( size_t l ) {
+                    result[l] =
+                        boundaries_intersections( lines[l], boundaries );
+                } );
+            return result;
+        }
+
+    private:
+        std::vector< BoundarySurface > boundary_surfaces(
+            const Block3D& block ) const
+        {
+            std::vector< BoundarySurface > boundaries;
+            for( const auto& surface : brep_.boundaries( block ) )
+            {
+                const auto tree_id = tree_ids_.find( surface.mesh().id() );
+                OPENGEODE_EXCEPTION( tree_id != tree_ids_.end(),
+                    "[BRepRayTracer] Cannot find the AABBTree of Surface ",
+                    surface.id().string(),
+                    ", the BRep has been modified since the BRepRayTracer "
+                    "construction" );
+                boundaries.emplace_back( surface, *meshes_[tree_id->second],
+                    trees_[tree_id->second] );
+            }
+            return boundaries;
+        }
+
+        template < typename Line >
+        BoundarySurfaceIntersections boundaries_intersections(
+            const Line& line,
+            absl::Span< const BoundarySurface > boundaries ) const
+        {
+            BoundarySurfaceIntersections result;
+            for( const auto& boundary : boundaries )
+            {
+                RayTracing3D ray_tracing{ boundary.mesh, line };
+                compute_intersections( boundary.aabb, line, ray_tracing );
+                result[boundary.surface.id()] =
+                    ray_tracing.all_intersections();
+            }
+            return result;
+        }
+
+    private:
+        const BRep& brep_;
+        absl::FixedArray< std::shared_ptr< const SurfaceMesh3D > > meshes_;
+        absl::FixedArray< AABBTree3D > trees_;
+        absl::flat_hash_map< uuid, index_t > tree_ids_;
+    };
+
+    BRepRayTracer::BRepRayTracer( const BRep& brep ) : impl_{ brep } {}
+
+    BRepRayTracer::BRepRayTracer( BRepRayTracer&& ) = default;
+
+    BRepRayTracer::~BRepRayTracer() = default;
+
+    BoundarySurfaceIntersections
+        BRepRayTracer::find_intersections_with_boundaries(
+            const InfiniteLine3D& infinite_line, const Block3D& block ) const
+    {
+        return impl_->intersections( infinite_line, block );
+    }
+
+    BoundarySurfaceIntersections
+        BRepRayTracer::find_intersections_with_boundaries(
+            const Ray3D& ray, const Block3D& block ) const
+    {
+        return impl_->intersections( ray, block );
+    }
+
+    std::vector< BoundarySurfaceIntersections >
+        BRepRayTracer::find_intersections_with_boundaries(
+            absl::Span< const InfiniteLine3D > infinite_lines,
+            const Block3D& block ) const
+    {
+        return impl_->intersections( infinite_lines, block );
+    }
+
+    std::vector< BoundarySurfaceIntersections >
+        BRepRayTracer::find_intersections_with_boundaries(
+            absl::Span< const Ray3D > rays, const Block3D& block ) const
+    {
+        return impl_->intersections( rays, block );
+    }
+
     BoundarySurfaceIntersections find_intersections_with_boundaries(
         const InfiniteLine3D& infinite_line,
         const BRep& brep,
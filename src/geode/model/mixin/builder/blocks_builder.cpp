@@ -56,6 +56,13 @@ namespace geode
         return blocks_.load_blocks( directory );
     }
 
+    template < index_t dimension >
+    void BlocksBuilder< dimension >::load_blocks( absl::string_view directory,
+        std::shared_ptr< detail::LazyMeshArchive > archive )
+    {
+        return blocks_.load_blocks( directory, std::move( archive ) );
+    }
+
     template < index_t dimension >
     void BlocksBuilder< dimension >::set_block_name(
         const uuid& id, absl::string_view name )
@@ -58,6 +58,13 @@ namespace geode
         return corners_.load_corners( directory );
     }
 
+    template < index_t dimension >
+    void CornersBuilder< dimension >::load_corners( absl::string_view directory,
+        std::shared_ptr< detail::LazyMeshArchive > archive )
+    {
+        return corners_.load_corners( directory, std::move( archive ) );
+    }
+
     template < index_t dimension >
     std::unique_ptr< PointSetBuilder< dimension > >
         CornersBuilder< dimension >::corner_mesh_builder( const uuid& id )
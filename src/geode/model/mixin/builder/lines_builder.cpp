@@ -55,6 +55,13 @@ namespace geode
         return lines_.load_lines( directory );
     }
 
+    template < index_t dimension >
+    void LinesBuilder< dimension >::load_lines( absl::string_view directory,
+        std::shared_ptr< detail::LazyMeshArchive > archive )
+    {
+        return lines_.load_lines( directory, std::move( archive ) );
+    }
+
     template < index_t dimension >
     std::unique_ptr< EdgedCurveBuilder< dimension > >
         LinesBuilder< dimension >::line_mesh_builder( const uuid& id )
@@ -58,6 +58,14 @@ namespace geode
         return surfaces_.load_surfaces( directory );
     }
 
+    template < index_t dimension >
+    void SurfacesBuilder< dimension >::load_surfaces(
+        absl::string_view directory,
+        std::shared_ptr< detail::LazyMeshArchive > archive )
+    {
+        return surfaces_.load_surfaces( directory, std::move( archive ) );
+    }
+
     template < index_t dimension >
     void SurfacesBuilder< dimension >::set_surface_name(
         const uuid& id, absl::string_view name )
@@ -88,6 +88,13 @@ namespace geode
         return impl_->modifiable_mesh();
     }
 
+    template < index_t dimension >
+    std::shared_ptr< const SolidMesh< dimension > >
+        Block< dimension >::pinned_mesh() const
+    {
+        return impl_->pinned_mesh();
+    }
+
     template < index_t dimension >
     const MeshImpl& Block< dimension >::mesh_type() const
     {
@@ -123,6 +130,15 @@ namespace geode
         impl_->set_mesh( this->id(), std::move( mesh ) );
     }
 
+    template < index_t dimension >
+    void Block< dimension >::set_mesh_loader( MeshLoader loader,
+        std::shared_ptr< detail::LazyMeshArchive > archive,
+        BlocksKey )
+    {
+        impl_->set_mesh_loader(
+            this->id(), std::move( loader ), std::move( archive ) );
+    }
+
     template < index_t dimension >
     void Block< dimension >::set_mesh(
         std::unique_ptr< SolidMesh< dimension > > mesh, BlocksBuilderKey )
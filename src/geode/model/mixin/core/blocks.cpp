@@ -27,7 +27,11 @@
 
 #include <geode/basic/pimpl_impl.h>
 #include <geode/basic/range.h>
+#include <geode/basic/zip_file.h>
 
+#include <geode/mesh/core/geode/geode_hybrid_solid.h>
+#include <geode/mesh/core/geode/geode_polyhedral_solid.h>
+#include <geode/mesh/core/geode/geode_tetrahedral_solid.h>
 #include <geode/mesh/core/hybrid_solid.h>
 #include <geode/mesh/core/mesh_factory.h>
 #include <geode/mesh/core/polyhedral_solid.h>
@@ -41,6 +45,38 @@
 
 #include <geode/model/mixin/core/block.h>
 #include <geode/model/mixin/core/detail/components_storage.h>
+#include <geode/model/mixin/core/detail/lazy_mesh_archive.h>
+#include <geode/model/mixin/core/detail/mesh_storage.h>
+
+namespace
+{
+    template < geode::index_t dimension >
+    void save_block_mesh(
+        const geode::SolidMesh< dimension >& mesh, absl::string_view file )
+    {
+        if( const auto* tetra = dynamic_cast<
+                const geode::TetrahedralSolid< dimension >* >( &mesh ) )
+        {
+            geode::save_tetrahedral_solid( *tetra, file );
+        }
+        else if( const auto* hybrid = dynamic_cast<
+                     const geode::HybridSolid< dimension >* >( &mesh ) )
+        {
+            geode::save_hybrid_solid( *hybrid, file );
+        }
+        else if( const auto* poly = dynamic_cast<
+                     const geode::PolyhedralSolid< dimension >* >( &mesh ) )
+        {
+            geode::save_polyhedral_solid( *poly, file );
+        }
+        else
+        {
+            throw geode::OpenGeodeException( "[Blocks::save_blocks] Cannot "
+                                             "find the explicit SolidMesh "
+                                             "type" );
+        }
+    }
+} // namespace
 
 namespace geode
 {
@@ -110,33 +146,54 @@ namespace geode
         for( const auto& block : blocks() )
         {
             tasks[count++] = async::spawn( [&block, &prefix] {
-                const auto& mesh = block.mesh();
+                const auto pinned_mesh = block.pinned_mesh();
+                const auto& mesh = *pinned_mesh;
                 const auto file = absl::StrCat(
                     prefix, block.id().string(), ".", mesh.native_extension() );
+                save_block_mesh( mesh, file );
+            } );
+        }
+        auto all_tasks = async::when_all( tasks );
+        all_tasks.wait();
+        Logger::set_level( level );
+        for( auto& task : all_tasks.get() )
+        {
+            task.get();
+        }
+    }
 
-                if( const auto* tetra =
-                        dynamic_cast< const TetrahedralSolid< dimension >* >(
-                            &mesh ) )
-                {
-                    save_tetrahedral_solid( *tetra, file );
-                }
-                else if( const auto* hybrid =
-                             dynamic_cast< const HybridSolid< dimension >* >(
-                                 &mesh ) )
-                {
-                    save_hybrid_solid( *hybrid, file );
-                }
-                else if( const auto* poly = dynamic_cast<
-                             const PolyhedralSolid< dimension >* >( &mesh ) )
-                {
-                    save_polyhedral_solid( *poly, file );
-                }
-                else
+    template < index_t dimension >
+    void Blocks< dimension >::save_blocks( const ZipFile& zip_writer ) const
+    {
+        impl_->save_components( zip_writer, "blocks" );
+        const auto prefix = Block< dimension >::component_type_static().get();
+        const auto level = Logger::level();
+        Logger::set_level( Logger::Level::warn );
+        absl::FixedArray< async::task< void > > tasks( nb_blocks() );
+        index_t count{ 0 };
+        for( const auto& block : blocks() )
+        {
+            tasks[count++] = async::spawn( [&block, &prefix, &zip_writer] {
+                const auto pinned_mesh = block.pinned_mesh();
+                const auto& mesh = *pinned_mesh;
+                const auto entry = absl::StrCat(
+                    prefix, block.id().string(), ".", mesh.native_extension() );
+                if( detail::archive_native_mesh<
+                        OpenGeodeTetrahedralSolid< dimension > >(
+                        zip_writer, entry, mesh )
+                    || detail::archive_native_mesh<
+                        OpenGeodeHybridSolid< dimension > >(
+                        zip_writer, entry, mesh )
+                    || detail::archive_native_mesh<
+                        OpenGeodePolyhedralSolid< dimension > >(
+                        zip_writer, entry, mesh ) )
                 {
-                    throw OpenGeodeException(
-                        "[Blocks::save_blocks] Cannot find the explicit "
-                        "SolidMesh type" );
+                    return;
                 }
+                const auto file =
+                    absl::StrCat( zip_writer.directory(), "/", entry );
+                save_block_mesh( mesh, file );
+                zip_writer.archive_file( file );
             } );
         }
         auto all_tasks = async::when_all( tasks );
@@ -192,6 +249,44 @@ namespace geode
         }
     }
 
+    template < index_t dimension >
+    void Blocks< dimension >::load_blocks( absl::string_view directory,
+        std::shared_ptr< detail::LazyMeshArchive > archive )
+    {
+        impl_->load_components( absl::StrCat( directory, "/blocks" ) );
+        for( auto& block : modifiable_blocks() )
+        {
+            const auto entry = archive->mesh_entry( block.id() );
+            const auto impl = block.mesh_type();
+            if( MeshFactory::type( impl )
+                == TetrahedralSolid< dimension >::type_name_static() )
+            {
+                block.set_mesh_loader(
+                    detail::archived_mesh_loader< SolidMesh< dimension >,
+                        OpenGeodeTetrahedralSolid< dimension > >( archive,
+                        entry, impl, load_tetrahedral_solid< dimension > ),
+                    archive, typename Block< dimension >::BlocksKey{} );
+            }
+            else if( MeshFactory::type( impl )
+                     == HybridSolid< dimension >::type_name_static() )
+            {
+                block.set_mesh_loader(
+                    detail::archived_mesh_loader< SolidMesh< dimension >,
+                        OpenGeodeHybridSolid< dimension > >( archive,
+                        entry, impl, load_hybrid_solid< dimension > ),
+                    archive, typename Block< dimension >::BlocksKey{} );
+            }
+            else
+            {
+                block.set_mesh_loader(
+                    detail::archived_mesh_loader< SolidMesh< dimension >,
+                        OpenGeodePolyhedralSolid< dimension > >( archive,
+                        entry, impl, load_polyhedral_solid< dimension > ),
+                    archive, typename Block< dimension >::BlocksKey{} );
+            }
+        }
+    }
+
     template < index_t dimension >
     const uuid& Blocks< dimension >::create_block()
     {
@@ -88,6 +88,13 @@ namespace geode
         return impl_->modifiable_mesh();
     }
 
+    template < index_t dimension >
+    std::shared_ptr< const PointSet< dimension > >
+        Corner< dimension >::pinned_mesh() const
+    {
+        return impl_->pinned_mesh();
+    }
+
     template < index_t dimension >
     const MeshImpl& Corner< dimension >::mesh_type() const
     {
@@ -121,6 +128,15 @@ namespace geode
         impl_->set_mesh( this->id(), std::move( mesh ) );
     }
 
+    template < index_t dimension >
+    void Corner< dimension >::set_mesh_loader( MeshLoader loader,
+        std::shared_ptr< detail::LazyMeshArchive > archive,
+        CornersKey )
+    {
+        impl_->set_mesh_loader(
+            this->id(), std::move( loader ), std::move( archive ) );
+    }
+
     template < index_t dimension >
     void Corner< dimension >::set_mesh(
         std::unique_ptr< PointSet< dimension > > mesh, CornersBuilderKey )
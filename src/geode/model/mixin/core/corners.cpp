@@ -27,13 +27,17 @@
 
 #include <geode/basic/pimpl_impl.h>
 #include <geode/basic/range.h>
+#include <geode/basic/zip_file.h>
 
+#include <geode/mesh/core/geode/geode_point_set.h>
 #include <geode/mesh/core/point_set.h>
 #include <geode/mesh/io/point_set_input.h>
 #include <geode/mesh/io/point_set_output.h>
 
 #include <geode/model/mixin/core/corner.h>
 #include <geode/model/mixin/core/detail/components_storage.h>
+#include <geode/model/mixin/core/detail/lazy_mesh_archive.h>
+#include <geode/model/mixin/core/detail/mesh_storage.h>
 
 namespace geode
 {
@@ -106,7 +110,8 @@ namespace geode
         for( const auto& corner : corners() )
         {
             tasks[count++] = async::spawn( [&corner, &prefix] {
-                const auto& mesh = corner.mesh();
+                const auto pinned_mesh = corner.pinned_mesh();
+                const auto& mesh = *pinned_mesh;
                 const auto file = absl::StrCat( prefix, corner.id().string(),
                     ".", mesh.native_extension() );
                 save_point_set( mesh, file );
@@ -121,6 +126,43 @@ namespace geode
         }
     }
 
+    template < index_t dimension >
+    void Corners< dimension >::save_corners( const ZipFile& zip_writer ) const
+    {
+        impl_->save_components( zip_writer, "corners" );
+        const auto prefix = Corner< dimension >::component_type_static().get();
+        const auto level = Logger::level();
+        Logger::set_level( Logger::Level::warn );
+        absl::FixedArray< async::task< void > > tasks( nb_corners() );
+        index_t count{ 0 };
+        for( const auto& corner : corners() )
+        {
+            tasks[count++] = async::spawn( [&corner, &prefix, &zip_writer] {
+                const auto pinned_mesh = corner.pinned_mesh();
+                const auto& mesh = *pinned_mesh;
+                const auto entry = absl::StrCat( prefix, corner.id().string(),
+                    ".", mesh.native_extension() );
+                if( detail::archive_native_mesh<
+                        OpenGeodePointSet< dimension > >(
+                        zip_writer, entry, mesh ) )
+                {
+                    return;
+                }
+                const auto file =
+                    absl::StrCat( zip_writer.directory(), "/", entry );
+                save_point_set( mesh, file );
+                zip_writer.archive_file( file );
+            } );
+        }
+        auto all_tasks = async::when_all( tasks );
+        all_tasks.wait();
+        Logger::set_level( level );
+        for( auto& task : all_tasks.get() )
+        {
+            task.get();
+        }
+    }
+
     template < index_t dimension >
     void Corners< dimension >::load_corners( absl::string_view directory )
     {
@@ -148,6 +190,23 @@ namespace geode
         }
     }
 
+    template < index_t dimension >
+    void Corners< dimension >::load_corners( absl::string_view directory,
+        std::shared_ptr< detail::LazyMeshArchive > archive )
+    {
+        impl_->load_components( absl::StrCat( directory, "/corners" ) );
+        for( auto& corner : modifiable_corners() )
+        {
+            const auto entry = archive->mesh_entry( corner.id() );
+            const auto impl = corner.mesh_type();
+            corner.set_mesh_loader(
+                detail::archived_mesh_loader< PointSet< dimension >,
+                    OpenGeodePointSet< dimension > >( archive, entry, impl,
+                    load_point_set< dimension > ),
+                archive, typename Corner< dimension >::CornersKey{} );
+        }
+    }
+
     template < index_t dimension >
     typename Corners< dimension >::CornerRange
         Corners< dimension >::corners() const
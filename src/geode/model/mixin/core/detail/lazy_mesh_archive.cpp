@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2019 - 2023 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/model/mixin/core/detail/lazy_mesh_archive.h>
+
+#include <ghc/filesystem.hpp>
+
+namespace
+{
+    constexpr size_t UUID_LENGTH{ 36 };
+} // namespace
+
+namespace geode
+{
+    namespace detail
+    {
+        LazyMeshArchive::LazyMeshArchive(
+            absl::string_view filename, uint64_t memory_budget )
+            : zip_reader_{ filename, uuid{}.string() },
+              memory_budget_( memory_budget )
+        {
+            for( auto& entry : zip_reader_.entries() )
+            {
+                const auto extension = entry.find_last_of( '.' );
+                if( extension != std::string::npos
+                    && extension >= UUID_LENGTH )
+                {
+                    auto id =
+                        entry.substr( extension - UUID_LENGTH, UUID_LENGTH );
+                    mesh_entries_.emplace(
+                        std::move( id ), std::move( entry ) );
+                }
+                else
+                {
+                    model_entries_.emplace_back( std::move( entry ) );
+                }
+            }
+        }
+
+        std::string LazyMeshArchive::extract_model_files() const
+        {
+            for( const auto& entry : model_entries_ )
+            {
+                zip_reader_.extract_entry( entry );
+            }
+            return zip_reader_.directory();
+        }
+
+        void LazyMeshArchive::remove_model_files() const
+        {
+            const ghc::filesystem::path directory{ zip_reader_.directory() };
+            for( const auto& entry : model_entries_ )
+            {
+                ghc::filesystem::remove( directory / entry );
+            }
+        }
+
+        const std::string& LazyMeshArchive::mesh_entry(
+            const uuid& component_id ) const
+        {
+            const auto entry = mesh_entries_.find( component_id.string() );
+            OPENGEODE_EXCEPTION( entry != mesh_entries_.end(),
+                "[LazyMeshArchive::mesh_entry] No mesh found in the archive "
+                "for component ",
+                component_id.string() );
+            return entry->second;
+        }
+
+        void LazyMeshArchive::set_mesh_loaded_callback(
+            const uuid& component_id, std::function< void() > callback )
+        {
+            callbacks_[component_id] = std::move( callback );
+        }
+
+        void LazyMeshArchive::mesh_loaded( const uuid& component_id ) const
+        {
+            const auto callback = callbacks_.find( component_id );
+            if( callback != callbacks_.end() )
+            {
+                callback->second();
+            }
+        }
+
+        void LazyMeshArchive::track_mesh(
+            const uuid& component_id, EvictableMesh& mesh )
+        {
+            if( !has_memory_budget() )
+            {
+                return;
+            }
+            std::lock_guard< std::mutex > lock{ tracking_mutex_ };
+            tracked_meshes_.emplace_back( component_id, &mesh );
+            loaded_size_ +=
+                zip_reader_.entry_size( mesh_entry( component_id ) );
+        }
+
+        void LazyMeshArchive::release_untouched_meshes()
+        {
+            if( !has_memory_budget() )
+            {
+                return;
+            }
+            std::lock_guard< std::mutex > lock{ tracking_mutex_ };
+            for( size_t t = 0; t < tracked_meshes_.size(); )
+            {
+                auto& tracked = tracked_meshes_[t];
+                if( tracked.second->evict_untouched_mesh(
+                        loaded_size_ > memory_budget_ ) )
+                {
+                    loaded_size_ -=
+                        zip_reader_.entry_size( mesh_entry( tracked.first ) );
+                    tracked = tracked_meshes_.back();
+                    tracked_meshes_.pop_back();
+                    continue;
+                }
+                t++;
+            }
+        }
+
+        void LazyMeshArchive::release_unused_mesh( const uuid& component_id )
+        {
+            std::lock_guard< std::mutex > lock{ tracking_mutex_ };
+            if( loaded_size_ <= memory_budget_ )
+            {
+                return;
+            }
+            for( auto& tracked : tracked_meshes_ )
+            {
+                if( tracked.first == component_id )
+                {
+                    if( tracked.second->evict_unused_mesh() )
+                    {
+                        loaded_size_ -= zip_reader_.entry_size(
+                            mesh_entry( component_id ) );
+                        tracked = tracked_meshes_.back();
+                        tracked_meshes_.pop_back();
+                    }
+                    return;
+                }
+            }
+        }
+
+        void LazyMeshArchive::untrack_mesh( const uuid& component_id )
+        {
+            if( !has_memory_budget() )
+            {
+                return;
+            }
+            std::lock_guard< std::mutex > lock{ tracking_mutex_ };
+            for( auto& tracked : tracked_meshes_ )
+            {
+                if( tracked.first == component_id )
+                {
+                    loaded_size_ -=
+                        zip_reader_.entry_size( mesh_entry( component_id ) );
+                    tracked = tracked_meshes_.back();
+                    tracked_meshes_.pop_back();
+                    return;
+                }
+            }
+        }
+    } // namespace detail
+} // namespace geode
@@ -86,6 +86,13 @@ namespace geode
         return impl_->modifiable_mesh();
     }
 
+    template < index_t dimension >
+    std::shared_ptr< const EdgedCurve< dimension > >
+        Line< dimension >::pinned_mesh() const
+    {
+        return impl_->pinned_mesh();
+    }
+
     template < index_t dimension >
     const MeshImpl& Line< dimension >::mesh_type() const
     {
@@ -119,6 +126,15 @@ namespace geode
         impl_->set_mesh( this->id(), std::move( mesh ) );
     }
 
+    template < index_t dimension >
+    void Line< dimension >::set_mesh_loader( MeshLoader loader,
+        std::shared_ptr< detail::LazyMeshArchive > archive,
+        LinesKey )
+    {
+        impl_->set_mesh_loader(
+            this->id(), std::move( loader ), std::move( archive ) );
+    }
+
     template < index_t dimension >
     void Line< dimension >::set_mesh(
         std::unique_ptr< EdgedCurve< dimension > > mesh, LinesBuilderKey )
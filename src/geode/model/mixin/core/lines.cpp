@@ -27,12 +27,16 @@
 
 #include <geode/basic/pimpl_impl.h>
 #include <geode/basic/range.h>
+#include <geode/basic/zip_file.h>
 
 #include <geode/mesh/core/edged_curve.h>
+#include <geode/mesh/core/geode/geode_edged_curve.h>
 #include <geode/mesh/io/edged_curve_input.h>
 #include <geode/mesh/io/edged_curve_output.h>
 
 #include <geode/model/mixin/core/detail/components_storage.h>
+#include <geode/model/mixin/core/detail/lazy_mesh_archive.h>
+#include <geode/model/mixin/core/detail/mesh_storage.h>
 #include <geode/model/mixin/core/line.h>
 
 namespace geode
@@ -104,7 +108,8 @@ namespace geode
         for( const auto& line : lines() )
         {
             tasks[count++] = async::spawn( [&line, &prefix] {
-                const auto& mesh = line.mesh();
+                const auto pinned_mesh = line.pinned_mesh();
+                const auto& mesh = *pinned_mesh;
                 const auto file = absl::StrCat(
                     prefix, line.id().string(), ".", mesh.native_extension() );
                 save_edged_curve( mesh, file );
@@ -119,6 +124,43 @@ namespace geode
         }
     }
 
+    template < index_t dimension >
+    void Lines< dimension >::save_lines( const ZipFile& zip_writer ) const
+    {
+        impl_->save_components( zip_writer, "lines" );
+        const auto prefix = Line< dimension >::component_type_static().get();
+        const auto level = Logger::level();
+        Logger::set_level( Logger::Level::warn );
+        absl::FixedArray< async::task< void > > tasks( nb_lines() );
+        index_t count{ 0 };
+        for( const auto& line : lines() )
+        {
+            tasks[count++] = async::spawn( [&line, &prefix, &zip_writer] {
+                const auto pinned_mesh = line.pinned_mesh();
+                const auto& mesh = *pinned_mesh;
+                const auto entry = absl::StrCat(
+                    prefix, line.id().string(), ".", mesh.native_extension() );
+                if( detail::archive_native_mesh<
+                        OpenGeodeEdgedCurve< dimension > >(
+                        zip_writer, entry, mesh ) )
+                {
+                    return;
+                }
+                const auto file =
+                    absl::StrCat( zip_writer.directory(), "/", entry );
+                save_edged_curve( mesh, file );
+                zip_writer.archive_file( file );
+            } );
+        }
+        auto all_tasks = async::when_all( tasks );
+        all_tasks.wait();
+        Logger::set_level( level );
+        for( auto& task : all_tasks.get() )
+        {
+            task.get();
+        }
+    }
+
     template < index_t dimension >
     void Lines< dimension >::load_lines( absl::string_view directory )
     {
@@ -146,6 +188,23 @@ namespace geode
         }
     }
 
+    template < index_t dimension >
+    void Lines< dimension >::load_lines( absl::string_view directory,
+        std::shared_ptr< detail::LazyMeshArchive > archive )
+    {
+        impl_->load_components( absl::StrCat( directory, "/lines" ) );
+        for( auto& line : modifiable_lines() )
+        {
+            const auto entry = archive->mesh_entry( line.id() );
+            const auto impl = line.mesh_type();
+            line.set_mesh_loader(
+                detail::archived_mesh_loader< EdgedCurve< dimension >,
+                    OpenGeodeEdgedCurve< dimension > >( archive, entry, impl,
+                    load_edged_curve< dimension > ),
+                archive, typename Line< dimension >::LinesKey{} );
+        }
+    }
+
     template < index_t dimension >
     typename Lines< dimension >::LineRange Lines< dimension >::lines() const
     {
@@ -25,6 +25,7 @@
 
 #include <geode/basic/pimpl_impl.h>
 #include <geode/basic/range.h>
+#include <geode/basic/zip_file.h>
 
 #include <geode/model/mixin/core/detail/components_storage.h>
 #include <geode/model/mixin/core/model_boundary.h>
@@ -82,6 +83,13 @@ namespace geode
             absl::StrCat( directory, "/model_boundaries" ) );
     }
 
+    template < index_t dimension >
+    void ModelBoundaries< dimension >::save_model_boundaries(
+        const ZipFile& zip_writer ) const
+    {
+        impl_->save_components( zip_writer, "model_boundaries" );
+    }
+
     template < index_t dimension >
     void ModelBoundaries< dimension >::load_model_boundaries(
         absl::string_view directory )
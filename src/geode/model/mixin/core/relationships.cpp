@@ -27,8 +27,10 @@
 
 #include <geode/basic/attribute_manager.h>
 #include <geode/basic/bitsery_archive.h>
+#include <geode/basic/output_options.h>
 #include <geode/basic/pimpl_impl.h>
 #include <geode/basic/uuid.h>
+#include <geode/basic/zip_file.h>
 
 #include <geode/geometry/bitsery_archive.h>
 
@@ -164,12 +166,28 @@ namespace geode
         {
             const auto filename = absl::StrCat( directory, "/relationships" );
             std::ofstream file{ filename, std::ofstream::binary };
+            save( file, filename, {} );
+        }
+
+        void save( const ZipFile& zip_writer ) const
+        {
+            zip_writer.archive_entry(
+                "relationships", [this, &zip_writer]( std::ostream& stream ) {
+                    save( stream, "relationships", zip_writer.options() );
+                } );
+        }
+
+        void save( std::ostream& stream,
+            absl::string_view filename,
+            const OutputOptions& options ) const
+        {
             TContext context{};
+            std::get< 3 >( context ).layout = options.attribute_layout;
             register_basic_serialize_pcontext( std::get< 0 >( context ) );
             register_geometry_serialize_pcontext( std::get< 0 >( context ) );
             register_mesh_serialize_pcontext( std::get< 0 >( context ) );
             register_model_serialize_pcontext( std::get< 0 >( context ) );
-            Serializer archive{ context, file };
+            Serializer archive{ context, stream };
             archive.object( *this );
             archive.adapter().flush();
             OPENGEODE_EXCEPTION( std::get< 1 >( context ).isValid(),
@@ -404,6 +422,11 @@ namespace geode
         impl_->save( directory );
     }
 
+    void Relationships::save_relationships( const ZipFile& zip_writer ) const
+    {
+        impl_->save( zip_writer );
+    }
+
     void Relationships::copy_relationships( const ModelCopyMapping& mapping,
         const Relationships& relationships,
         RelationshipsBuilderKey )
@@ -88,6 +88,13 @@ namespace geode
         return impl_->modifiable_mesh();
     }
 
+    template < index_t dimension >
+    std::shared_ptr< const SurfaceMesh< dimension > >
+        Surface< dimension >::pinned_mesh() const
+    {
+        return impl_->pinned_mesh();
+    }
+
     template < index_t dimension >
     const MeshImpl& Surface< dimension >::mesh_type() const
     {
@@ -123,6 +130,15 @@ namespace geode
         impl_->set_mesh( this->id(), std::move( mesh ) );
     }
 
+    template < index_t dimension >
+    void Surface< dimension >::set_mesh_loader( MeshLoader loader,
+        std::shared_ptr< detail::LazyMeshArchive > archive,
+        SurfacesKey )
+    {
+        impl_->set_mesh_loader(
+            this->id(), std::move( loader ), std::move( archive ) );
+    }
+
     template < index_t dimension >
     void Surface< dimension >::set_mesh(
         std::unique_ptr< SurfaceMesh< dimension > > mesh, SurfacesBuilderKey )
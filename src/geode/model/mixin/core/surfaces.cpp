@@ -27,7 +27,10 @@
 
 #include <geode/basic/pimpl_impl.h>
 #include <geode/basic/range.h>
+#include <geode/basic/zip_file.h>
 
+#include <geode/mesh/core/geode/geode_polygonal_surface.h>
+#include <geode/mesh/core/geode/geode_triangulated_surface.h>
 #include <geode/mesh/core/mesh_factory.h>
 #include <geode/mesh/core/polygonal_surface.h>
 #include <geode/mesh/core/triangulated_surface.h>
@@ -37,8 +40,35 @@
 #include <geode/mesh/io/triangulated_surface_output.h>
 
 #include <geode/model/mixin/core/detail/components_storage.h>
+#include <geode/model/mixin/core/detail/lazy_mesh_archive.h>
+#include <geode/model/mixin/core/detail/mesh_storage.h>
 #include <geode/model/mixin/core/surface.h>
 
+namespace
+{
+    template < geode::index_t dimension >
+    void save_surface_mesh( const geode::SurfaceMesh< dimension >& mesh,
+        absl::string_view file )
+    {
+        if( const auto* triangulated = dynamic_cast<
+                const geode::TriangulatedSurface< dimension >* >( &mesh ) )
+        {
+            geode::save_triangulated_surface( *triangulated, file );
+        }
+        else if( const auto* polygonal = dynamic_cast<
+                     const geode::PolygonalSurface< dimension >* >( &mesh ) )
+        {
+            geode::save_polygonal_surface( *polygonal, file );
+        }
+        else
+        {
+            throw geode::OpenGeodeException( "[Surfaces::save_surfaces] "
+                                             "Cannot find the explicit "
+                                             "SurfaceMesh type" );
+        }
+    }
+} // namespace
+
 namespace geode
 {
     template < index_t dimension >
@@ -114,26 +144,51 @@ namespace geode
         for( const auto& surface : surfaces() )
         {
             tasks[count++] = async::spawn( [&surface, &prefix] {
-                const auto& mesh = surface.mesh();
+                const auto pinned_mesh = surface.pinned_mesh();
+                const auto& mesh = *pinned_mesh;
                 const auto file = absl::StrCat( prefix, surface.id().string(),
                     ".", mesh.native_extension() );
-                if( const auto* triangulated =
-                        dynamic_cast< const TriangulatedSurface< dimension >* >(
-                            &mesh ) )
-                {
-                    save_triangulated_surface( *triangulated, file );
-                }
-                else if( const auto* polygonal = dynamic_cast<
-                             const PolygonalSurface< dimension >* >( &mesh ) )
-                {
-                    save_polygonal_surface( *polygonal, file );
-                }
-                else
+                save_surface_mesh( mesh, file );
+            } );
+        }
+        auto all_tasks = async::when_all( tasks );
+        all_tasks.wait();
+        Logger::set_level( level );
+        for( auto& task : all_tasks.get() )
+        {
+            task.get();
+        }
+    }
+
+    template < index_t dimension >
+    void Surfaces< dimension >::save_surfaces( const ZipFile& zip_writer ) const
+    {
+        impl_->save_components( zip_writer, "surfaces" );
+        const auto prefix = Surface< dimension >::component_type_static().get();
+        const auto level = Logger::level();
+        Logger::set_level( Logger::Level::warn );
+        absl::FixedArray< async::task< void > > tasks( nb_surfaces() );
+        index_t count{ 0 };
+        for( const auto& surface : surfaces() )
+        {
+            tasks[count++] = async::spawn( [&surface, &prefix, &zip_writer] {
+                const auto pinned_mesh = surface.pinned_mesh();
+                const auto& mesh = *pinned_mesh;
+                const auto entry = absl::StrCat( prefix, surface.id().string(),
+                    ".", mesh.native_extension() );
+                if( detail::archive_native_mesh<
+                        OpenGeodeTriangulatedSurface< dimension > >(
+                        zip_writer, entry, mesh )
+                    || detail::archive_native_mesh<
+                        OpenGeodePolygonalSurface< dimension > >(
+                        zip_writer, entry, mesh ) )
                 {
-                    throw OpenGeodeException( "[Surfaces::save_surfaces] "
-                                              "Cannot find the explicit "
-                                              "SurfaceMesh type" );
+                    return;
                 }
+                const auto file =
+                    absl::StrCat( zip_writer.directory(), "/", entry );
+                save_surface_mesh( mesh, file );
+                zip_writer.archive_file( file );
             } );
         }
         auto all_tasks = async::when_all( tasks );
@@ -182,6 +237,35 @@ namespace geode
         }
     }
 
+    template < index_t dimension >
+    void Surfaces< dimension >::load_surfaces( absl::string_view directory,
+        std::shared_ptr< detail::LazyMeshArchive > archive )
+    {
+        impl_->load_components( absl::StrCat( directory, "/surfaces" ) );
+        for( auto& surface : modifiable_surfaces() )
+        {
+            const auto entry = archive->mesh_entry( surface.id() );
+            const auto impl = surface.mesh_type();
+            if( MeshFactory::type( impl )
+                == TriangulatedSurface< dimension >::type_name_static() )
+            {
+                surface.set_mesh_loader(
+                    detail::archived_mesh_loader< SurfaceMesh< dimension >,
+                        OpenGeodeTriangulatedSurface< dimension > >( archive,
+                        entry, impl, load_triangulated_surface< dimension > ),
+                    archive, typename Surface< dimension >::SurfacesKey{} );
+            }
+            else
+            {
+                surface.set_mesh_loader(
+                    detail::archived_mesh_loader< SurfaceMesh< dimension >,
+                        OpenGeodePolygonalSurface< dimension > >( archive,
+                        entry, impl, load_polygonal_surface< dimension > ),
+                    archive, typename Surface< dimension >::SurfacesKey{} );
+            }
+        }
+    }
+
     template < index_t dimension >
     typename Surfaces< dimension >::SurfaceRange
         Surfaces< dimension >::surfaces() const
@@ -1,6 +1,8 @@
 #include <geode/model/mixin/core/vertex_identifier.h>
 
+#include <algorithm>
 #include <fstream>
+#include <mutex>
 
 #include <async++.h>
 
@@ -9,7 +11,9 @@
 #include <geode/basic/attribute_manager.h>
 #include <geode/basic/bitsery_archive.h>
 #include <geode/basic/logger.h>
+#include <geode/basic/output_options.h>
 #include <geode/basic/pimpl_impl.h>
+#include <geode/basic/zip_file.h>
 
 #include <geode/geometry/bitsery_archive.h>
 
@@ -25,6 +29,7 @@
 #include <geode/model/mixin/core/bitsery_archive.h>
 #include <geode/model/mixin/core/block.h>
 #include <geode/model/mixin/core/corner.h>
+#include <geode/model/mixin/core/detail/lazy_mesh_archive.h>
 #include <geode/model/mixin/core/line.h>
 #include <geode/model/mixin/core/surface.h>
 
@@ -68,17 +73,10 @@ namespace geode
     class VertexIdentifier::Impl
     {
         const std::string unique_vertices_name = "unique vertices";
+        using CompactVertex = ComponentMeshVerticesView::CompactVertex;
 
     public:
-        Impl()
-            : component_vertices_(
-                unique_vertices_.vertex_attribute_manager()
-                    .find_or_create_attribute< VariableAttribute,
-                        std::vector< ComponentMeshVertex > >(
-                        "component vertices",
-                        std::vector< ComponentMeshVertex >{} ) )
-        {
-        }
+        Impl() = default;
 
         index_t nb_unique_vertices() const
         {
@@ -87,31 +85,31 @@ namespace geode
 
         bool is_unique_vertex_isolated( index_t unique_vertex_id ) const
         {
-            return component_mesh_vertices( unique_vertex_id ).empty();
+            return row( unique_vertex_id ).empty();
         }
 
-        const std::vector< ComponentMeshVertex >& component_mesh_vertices(
+        ComponentMeshVerticesView component_mesh_vertices(
             index_t unique_vertex_id ) const
         {
             OPENGEODE_ASSERT( unique_vertex_id < nb_unique_vertices(),
                 "[VertexIdentifier::component_mesh_vertices] Given "
                 "unique_vertex_id is bigger than the number of unique "
                 "vertices." );
-            return component_vertices_->value( unique_vertex_id );
+            return { row( unique_vertex_id ), components_ };
         }
 
         std::vector< ComponentMeshVertex > component_mesh_vertices(
             index_t unique_vertex_id, const ComponentType& type ) const
         {
-            const auto& component_vertices =
-                component_mesh_vertices( unique_vertex_id );
+            const auto vertices = row( unique_vertex_id );
             std::vector< ComponentMeshVertex > result;
-            result.reserve( component_vertices.size() );
-            for( const auto& component_vertex : component_vertices )
+            result.reserve( vertices.size() );
+            for( const auto& vertex : vertices )
             {
-                if( component_vertex.component_id.type() == type )
+                const auto& component_id = components_[vertex.component];
+                if( component_id.type() == type )
                 {
-                    result.push_back( component_vertex );
+                    result.emplace_back( component_id, vertex.vertex );
                 }
             }
             return result;
@@ -120,15 +118,19 @@ namespace geode
         std::vector< index_t > component_mesh_vertices(
             index_t unique_vertex_id, const uuid& component_id ) const
         {
-            const auto& component_vertices =
-                component_mesh_vertices( unique_vertex_id );
             std::vector< index_t > result;
-            result.reserve( component_vertices.size() );
-            for( const auto& component_vertex : component_vertices )
+            const auto component = component_index( component_id );
+            if( component == NO_ID )
+            {
+                return result;
+            }
+            const auto vertices = row( unique_vertex_id );
+            result.reserve( vertices.size() );
+            for( const auto& vertex : vertices )
             {
-                if( component_vertex.component_id.id() == component_id )
+                if( vertex.component == component )
                 {
-                    result.push_back( component_vertex.vertex );
+                    result.push_back( vertex.vertex );
                 }
             }
             return result;
@@ -143,11 +145,9 @@ namespace geode
         bool has_component_mesh_vertices(
             index_t unique_vertex_id, const ComponentType& type ) const
         {
-            const auto& component_vertices =
-                component_mesh_vertices( unique_vertex_id );
-            for( const auto& component_vertex : component_vertices )
+            for( const auto& vertex : row( unique_vertex_id ) )
             {
-                if( component_vertex.component_id.type() == type )
+                if( components_[vertex.component].type() == type )
                 {
                     return true;
                 }
@@ -158,10 +158,14 @@ namespace geode
         bool has_component_mesh_vertices(
             index_t unique_vertex_id, const uuid& component_id ) const
         {
-            for( const auto& component_vertex :
-                component_mesh_vertices( unique_vertex_id ) )
+            const auto component = component_index( component_id );
+            if( component == NO_ID )
+            {
+                return false;
+            }
+            for( const auto& vertex : row( unique_vertex_id ) )
             {
-                if( component_vertex.component_id.id() == component_id )
+                if( vertex.component == component )
                 {
                     return true;
                 }
@@ -172,28 +176,24 @@ namespace geode
         template < typename MeshComponent >
         void register_component( const MeshComponent& component )
         {
-            auto it = vertex2unique_vertex_.find( component.id() );
             const auto& mesh = component.mesh();
-            if( it == vertex2unique_vertex_.end() )
+            const auto previous = registered_attribute( component.id() );
+            if( !previous )
             {
                 mesh.vertex_attribute_manager().delete_attribute(
                     unique_vertices_name );
-                vertex2unique_vertex_.emplace( component.id(),
-                    mesh.vertex_attribute_manager()
-                        .template find_or_create_attribute< VariableAttribute,
-                            index_t >( unique_vertices_name, NO_ID ) );
             }
-            else
+            auto attribute =
+                mesh.vertex_attribute_manager()
+                    .template find_or_create_attribute< VariableAttribute,
+                        index_t >( unique_vertices_name, NO_ID );
+            if( previous )
             {
-                auto attribute =
-                    mesh.vertex_attribute_manager()
-                        .template find_or_create_attribute< VariableAttribute,
-                            index_t >( unique_vertices_name, NO_ID );
                 try
                 {
                     for( const auto v : Range{ mesh.nb_vertices() } )
                     {
-                        attribute->set_value( v, it->second->value( v ) );
+                        attribute->set_value( v, previous->value( v ) );
                     }
                 }
                 catch( const std::out_of_range& )
@@ -202,8 +202,9 @@ namespace geode
                         "Registering MeshComponent: ", component.id().string(),
                         " in VertexIdentifier, wrong number of vertices." );
                 }
-                it->second = std::move( attribute );
             }
+            std::lock_guard< std::mutex > lock{ registration_mutex_ };
+            vertex2unique_vertex_[component.id()] = std::move( attribute );
         }
 
         template < typename MeshComponent >
@@ -213,7 +214,7 @@ namespace geode
             mesh.vertex_attribute_manager().delete_attribute(
                 "unique vertices" );
             vertex2unique_vertex_.erase( component.id() );
-            filter_component_vertices( component.id() );
+            remove_component( component.id() );
         }
 
         index_t create_unique_vertex()
@@ -235,7 +236,8 @@ namespace geode
                 "[VertexIdentifier::set_unique_vertex] Unique vertex ",
                 unique_vertex_id, " does not exist (nb=", nb_unique_vertices(),
                 ")" );
-            const auto& old_unique_id =
+            std::lock_guard< std::mutex > lock{ edition_mutex_ };
+            const auto old_unique_id =
                 vertex2unique_vertex_
                     .at( component_vertex_id.component_id.id() )
                     ->value( component_vertex_id.vertex );
@@ -246,119 +248,95 @@ namespace geode
 
             if( old_unique_id != NO_ID )
             {
-                unset_unique_vertex( component_vertex_id, old_unique_id );
+                unset_compact_vertex( component_vertex_id, old_unique_id );
             }
             vertex2unique_vertex_.at( component_vertex_id.component_id.id() )
                 ->set_value( component_vertex_id.vertex, unique_vertex_id );
-            const auto& vertices =
-                component_vertices_->value( unique_vertex_id );
-            if( absl::c_find( vertices, component_vertex_id )
-                == vertices.end() )
+            const CompactVertex vertex{
+                add_component( component_vertex_id.component_id ),
+                component_vertex_id.vertex
+            };
+            auto& vertices = edited_row( unique_vertex_id );
+            if( absl::c_find( vertices, vertex ) == vertices.end() )
             {
-                component_vertices_->modify_value( unique_vertex_id,
-                    [&component_vertex_id](
-                        std::vector< ComponentMeshVertex >& value ) {
-                        value.emplace_back( std::move( component_vertex_id ) );
-                    } );
-                ;
+                vertices.push_back( vertex );
             }
+            rebuild_if_needed();
         }
 
         void unset_unique_vertex(
             const ComponentMeshVertex& component_vertex_id,
             const index_t unique_vertex_id )
         {
-            const auto& vertices =
-                component_vertices_->value( unique_vertex_id );
-            const auto it = absl::c_find( vertices, component_vertex_id );
-            OPENGEODE_EXCEPTION( it != vertices.end(),
+            std::lock_guard< std::mutex > lock{ edition_mutex_ };
+            unset_compact_vertex( component_vertex_id, unique_vertex_id );
+        }
+
+        void unset_compact_vertex(
+            const ComponentMeshVertex& component_vertex_id,
+            const index_t unique_vertex_id )
+        {
+            const CompactVertex vertex{
+                component_index( component_vertex_id.component_id.id() ),
+                component_vertex_id.vertex
+            };
+            const auto current = row( unique_vertex_id );
+            OPENGEODE_EXCEPTION( absl::c_find( current, vertex )
+                                     != current.end(),
                 "[VertexIdentifier::unset_unique_vertex] Unique vertex to "
                 "unset is not correct" );
-            component_vertices_->modify_value( unique_vertex_id,
-                [&it]( std::vector< ComponentMeshVertex >& value ) {
-                    value.erase(
-                        // workaround for gcc < 4.9
-                        value.begin() + ( it - value.cbegin() ) );
-                } );
+            auto& vertices = edited_row( unique_vertex_id );
+            vertices.erase( absl::c_find( vertices, vertex ) );
             vertex2unique_vertex_.at( component_vertex_id.component_id.id() )
                 ->set_value( component_vertex_id.vertex, NO_ID );
+            rebuild_if_needed();
         }
 
         void update_unique_vertices( const ComponentID& component_id,
             absl::Span< const index_t > old2new )
         {
-            async::parallel_for(
-                async::irange( index_t{ 0 }, nb_unique_vertices() ),
-                [this, &component_id, &old2new]( index_t uv ) {
-                    if( !has_component_mesh_vertices( uv, component_id.id() ) )
-                    {
-                        return;
-                    }
-                    const auto& all_vertices = component_vertices_->value( uv );
-                    std::vector< bool > to_delete( all_vertices.size(), false );
-                    bool need_to_delete{ false };
-                    for( const auto v : Indices{ all_vertices } )
-                    {
-                        const auto& cmv = all_vertices[v];
-                        if( cmv.component_id.id() != component_id.id() )
-                        {
-                            continue;
-                        }
-                        const auto new_id = old2new[cmv.vertex];
-                        if( new_id == NO_ID )
-                        {
-                            to_delete[v] = true;
-                            need_to_delete = true;
-                        }
-                        else
-                        {
-                            component_vertices_->modify_value( uv,
-                                [v, new_id]( std::vector< ComponentMeshVertex >&
-                                        vertices ) {
-                                    vertices[v].vertex = new_id;
-                                } );
-                        }
-                    }
-                    if( need_to_delete )
-                    {
-                        component_vertices_->modify_value( uv,
-                            [&to_delete](
-                                std::vector< ComponentMeshVertex >& vertices ) {
-                                delete_vector_elements( to_delete, vertices );
-                            } );
-                    }
-                } );
+            const auto component = component_index( component_id.id() );
+            if( component == NO_ID )
+            {
+                return;
+            }
+            rebuild();
+            remove_vertices( [component, &old2new]( CompactVertex& vertex ) {
+                if( vertex.component != component )
+                {
+                    return false;
+                }
+                vertex.vertex = old2new[vertex.vertex];
+                return vertex.vertex == NO_ID;
+            } );
         }
 
         std::vector< index_t > delete_isolated_vertices()
         {
+            rebuild();
             std::vector< bool > to_delete( nb_unique_vertices(), false );
-            absl::flat_hash_map< uuid, std::vector< index_t > >
-                components_vertices;
             for( const auto v : Range{ nb_unique_vertices() } )
             {
-                if( is_unique_vertex_isolated( v ) )
-                {
-                    to_delete[v] = true;
-                    continue;
-                }
-                for( const auto& cmv : component_mesh_vertices( v ) )
-                {
-                    components_vertices[cmv.component_id.id()].emplace_back(
-                        cmv.vertex );
-                }
+                to_delete[v] = is_unique_vertex_isolated( v );
             }
             const auto old2new = VertexSetBuilder::create( unique_vertices_ )
                                      ->delete_vertices( to_delete );
-            for( const auto& component_vertices : components_vertices )
+            index_t nb_rows{ 0 };
+            for( const auto v : Indices{ to_delete } )
             {
-                auto& attribute =
-                    vertex2unique_vertex_.at( component_vertices.first );
-                for( const auto v : component_vertices.second )
+                if( !to_delete[v] )
                 {
-                    attribute->set_value( v, old2new[attribute->value( v )] );
+                    rows_.offsets[++nb_rows] = rows_.offsets[v + 1];
                 }
             }
+            rows_.offsets.resize( nb_rows + 1 );
+            for( const auto& vertex : rows_.entries )
+            {
+                auto& attribute = vertex2unique_vertex_.at(
+                    components_[vertex.component].id() );
+                attribute->set_value(
+                    vertex.vertex, old2new[attribute->value( vertex.vertex )] );
+            }
             return old2new;
         }
 
@@ -366,12 +344,28 @@ namespace geode
         {
             const auto filename = absl::StrCat( directory, "/vertices" );
             std::ofstream file{ filename, std::ofstream::binary };
+            save( file, filename, {} );
+        }
+
+        void save( const ZipFile& zip_writer ) const
+        {
+            zip_writer.archive_entry(
+                "vertices", [this, &zip_writer]( std::ostream& stream ) {
+                    save( stream, "vertices", zip_writer.options() );
+                } );
+        }
+
+        void save( std::ostream& stream,
+            absl::string_view filename,
+            const OutputOptions& options ) const
+        {
             TContext context{};
+            std::get< 3 >( context ).layout = options.attribute_layout;
             register_basic_serialize_pcontext( std::get< 0 >( context ) );
             register_geometry_serialize_pcontext( std::get< 0 >( context ) );
             register_mesh_serialize_pcontext( std::get< 0 >( context ) );
             register_model_serialize_pcontext( std::get< 0 >( context ) );
-            Serializer archive{ context, file };
+            Serializer archive{ context, stream };
             archive.object( *this );
             archive.adapter().flush();
             OPENGEODE_EXCEPTION( std::get< 1 >( context ).isValid(),
@@ -400,63 +394,326 @@ namespace geode
         }
 
     private:
+        /*!
+         * Compressed sparse rows of the component vertices of each unique
+         * vertex: vertices of the unique vertex v are stored in
+         * entries[offsets[v]] to entries[offsets[v + 1]].
+         */
+        struct CompactRows
+        {
+            std::vector< index_t > offsets = std::vector< index_t >( 1, 0 );
+            std::vector< CompactVertex > entries;
+        };
+
         friend class bitsery::Access;
         template < typename Archive >
         void serialize( Archive& archive )
         {
             archive.ext( *this,
-                Growable< Archive, Impl >{ { []( Archive& a, Impl& impl ) {
-                    a.object( impl.unique_vertices_ );
-                    a.ext(
-                        impl.component_vertices_, bitsery::ext::StdSmartPtr{} );
-                    a.ext( impl.vertex2unique_vertex_,
-                        bitsery::ext::StdMap{
-                            impl.vertex2unique_vertex_.max_size() },
-                        []( Archive& a2, uuid& id,
-                            std::shared_ptr< VariableAttribute< index_t > >&
-                                attribute ) {
-                            a2.object( id );
-                            a2.ext( attribute, bitsery::ext::StdSmartPtr{} );
-                        } );
-                } } } );
+                Growable< Archive, Impl >{
+                    { []( Archive& a, Impl& impl ) {
+                         a.object( impl.unique_vertices_ );
+                         std::shared_ptr< VariableAttribute<
+                             std::vector< ComponentMeshVertex > > >
+                             component_vertices;
+                         a.ext( component_vertices,
+                             bitsery::ext::StdSmartPtr{} );
+                         impl.serialize_unique_vertex_map( a );
+                         impl.import_component_vertices( *component_vertices );
+                     },
+                        []( Archive& a, Impl& impl ) {
+                            a.object( impl.unique_vertices_ );
+                            impl.serialize_rows( a );
+                            impl.serialize_unique_vertex_map( a );
+                        } } } );
+        }
+
+        template < typename Archive >
+        void serialize_unique_vertex_map( Archive& archive )
+        {
+            archive.ext( vertex2unique_vertex_,
+                bitsery::ext::StdMap{ vertex2unique_vertex_.max_size() },
+                []( Archive& a, uuid& id,
+                    std::shared_ptr< VariableAttribute< index_t > >&
+                        attribute ) {
+                    a.object( id );
+                    a.ext( attribute, bitsery::ext::StdSmartPtr{} );
+                } );
+        }
+
+        void serialize_rows( Serializer& archive )
+        {
+            auto nb_components = static_cast< index_t >( components_.size() );
+            archive.value4b( nb_components );
+            for( auto& component_id : components_ )
+            {
+                archive.object( component_id );
+            }
+            if( is_compact() )
+            {
+                serialize_compact_rows( archive, rows_ );
+                return;
+            }
+            auto rows = merged_rows();
+            serialize_compact_rows( archive, rows );
         }
 
-        void filter_component_vertices( const uuid& component_id )
+        void serialize_rows( Deserializer& archive )
         {
-            async::parallel_for(
-                async::irange( index_t{ 0 }, nb_unique_vertices() ),
-                [this, &component_id]( index_t uv_id ) {
-                    const auto& component_mesh_vertices =
-                        component_vertices_->value( uv_id );
-                    std::vector< bool > to_keep(
-                        component_mesh_vertices.size(), true );
-                    bool update{ false };
-                    for( const auto i : Indices{ component_mesh_vertices } )
+            index_t nb_components;
+            archive.value4b( nb_components );
+            for( const auto unused : Range{ nb_components } )
+            {
+                geode_unused( unused );
+                auto component_id = bitsery::Access::create< ComponentID >();
+                archive.object( component_id );
+                add_component( component_id );
+            }
+            serialize_compact_rows( archive, rows_ );
+            edited_rows_.clear();
+        }
+
+        template < typename Archive >
+        static void serialize_compact_rows(
+            Archive& archive, CompactRows& rows )
+        {
+            archive.container4b( rows.offsets, rows.offsets.max_size() );
+            archive.container( rows.entries, rows.entries.max_size(),
+                []( Archive& a, CompactVertex& vertex ) {
+                    a.value4b( vertex.component );
+                    a.value4b( vertex.vertex );
+                } );
+        }
+
+        /*!
+         * Convert the component vertices stored as a unique vertex attribute
+         * by previous versions into compact rows.
+         */
+        void import_component_vertices(
+            const VariableAttribute< std::vector< ComponentMeshVertex > >&
+                component_vertices )
+        {
+            rows_ = CompactRows{};
+            for( const auto v : Range{ nb_unique_vertices() } )
+            {
+                for( const auto& vertex : component_vertices.value( v ) )
+                {
+                    rows_.entries.emplace_back(
+                        add_component( vertex.component_id ), vertex.vertex );
+                }
+                rows_.offsets.push_back(
+                    static_cast< index_t >( rows_.entries.size() ) );
+            }
+            unique_vertices_.vertex_attribute_manager().delete_attribute(
+                "component vertices" );
+        }
+
+        std::shared_ptr< VariableAttribute< index_t > > registered_attribute(
+            const uuid& component_id )
+        {
+            std::lock_guard< std::mutex > lock{ registration_mutex_ };
+            const auto it = vertex2unique_vertex_.find( component_id );
+            if( it == vertex2unique_vertex_.end() )
+            {
+                return nullptr;
+            }
+            return it->second;
+        }
+
+        index_t component_index( const uuid& component_id ) const
+        {
+            const auto it = component_indices_.find( component_id );
+            if( it == component_indices_.end() )
+            {
+                return NO_ID;
+            }
+            return it->second;
+        }
+
+        index_t add_component( const ComponentID& component_id )
+        {
+            const auto it = component_indices_.emplace( component_id.id(),
+                static_cast< index_t >( components_.size() ) );
+            if( it.second )
+            {
+                components_.push_back( component_id );
+            }
+            return it.first->second;
+        }
+
+        absl::Span< const CompactVertex > row( index_t unique_vertex_id ) const
+        {
+            if( !edited_rows_.empty() )
+            {
+                const auto it = edited_rows_.find( unique_vertex_id );
+                if( it != edited_rows_.end() )
+                {
+                    return it->second;
+                }
+            }
+            if( unique_vertex_id + 1 >= rows_.offsets.size() )
+            {
+                return {};
+            }
+            const auto begin = rows_.offsets[unique_vertex_id];
+            return { rows_.entries.data() + begin,
+                rows_.offsets[unique_vertex_id + 1] - begin };
+        }
+
+        std::vector< CompactVertex >& edited_row( index_t unique_vertex_id )
+        {
+            const auto it = edited_rows_.find( unique_vertex_id );
+            if( it != edited_rows_.end() )
+            {
+                return it->second;
+            }
+            const auto vertices = row( unique_vertex_id );
+            return edited_rows_
+                .emplace( unique_vertex_id, std::vector< CompactVertex >(
+                                                vertices.begin(),
+                                                vertices.end() ) )
+                .first->second;
+        }
+
+        bool is_compact() const
+        {
+            return edited_rows_.empty()
+                   && rows_.offsets.size() == nb_unique_vertices() + 1;
+        }
+
+        CompactRows merged_rows() const
+        {
+            CompactRows rows;
+            rows.offsets.reserve( nb_unique_vertices() + 1 );
+            rows.entries.reserve( rows_.entries.size() );
+            for( const auto v : Range{ nb_unique_vertices() } )
+            {
+                const auto vertices = row( v );
+                rows.entries.insert(
+                    rows.entries.end(), vertices.begin(), vertices.end() );
+                rows.offsets.push_back(
+                    static_cast< index_t >( rows.entries.size() ) );
+            }
+            return rows;
+        }
+
+        /*!
+         * Merge the edited rows into the compact rows in a single pass.
+         */
+        void rebuild()
+        {
+            if( is_compact() )
+            {
+                return;
+            }
+            rows_ = merged_rows();
+            absl::flat_hash_map< index_t, std::vector< CompactVertex > >{}
+                .swap( edited_rows_ );
+        }
+
+        /*!
+         * Rebuild once the edited rows outnumber half of the compact rows,
+         * so that the merge cost is amortized over the edits.
+         */
+        void rebuild_if_needed()
+        {
+            static constexpr size_t MIN_EDITED_ROWS{ 1024 };
+            if( edited_rows_.size()
+                > std::max( MIN_EDITED_ROWS, rows_.offsets.size() / 2 ) )
+            {
+                rebuild();
+            }
+        }
+
+        /*!
+         * Remove the compact vertices matching the filter.
+         * The filter may also modify the kept vertices, it is called
+         * concurrently on different rows.
+         */
+        template < typename Filter >
+        void remove_vertices( const Filter& to_remove )
+        {
+            const auto nb_rows = nb_unique_vertices();
+            std::vector< index_t > nb_kept( nb_rows );
+            async::parallel_for( async::irange( index_t{ 0 }, nb_rows ),
+                [this, &to_remove, &nb_kept]( index_t v ) {
+                    const auto begin = rows_.offsets[v];
+                    auto kept = begin;
+                    for( const auto e : Range{ begin, rows_.offsets[v + 1] } )
                     {
-                        if( component_mesh_vertices[i].component_id.id()
-                            == component_id )
+                        if( !to_remove( rows_.entries[e] ) )
                         {
-                            to_keep[i] = false;
-                            update = true;
+                            rows_.entries[kept++] = rows_.entries[e];
                         }
                     }
-                    if( update )
-                    {
-                        component_vertices_->set_value(
-                            uv_id, extract_vector_elements(
-                                       to_keep, component_mesh_vertices ) );
-                    }
+                    nb_kept[v] = kept - begin;
                 } );
+            CompactRows rows;
+            rows.offsets.reserve( nb_rows + 1 );
+            for( const auto v : Range{ nb_rows } )
+            {
+                rows.offsets.push_back( rows.offsets.back() + nb_kept[v] );
+            }
+            if( rows.offsets.back() == rows_.entries.size() )
+            {
+                return;
+            }
+            rows.entries.resize( rows.offsets.back() );
+            async::parallel_for( async::irange( index_t{ 0 }, nb_rows ),
+                [this, &rows, &nb_kept]( index_t v ) {
+                    const auto begin = rows_.entries.begin() + rows_.offsets[v];
+                    std::copy( begin, begin + nb_kept[v],
+                        rows.entries.begin() + rows.offsets[v] );
+                } );
+            rows_ = std::move( rows );
+        }
+
+        /*!
+         * Remove the component vertices and the component from the
+         * component table.
+         */
+        void remove_component( const uuid& component_id )
+        {
+            const auto component = component_index( component_id );
+            if( component == NO_ID )
+            {
+                return;
+            }
+            rebuild();
+            remove_vertices( [component]( CompactVertex& vertex ) {
+                if( vertex.component == component )
+                {
+                    return true;
+                }
+                if( vertex.component > component )
+                {
+                    vertex.component--;
+                }
+                return false;
+            } );
+            components_.erase( components_.begin() + component );
+            component_indices_.erase( component_id );
+            for( auto& index : component_indices_ )
+            {
+                if( index.second > component )
+                {
+                    index.second--;
+                }
+            }
         }
 
     private:
         OpenGeodeVertexSet unique_vertices_;
-        std::shared_ptr<
-            VariableAttribute< std::vector< ComponentMeshVertex > > >
-            component_vertices_;
+        std::vector< ComponentID > components_;
+        absl::flat_hash_map< uuid, index_t > component_indices_;
+        CompactRows rows_;
+        absl::flat_hash_map< index_t, std::vector< CompactVertex > >
+            edited_rows_;
         absl::flat_hash_map< uuid,
             std::shared_ptr< VariableAttribute< index_t > > >
             vertex2unique_vertex_;
+        std::mutex registration_mutex_;
+        std::mutex edition_mutex_;
     };
 
     VertexIdentifier::VertexIdentifier() {} // NOLINT
@@ -477,9 +734,8 @@ namespace geode
         return impl_->is_unique_vertex_isolated( unique_vertex_id );
     }
 
-    const std::vector< ComponentMeshVertex >&
-        VertexIdentifier::component_mesh_vertices(
-            index_t unique_vertex_id ) const
+    ComponentMeshVerticesView VertexIdentifier::component_mesh_vertices(
+        index_t unique_vertex_id ) const
     {
         return impl_->component_mesh_vertices( unique_vertex_id );
     }
@@ -524,6 +780,20 @@ namespace geode
         impl_->register_component( component );
     }
 
+    template < typename MeshComponent >
+    void VertexIdentifier::register_lazy_mesh_component(
+        const MeshComponent& component,
+        detail::LazyMeshArchive& archive,
+        BuilderKey )
+    {
+        auto& impl = *impl_;
+        const auto* lazy_component = &component;
+        archive.set_mesh_loaded_callback(
+            component.id(), [&impl, lazy_component] {
+                impl.register_component( *lazy_component );
+            } );
+    }
+
     template < typename MeshComponent >
     void VertexIdentifier::unregister_mesh_component(
         const MeshComponent& component, BuilderKey )
@@ -572,6 +842,12 @@ namespace geode
         impl_->save( directory );
     }
 
+    void VertexIdentifier::save_unique_vertices(
+        const ZipFile& zip_writer ) const
+    {
+        impl_->save( zip_writer );
+    }
+
     void VertexIdentifier::load_unique_vertices(
         absl::string_view directory, BuilderKey )
     {
@@ -621,5 +897,27 @@ namespace geode
         VertexIdentifier::unregister_mesh_component(
             const Block3D&, BuilderKey );
 
+    template void opengeode_model_api
+        VertexIdentifier::register_lazy_mesh_component(
+            const Corner2D&, detail::LazyMeshArchive&, BuilderKey );
+    template void opengeode_model_api
+        VertexIdentifier::register_lazy_mesh_component(
+            const Corner3D&, detail::LazyMeshArchive&, BuilderKey );
+    template void opengeode_model_api
+        VertexIdentifier::register_lazy_mesh_component(
+            const Line2D&, detail::LazyMeshArchive&, BuilderKey );
+    template void opengeode_model_api
+        VertexIdentifier::register_lazy_mesh_component(
+            const Line3D&, detail::LazyMeshArchive&, BuilderKey );
+    template void opengeode_model_api
+        VertexIdentifier::register_lazy_mesh_component(
+            const Surface2D&, detail::LazyMeshArchive&, BuilderKey );
+    template void opengeode_model_api
+        VertexIdentifier::register_lazy_mesh_component(
+            const Surface3D&, detail::LazyMeshArchive&, BuilderKey );
+    template void opengeode_model_api
+        VertexIdentifier::register_lazy_mesh_component(
+            const Block3D&, detail::LazyMeshArchive&, BuilderKey );
+
     SERIALIZE_BITSERY_ARCHIVE( opengeode_model_api, ComponentMeshVertex );
 } // namespace geode
@@ -29,12 +29,14 @@
 
 namespace geode
 {
-    void save_brep( const BRep& brep, absl::string_view filename )
+    void save_brep( const BRep& brep,
+        absl::string_view filename,
+        const OutputOptions& options )
     {
         try
         {
             detail::geode_object_output_impl< BRepOutputFactory >(
-                "BRep", brep, filename );
+                "BRep", brep, filename, options );
         }
         catch( const OpenGeodeException& e )
         {
@@ -42,4 +44,9 @@ namespace geode
             throw OpenGeodeException{ "Cannot save BRep in file: ", filename };
         }
     }
+
+    void save_brep( const BRep& brep, absl::string_view filename )
+    {
+        save_brep( brep, filename, {} );
+    }
 } // namespace geode
@@ -28,24 +28,110 @@
 #include <geode/basic/uuid.h>
 #include <geode/basic/zip_file.h>
 
+#include <geode/model/mixin/core/detail/lazy_mesh_archive.h>
 #include <geode/model/representation/builder/brep_builder.h>
 #include <geode/model/representation/core/brep.h>
+#include <geode/model/representation/io/geode/detail/component_loading.h>
 
 namespace geode
 {
     void OpenGeodeBRepInput::load_brep_files(
         BRep& brep, absl::string_view directory )
     {
+        BRepBuilder builder{ brep };
+        detail::ModelLoadingPhases phases;
+        const auto level = Logger::level();
+        Logger::set_level( Logger::Level::warn );
+        auto unique_vertices =
+            detail::spawn_phase( phases, "Unique vertices loading",
+                [&builder, &directory] {
+                    builder.load_unique_vertices( directory );
+                } )
+                .share();
+        std::vector< async::task< void > > tasks;
+        tasks.push_back( detail::spawn_phase(
+            phases, "Identifier loading", [&builder, &directory] {
+                builder.load_identifier( directory );
+            } ) );
+        tasks.push_back( detail::spawn_phase(
+            phases, "Model boundaries loading", [&builder, &directory] {
+                builder.load_model_boundaries( directory );
+            } ) );
+        tasks.push_back( detail::spawn_phase(
+            phases, "Relationships loading", [&builder, &directory] {
+                builder.load_relationships( directory );
+            } ) );
+        tasks.push_back(
+            detail::load_and_register_components< Corner3D >( phases,
+                "Corners", builder, unique_vertices,
+                [&builder, &directory] {
+                    builder.load_corners( directory );
+                },
+                [&brep] {
+                    return brep.corners();
+                } ) );
+        tasks.push_back(
+            detail::load_and_register_components< Line3D >( phases,
+                "Lines", builder, unique_vertices,
+                [&builder, &directory] {
+                    builder.load_lines( directory );
+                },
+                [&brep] {
+                    return brep.lines();
+                } ) );
+        tasks.push_back(
+            detail::load_and_register_components< Surface3D >( phases,
+                "Surfaces", builder, unique_vertices,
+                [&builder, &directory] {
+                    builder.load_surfaces( directory );
+                },
+                [&brep] {
+                    return brep.surfaces();
+                } ) );
+        tasks.push_back(
+            detail::load_and_register_components< Block3D >( phases,
+                "Blocks", builder, unique_vertices,
+                [&builder, &directory] {
+                    builder.load_blocks( directory );
+                },
+                [&brep] {
+                    return brep.blocks();
+                } ) );
+        auto all_tasks = async::when_all( tasks );
+        all_tasks.wait();
+        Logger::set_level( level );
+        for( auto& task : all_tasks.get() )
+        {
+            task.get();
+        }
+        phases.log( "BRep" );
+    }
+
+    BRep OpenGeodeBRepInput::read()
+    {
+        const UnzipFile zip_reader{ filename(), uuid{}.string() };
+        zip_reader.extract_all();
+        BRep brep;
+        load_brep_files( brep, zip_reader.directory() );
+        return brep;
+    }
+
+    BRep OpenGeodeBRepInput::read_lazily( uint64_t memory_budget )
+    {
+        auto archive = std::make_shared< detail::LazyMeshArchive >(
+            filename(), memory_budget );
+        const auto directory = archive->extract_model_files();
+        BRep brep;
         BRepBuilder builder{ brep };
         async::parallel_invoke(
             [&builder, &directory] {
                 builder.load_identifier( directory );
             },
-            [&builder, &directory] {
-                builder.load_corners( directory );
-                builder.load_lines( directory );
-                builder.load_surfaces( directory );
-                builder.load_blocks( directory );
+            [&builder, &directory, &archive] {
+                builder.load_corners( directory, archive );
+                builder.load_lines( directory, archive );
+                builder.load_surfaces( directory, archive );
+                builder.load_blocks( directory, archive );
             },
             [&builder, &directory] {
                 builder.load_model_boundaries( directory );
@@ -58,28 +144,30 @@ namespace geode
             } );
         for( const auto& corner : brep.corners() )
         {
-            builder.register_mesh_component( corner );
+            builder.register_lazy_mesh_component( corner, *archive );
         }
         for( const auto& line : brep.lines() )
         {
-            builder.register_mesh_component( line );
+            builder.register_lazy_mesh_component( line, *archive );
         }
         for( const auto& surface : brep.surfaces() )
         {
-            builder.register_mesh_component( surface );
+            builder.register_lazy_mesh_component( surface, *archive );
         }
         for( const auto& block : brep.blocks() )
         {
-            builder.register_mesh_component( block );
+            builder.register_lazy_mesh_component( block, *archive );
         }
+        archive->remove_model_files();
+        lazy_archive_ = std::move( archive );
+        return brep;
     }
 
-    BRep OpenGeodeBRepInput::read()
+    void OpenGeodeBRepInput::release_untouched_meshes()
     {
-        const UnzipFile zip_reader{ filename(), uuid{}.string() };
-        zip_reader.extract_all();
-        BRep brep;
-        load_brep_files( brep, zip_reader.directory() );
-        return brep;
+        OPENGEODE_EXCEPTION( lazy_archive_ != nullptr,
+            "[OpenGeodeBRepInput::release_untouched_meshes] No BRep "
+            "read lazily" );
+        lazy_archive_->release_untouched_meshes();
     }
 } // namespace geode
@@ -66,10 +66,33 @@ namespace geode
             } );
     }
 
+    void OpenGeodeBRepOutput::save_brep_files(
+        const BRep& brep, const ZipFile& zip_writer ) const
+    {
+        async::parallel_invoke(
+            [&zip_writer, &brep] {
+                brep.save_identifier( zip_writer );
+            },
+            [&zip_writer, &brep] {
+                brep.save_relationships( zip_writer );
+            },
+            [&zip_writer, &brep] {
+                brep.save_unique_vertices( zip_writer );
+            },
+            [&zip_writer, &brep] {
+                brep.save_corners( zip_writer );
+                brep.save_lines( zip_writer );
+                brep.save_surfaces( zip_writer );
+                brep.save_blocks( zip_writer );
+            },
+            [&zip_writer, &brep] {
+                brep.save_model_boundaries( zip_writer );
+            } );
+    }
+
     void OpenGeodeBRepOutput::write( const BRep& brep ) const
     {
-        const ZipFile zip_writer{ filename(), uuid{}.string() };
-        save_brep_files( brep, zip_writer.directory() );
-        archive_brep_files( zip_writer );
+        const ZipFile zip_writer{ filename(), uuid{}.string(), options() };
+        save_brep_files( brep, zip_writer );
     }
 } // namespace geode
@@ -28,23 +28,100 @@
 #include <geode/basic/uuid.h>
 #include <geode/basic/zip_file.h>
 
+#include <geode/model/mixin/core/detail/lazy_mesh_archive.h>
 #include <geode/model/representation/builder/section_builder.h>
 #include <geode/model/representation/core/section.h>
+#include <geode/model/representation/io/geode/detail/component_loading.h>
 
 namespace geode
 {
     void OpenGeodeSectionInput::load_section_files(
         Section& section, absl::string_view directory )
     {
+        SectionBuilder builder{ section };
+        detail::ModelLoadingPhases phases;
+        const auto level = Logger::level();
+        Logger::set_level( Logger::Level::warn );
+        auto unique_vertices =
+            detail::spawn_phase( phases, "Unique vertices loading",
+                [&builder, &directory] {
+                    builder.load_unique_vertices( directory );
+                } )
+                .share();
+        std::vector< async::task< void > > tasks;
+        tasks.push_back( detail::spawn_phase(
+            phases, "Identifier loading", [&builder, &directory] {
+                builder.load_identifier( directory );
+            } ) );
+        tasks.push_back( detail::spawn_phase(
+            phases, "Model boundaries loading", [&builder, &directory] {
+                builder.load_model_boundaries( directory );
+            } ) );
+        tasks.push_back( detail::spawn_phase(
+            phases, "Relationships loading", [&builder, &directory] {
+                builder.load_relationships( directory );
+            } ) );
+        tasks.push_back(
+            detail::load_and_register_components< Corner2D >( phases,
+                "Corners", builder, unique_vertices,
+                [&builder, &directory] {
+                    builder.load_corners( directory );
+                },
+                [&section] {
+                    return section.corners();
+                } ) );
+        tasks.push_back(
+            detail::load_and_register_components< Line2D >( phases,
+                "Lines", builder, unique_vertices,
+                [&builder, &directory] {
+                    builder.load_lines( directory );
+                },
+                [&section] {
+                    return section.lines();
+                } ) );
+        tasks.push_back(
+            detail::load_and_register_components< Surface2D >( phases,
+                "Surfaces", builder, unique_vertices,
+                [&builder, &directory] {
+                    builder.load_surfaces( directory );
+                },
+                [&section] {
+                    return section.surfaces();
+                } ) );
+        auto all_tasks = async::when_all( tasks );
+        all_tasks.wait();
+        Logger::set_level( level );
+        for( auto& task : all_tasks.get() )
+        {
+            task.get();
+        }
+        phases.log( "Section" );
+    }
+
+    Section OpenGeodeSectionInput::read()
+    {
+        const UnzipFile zip_reader{ filename(), uuid{}.string() };
+        zip_reader.extract_all();
+        Section section;
+        load_section_files( section, zip_reader.directory() );
+        return section;
+    }
+
+    Section OpenGeodeSectionInput::read_lazily( uint64_t memory_budget )
+    {
+        auto archive = std::make_shared< detail::LazyMeshArchive >(
+            filename(), memory_budget );
+        const auto directory = archive->extract_model_files();
+        Section section;
         SectionBuilder builder{ section };
         async::parallel_invoke(
             [&builder, &directory] {
                 builder.load_identifier( directory );
             },
-            [&builder, &directory] {
-                builder.load_corners( directory );
-                builder.load_lines( directory );
-                builder.load_surfaces( directory );
+            [&builder, &directory, &archive] {
+                builder.load_corners( directory, archive );
+                builder.load_lines( directory, archive );
+                builder.load_surfaces( directory, archive );
             },
             [&builder, &directory] {
                 builder.load_model_boundaries( directory );
@@ -57,24 +134,26 @@ namespace geode
             } );
         for( const auto& corner : section.corners() )
         {
-            builder.register_mesh_component( corner );
+            builder.register_lazy_mesh_component( corner, *archive );
         }
         for( const auto& line : section.lines() )
         {
-            builder.register_mesh_component( line );
+            builder.register_lazy_mesh_component( line, *archive );
         }
         for( const auto& surface : section.surfaces() )
         {
-            builder.register_mesh_component( surface );
+            builder.register_lazy_mesh_component( surface, *archive );
         }
+        archive->remove_model_files();
+        lazy_archive_ = std::move( archive );
+        return section;
     }
 
-    Section OpenGeodeSectionInput::read()
+    void OpenGeodeSectionInput::release_untouched_meshes()
     {
-        const UnzipFile zip_reader{ filename(), uuid{}.string() };
-        zip_reader.extract_all();
-        Section section;
-        load_section_files( section, zip_reader.directory() );
-        return section;
+        OPENGEODE_EXCEPTION( lazy_archive_ != nullptr,
+            "[OpenGeodeSectionInput::release_untouched_meshes] No Section "
+            "read lazily" );
+        lazy_archive_->release_untouched_meshes();
     }
 } // namespace geode
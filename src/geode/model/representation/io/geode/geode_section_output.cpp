@@ -55,6 +55,29 @@ namespace geode
             } );
     }
 
+    void OpenGeodeSectionOutput::save_section_files(
+        const Section& section, const ZipFile& zip_writer ) const
+    {
+        async::parallel_invoke(
+            [&zip_writer, &section] {
+                section.save_identifier( zip_writer );
+            },
+            [&zip_writer, &section] {
+                section.save_relationships( zip_writer );
+            },
+            [&zip_writer, &section] {
+                section.save_unique_vertices( zip_writer );
+            },
+            [&zip_writer, &section] {
+                section.save_corners( zip_writer );
+                section.save_lines( zip_writer );
+                section.save_surfaces( zip_writer );
+            },
+            [&zip_writer, &section] {
+                section.save_model_boundaries( zip_writer );
+            } );
+    }
+
     void OpenGeodeSectionOutput::archive_section_files(
         const ZipFile& zip_writer ) const
     {
@@ -67,8 +90,7 @@ namespace geode
 
     void OpenGeodeSectionOutput::write( const Section& section ) const
     {
-        const ZipFile zip_writer{ filename(), uuid{}.string() };
-        save_section_files( section, zip_writer.directory() );
-        archive_section_files( zip_writer );
+        const ZipFile zip_writer{ filename(), uuid{}.string(), options() };
+        save_section_files( section, zip_writer );
     }
 } // namespace geode
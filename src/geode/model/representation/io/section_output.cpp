@@ -29,12 +29,14 @@
 
 namespace geode
 {
-    void save_section( const Section& section, absl::string_view filename )
+    void save_section( const Section& section,
+        absl::string_view filename,
+        const OutputOptions& options )
     {
         try
         {
             detail::geode_object_output_impl< SectionOutputFactory >(
-                "Section", section, filename );
+                "Section", section, filename, options );
         }
         catch( const OpenGeodeException& e )
         {
@@ -43,4 +45,9 @@ namespace geode
                 filename };
         }
     }
+
+    void save_section( const Section& section, absl::string_view filename )
+    {
+        save_section( section, filename, {} );
+    }
 } // namespace geode
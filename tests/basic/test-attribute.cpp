@@ -27,6 +27,7 @@
 
 #include <geode/basic/attribute.h>
 #include <geode/basic/attribute_manager.h>
+#include <geode/basic/detail/column_encoding.h>
 #include <geode/basic/logger.h>
 
 #include <geode/tests/common.h>
@@ -240,6 +241,65 @@ void test_bool_variable_attribute( geode::AttributeManager& manager )
         !attribute->value( 3 ), "[Test] Should be equal to false" );
 }
 
+void test_bulk_variable_attribute()
+{
+    geode::AttributeManager manager;
+    manager.resize( 10 );
+    auto variable_attribute =
+        manager.find_or_create_attribute< geode::VariableAttribute, double >(
+            "bulk", 1 );
+    OPENGEODE_EXCEPTION( variable_attribute->values().size() == 10,
+        "[Test] Wrong number of bulk values" );
+    const std::array< double, 3 > values{ 2, 3, 4 };
+    variable_attribute->set_values( 4, values );
+    variable_attribute->modify_values( []( absl::Span< double > all_values ) {
+        for( auto& value : all_values )
+        {
+            value *= 2;
+        }
+    } );
+    const auto bulk_values = variable_attribute->values();
+    OPENGEODE_EXCEPTION( bulk_values[3] == 2 && bulk_values[4] == 4
+                             && bulk_values[6] == 8 && bulk_values[7] == 2,
+        "[Test] Wrong bulk values" );
+
+    const auto attribute = manager.find_attribute< double >( "bulk" );
+    const geode::AttributeValuesView< double > view{ *attribute };
+    OPENGEODE_EXCEPTION(
+        view.is_contiguous(), "[Test] View should be contiguous" );
+    OPENGEODE_EXCEPTION( view.values().data() == bulk_values.data(),
+        "[Test] View should use the attribute storage" );
+    OPENGEODE_EXCEPTION(
+        view.value( 5 ) == 6, "[Test] Should be equal to 6" );
+
+    variable_attribute->fill( 3 );
+    OPENGEODE_EXCEPTION( view.value( 2 ) == 3 && view.value( 9 ) == 3,
+        "[Test] Should be equal to 3 after fill" );
+
+    auto sparse_attribute =
+        manager.find_or_create_attribute< geode::SparseAttribute, double >(
+            "sparse", 1 );
+    sparse_attribute->set_value( 2, 5 );
+    const geode::AttributeValuesView< double > sparse_view{
+        *sparse_attribute
+    };
+    OPENGEODE_EXCEPTION(
+        !sparse_view.is_contiguous(), "[Test] View should not be contiguous" );
+    OPENGEODE_EXCEPTION( sparse_view.value( 2 ) == 5
+                             && sparse_view.value( 3 ) == 1,
+        "[Test] Wrong sparse values through view" );
+
+    auto bool_attribute =
+        manager.find_or_create_attribute< geode::VariableAttribute, bool >(
+            "bulk_bool", false );
+    bool_attribute->fill( true );
+    const std::array< bool, 2 > bool_values{ false, false };
+    bool_attribute->set_values( 8, bool_values );
+    const auto bools = bool_attribute->values();
+    OPENGEODE_EXCEPTION( bools[0] && bools[7] && !bools[8] && !bools[9],
+        "[Test] Wrong bulk bool values" );
+}
+
 bool managers_have_same_attributes( const geode::AttributeManager& manager,
     const geode::AttributeManager& reloaded_manager )
 {
@@ -294,7 +354,8 @@ void check_attribute_values( geode::AttributeManager& manager,
     check_one_attribute_values< Foo >( manager, reloaded_manager, "foo_spr" );
 }
 
-void test_serialize_manager( geode::AttributeManager& manager )
+void test_serialize_manager( geode::AttributeManager& manager,
+    geode::AttributeSerializationLayout layout )
 {
     const auto filename = "manager.out";
     std::ofstream file{ filename, std::ofstream::binary };
@@ -304,6 +365,7 @@ void test_serialize_manager( geode::AttributeManager& manager )
     geode::register_basic_serialize_pcontext( std::get< 0 >( context ) );
     geode::AttributeManager::register_attribute_type< std::array< double, 2 >,
         geode::Serializer >( std::get< 0 >( context ), "array_double_2" );
+    std::get< 3 >( context ).layout = layout;
     geode::Serializer archive{ context, file };
     archive.object( manager );
     archive.adapter().flush();
@@ -341,6 +403,40 @@ void test_serialize_manager( geode::AttributeManager& manager )
     check_attribute_values( manager, reloaded_manager );
 }
 
+void test_serialize_layouts( geode::AttributeManager& manager )
+{
+    for( const auto layout : { geode::AttributeSerializationLayout::columnar,
+             geode::AttributeSerializationLayout::encoded_columnar,
+             geode::AttributeSerializationLayout::row } )
+    {
+        test_serialize_manager( manager, layout );
+    }
+}
+
+template < typename T >
+void test_column_encoding( const std::vector< T >& values )
+{
+    const absl::string_view bytes{ reinterpret_cast< const char* >(
+                                       values.data() ),
+        values.size() * sizeof( T ) };
+    const auto encoded = geode::detail::encode_column(
+        bytes, sizeof( T ), geode::detail::ColumnEncoding::delta_shuffle );
+    std::vector< T > decoded( values.size() );
+    geode::detail::decode_column( encoded, sizeof( T ),
+        geode::detail::ColumnEncoding::delta_shuffle,
+        { reinterpret_cast< char* >( decoded.data() ),
+            decoded.size() * sizeof( T ) } );
+    OPENGEODE_EXCEPTION(
+        decoded == values, "[Test] Wrong decoded column values" );
+}
+
+void test_column_encodings()
+{
+    test_column_encoding< geode::index_t >( { 0, 1, 2, 3, 42, 5 } );
+    test_column_encoding< std::array< double, 3 > >(
+        { { { 0.5, 1, -2 } }, { { 0.6, 1.1, -2 } }, { { 12, 1e10, 3 } } } );
+}
+
 void test_attribute_types( geode::AttributeManager& manager )
 {
     OPENGEODE_EXCEPTION(
@@ -502,6 +598,7 @@ void test()
     test_int_variable_attribute( manager );
     test_bool_variable_attribute( manager );
     test_foo_variable_attribute( manager );
+    test_bulk_variable_attribute();
     test_double_sparse_attribute( manager );
     test_foo_sparse_attribute( manager );
     test_generic_value( manager );
@@ -509,7 +606,9 @@ void test()
     test_delete_attribute_elements( manager );
     test_sparse_attribute_after_element_deletion( manager );
 
-    test_serialize_manager( manager );
+    test_serialize_manager( manager, geode::AttributeSerializationLayout::row );
+    test_serialize_layouts( manager );
+    test_column_encodings();
 
     test_copy_manager( manager );
     test_import_manager( manager );
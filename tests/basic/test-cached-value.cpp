@@ -21,12 +21,14 @@
  *
  */
 
+#include <async++.h>
+
 #include <geode/basic/cached_value.h>
 #include <geode/basic/logger.h>
 
 #include <geode/tests/common.h>
 
-geode::index_t nb_computed{ 0 };
+std::atomic< geode::index_t > nb_computed{ 0 };
 
 struct Value
 {
@@ -48,6 +50,19 @@ Value compute_value( double d, int i )
     return value;
 }
 
+void test_concurrent_computations()
+{
+    nb_computed = 0;
+    std::vector< geode::CachedValue< Value > > caches( 100 );
+    async::parallel_for( async::irange( 0, 10000 ), [&caches]( int i ) {
+        const auto& cache = caches[i % caches.size()];
+        OPENGEODE_EXCEPTION( cache( compute_value, 2., 5 ).test() == 7,
+            "[Test] Wrong result" );
+    } );
+    OPENGEODE_EXCEPTION( nb_computed == caches.size(),
+        "[Test] Wrong number of concurrent computations" );
+}
+
 void test()
 {
     geode::CachedValue< Value > cache;
@@ -68,6 +83,8 @@ void test()
         cache( compute_value, 2., 5 ).test() == 7, "[Test] Wrong result" );
     OPENGEODE_EXCEPTION(
         nb_computed == 2, "[Test] Wrong number of computations" );
+
+    test_concurrent_computations();
 }
 
 OPENGEODE_TEST( "cached-value" )
\ No newline at end of file
@@ -22,6 +22,7 @@
  */
 
 #include <geode/basic/logger.h>
+#include <geode/basic/timer.h>
 
 #include <geode/geometry/aabb.h>
 #include <geode/geometry/distance.h>
@@ -30,6 +31,7 @@
 
 #include <geode/tests/common.h>
 
+#include <absl/algorithm/container.h>
 #include <absl/container/flat_hash_map.h>
 #include <absl/container/flat_hash_set.h>
 
@@ -75,16 +77,18 @@ geode::index_t global_box_index(
 }
 
 template < geode::index_t dimension >
-void test_build_aabb()
+void test_build_aabb( geode::index_t nb_boxes )
 {
     geode::Logger::info( "TEST", "Build AABB ", dimension, "D" );
-    const geode::index_t nb_boxes{ 100 };
     const double box_size{ 0.25 };
 
     // Create a grid of non overlapping boxes
     const auto box_vector =
         create_box_vector< dimension >( nb_boxes, box_size );
+    geode::Timer timer;
     const geode::AABBTree< dimension > aabb{ box_vector };
+    geode::Logger::info(
+        "AABB built on ", box_vector.size(), " boxes in ", timer.duration() );
 
     OPENGEODE_EXCEPTION( aabb.nb_bboxes() == box_vector.size(),
         "[Test] Build AABB - Wrong number of boxes in the tree" );
@@ -167,6 +171,137 @@ void test_nearest_neighbor_search()
     }
 }
 
+template < geode::index_t dimension >
+void test_batch_queries( geode::index_t nb_boxes )
+{
+    geode::Logger::info( "TEST", " Batch queries AABB ", dimension, "D" );
+    const double box_size{ 0.75 };
+    const auto box_vector =
+        create_box_vector< dimension >( nb_boxes, box_size );
+    const geode::AABBTree< dimension > aabb{ box_vector };
+    const BoxAABBEvalDistance< dimension > disteval{ box_vector };
+
+    std::vector< geode::Point< dimension > > queries;
+    queries.reserve( 4 * nb_boxes * nb_boxes );
+    for( const auto i : geode::Range{ 2 * nb_boxes } )
+    {
+        for( const auto j : geode::Range{ 2 * nb_boxes } )
+        {
+            geode::Point< dimension > query;
+            query.set_value( 0, i / 2. + 0.1 );
+            query.set_value( 1, j / 2. - 0.1 );
+            queries.push_back( query );
+        }
+    }
+
+    geode::Timer serial_timer;
+    std::vector< std::tuple< geode::index_t, geode::Point< dimension >,
+        double > >
+        serial_closest;
+    serial_closest.reserve( queries.size() );
+    std::vector< std::vector< geode::index_t > > serial_containing;
+    serial_containing.reserve( queries.size() );
+    for( const auto& query : queries )
+    {
+        serial_closest.push_back( aabb.closest_element_box( query, disteval ) );
+        serial_containing.push_back( aabb.containing_boxes( query ) );
+    }
+    geode::Logger::info( "Serial queries: ", serial_timer.duration() );
+
+    geode::Timer batch_timer;
+    const auto batch_closest = aabb.closest_element_boxes( queries, disteval );
+    const auto batch_containing = aabb.containing_boxes( queries );
+    geode::Logger::info( "Batch queries: ", batch_timer.duration() );
+
+    OPENGEODE_EXCEPTION( batch_containing.nb_queries() == queries.size(),
+        "[Test] Batch queries AABB - Wrong number of containing results" );
+    for( const auto q : geode::Indices{ queries } )
+    {
+        OPENGEODE_EXCEPTION(
+            std::get< 2 >( batch_closest[q] ) == std::get< 2 >(
+                serial_closest[q] ),
+            "[Test] Batch queries AABB - Wrong closest box distance" );
+        auto boxes = batch_containing.query_boxes( q );
+        std::vector< geode::index_t > sorted_boxes{ boxes.begin(),
+            boxes.end() };
+        absl::c_sort( sorted_boxes );
+        absl::c_sort( serial_containing[q] );
+        OPENGEODE_EXCEPTION( sorted_boxes == serial_containing[q],
+            "[Test] Batch queries AABB - Wrong containing boxes" );
+    }
+}
+
+template < geode::index_t dimension >
+void check_refitted_tree( const geode::AABBTree< dimension >& refitted,
+    absl::Span< const geode::BoundingBox< dimension > > box_vector )
+{
+    const geode::AABBTree< dimension > rebuilt{ box_vector };
+    OPENGEODE_EXCEPTION( refitted.bounding_box().min()
+                                 == rebuilt.bounding_box().min()
+                             && refitted.bounding_box().max()
+                                    == rebuilt.bounding_box().max(),
+        "[Test] Refit AABB - Wrong root bounding box" );
+    const BoxAABBEvalDistance< dimension > disteval{ box_vector };
+    for( const auto& box : box_vector )
+    {
+        geode::Point< dimension > query = ( box.min() + box.max() ) / 2.;
+        query.set_value( 0, query.value( 0 ) + 0.1 );
+        OPENGEODE_EXCEPTION(
+            std::get< 0 >( refitted.closest_element_box( query, disteval ) )
+                == std::get< 0 >( rebuilt.closest_element_box(
+                    query, disteval ) ),
+            "[Test] Refit AABB - Wrong closest box" );
+        auto refitted_boxes = refitted.containing_boxes( query );
+        auto rebuilt_boxes = rebuilt.containing_boxes( query );
+        absl::c_sort( refitted_boxes );
+        absl::c_sort( rebuilt_boxes );
+        OPENGEODE_EXCEPTION( refitted_boxes == rebuilt_boxes,
+            "[Test] Refit AABB - Wrong containing boxes" );
+    }
+}
+
+template < geode::index_t dimension >
+void test_refit()
+{
+    geode::Logger::info( "TEST", " Refit AABB ", dimension, "D" );
+    const geode::index_t nb_boxes{ 20 };
+    const double box_size{ 0.25 };
+    auto box_vector = create_box_vector< dimension >( nb_boxes, box_size );
+    geode::AABBTree< dimension > aabb{ box_vector };
+    OPENGEODE_EXCEPTION( aabb.refit_quality() == 1,
+        "[Test] Refit AABB - Wrong quality after construction" );
+
+    // Rigid translation: the hierarchy stays as good as when built
+    geode::Point< dimension > translation;
+    translation.set_value( 0, 3.5 );
+    translation.set_value( 1, -1.25 );
+    for( auto& box : box_vector )
+    {
+        box = create_bounding_box< dimension >(
+            ( box.min() + box.max() ) / 2. + translation, box_size );
+    }
+    aabb.refit( box_vector );
+    check_refitted_tree< dimension >( aabb, box_vector );
+    OPENGEODE_EXCEPTION( std::fabs( aabb.refit_quality() - 1 ) < 1e-6,
+        "[Test] Refit AABB - Wrong quality after translation" );
+
+    // Mirror the second coordinate of half the boxes: siblings drift apart
+    for( const auto b : geode::Indices{ box_vector } )
+    {
+        if( b % 2 == 0 )
+        {
+            continue;
+        }
+        auto center = ( box_vector[b].min() + box_vector[b].max() ) / 2.;
+        center.set_value( 1, nb_boxes - center.value( 1 ) );
+        box_vector[b] = create_bounding_box< dimension >( center, box_size );
+    }
+    aabb.refit( box_vector );
+    check_refitted_tree< dimension >( aabb, box_vector );
+    OPENGEODE_EXCEPTION( aabb.refit_quality() < 0.5,
+        "[Test] Refit AABB - Quality should advise a rebuild" );
+}
+
 template < geode::index_t dimension >
 class BoxAABBIntersection
 {
@@ -469,12 +604,22 @@ void test_other_intersections()
 template < geode::index_t dimension >
 void do_test()
 {
-    test_build_aabb< dimension >();
+#ifdef OPENGEODE_BENCHMARK
+    test_build_aabb< dimension >( 4000 );
+#else
+    test_build_aabb< dimension >( 100 );
+#endif
     test_nearest_neighbor_search< dimension >();
     test_intersections_with_query_box< dimension >();
     test_intersections_with_ray_trace< dimension >();
     test_self_intersections< dimension >();
     test_other_intersections< dimension >();
+    test_refit< dimension >();
+#ifdef OPENGEODE_BENCHMARK
+    test_batch_queries< dimension >( 1000 );
+#else
+    test_batch_queries< dimension >( 50 );
+#endif
 }
 
 void test()
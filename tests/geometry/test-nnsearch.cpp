@@ -23,10 +23,76 @@
 
 #include <geode/basic/logger.h>
 
+#include <geode/geometry/colocation.h>
 #include <geode/geometry/nn_search.h>
 
 #include <geode/tests/common.h>
 
+void test_colocated_index_mapping()
+{
+    // Each grid point is inserted three times: by rows, by columns and
+    // by rows again
+    const geode::index_t size{ 100 };
+    std::vector< geode::Point2D > points;
+    points.reserve( 3 * size * size );
+    for( const auto pass : geode::LRange{ 3 } )
+    {
+        for( const auto i : geode::Range{ size } )
+        {
+            for( const auto j : geode::Range{ size } )
+            {
+                if( pass == 1 )
+                {
+                    points.push_back( { { 1. * j, 1. * i } } );
+                }
+                else
+                {
+                    points.push_back( { { 1. * i, 1. * j } } );
+                }
+            }
+        }
+    }
+    const geode::NNSearch2D colocator{ points };
+    const auto colocated_info =
+        colocator.colocated_index_mapping( geode::global_epsilon );
+    OPENGEODE_EXCEPTION( colocated_info.nb_unique_points() == size * size,
+        "[Test] Wrong number of unique points" );
+    for( const auto p : geode::Indices{ points } )
+    {
+        const auto unique = colocated_info.colocated_mapping[p];
+        OPENGEODE_EXCEPTION( colocated_info.unique_points[unique] == points[p],
+            "[Test] Wrong colocated mapping" );
+        OPENGEODE_EXCEPTION( p >= size * size || unique == p,
+            "[Test] Unique points should keep their first occurrence order" );
+    }
+
+    const auto grid_info = geode::colocated_index_mapping(
+        points, geode::global_epsilon, geode::ColocationMethod::grid_hashing );
+    OPENGEODE_EXCEPTION(
+        grid_info.colocated_mapping == colocated_info.colocated_mapping,
+        "[Test] Grid hashing and NNSearch mappings should be identical" );
+    OPENGEODE_EXCEPTION(
+        grid_info.unique_points == colocated_info.unique_points,
+        "[Test] Grid hashing and NNSearch unique points should be "
+        "identical" );
+}
+
+void test_grid_hashing_overflow()
+{
+    const std::vector< geode::Point2D > points{ { { 0, 0 } }, { { 1e30, 0 } },
+        { { 1e30, 0 } }, { { 0, 0 } }, { { 1, 1 } } };
+    const auto grid_info = geode::colocated_index_mapping(
+        points, geode::global_epsilon, geode::ColocationMethod::grid_hashing );
+    const auto nn_info = geode::colocated_index_mapping(
+        points, geode::global_epsilon, geode::ColocationMethod::nn_search );
+    OPENGEODE_EXCEPTION( grid_info.nb_unique_points() == 3,
+        "[Test] Wrong number of unique points with large coordinates" );
+    OPENGEODE_EXCEPTION(
+        grid_info.colocated_mapping == nn_info.colocated_mapping,
+        "[Test] Grid hashing should fall back to NNSearch on large "
+        "coordinates" );
+}
+
 void test()
 {
     const geode::NNSearch2D search{ { { { 0.1, 4.2 } }, { { 5.9, 7.3 } },
@@ -47,6 +113,30 @@ void test()
         search.neighbors( { { -1, -1 } }, 2 ) == answer_neighbors,
         "[Test] Error in neighbors" );
 
+    const std::vector< geode::Point2D > queries{ { { 0, 0 } },
+        { { 1, -4 } }, { { -1, -1 } } };
+    const std::vector< geode::index_t > answer_closest{ 0, 2, 2 };
+    OPENGEODE_EXCEPTION( search.closest_neighbors( queries ) == answer_closest,
+        "[Test] Error in batch closest neighbors" );
+    const auto batch_radius = search.radius_neighbors( queries, 5.4 );
+    const auto batch_neighbors = search.neighbors( queries, 2 );
+    OPENGEODE_EXCEPTION( batch_radius.nb_queries() == queries.size()
+                             && batch_neighbors.nb_queries() == queries.size(),
+        "[Test] Error in batch number of queries" );
+    for( const auto q : geode::Indices{ queries } )
+    {
+        const auto radius = batch_radius.query_neighbors( q );
+        OPENGEODE_EXCEPTION(
+            std::vector< geode::index_t >( radius.begin(), radius.end() )
+                == search.radius_neighbors( queries[q], 5.4 ),
+            "[Test] Error in batch radius neighbors" );
+        const auto neighbors = batch_neighbors.query_neighbors( q );
+        OPENGEODE_EXCEPTION(
+            std::vector< geode::index_t >( neighbors.begin(), neighbors.end() )
+                == search.neighbors( queries[q], 2 ),
+            "[Test] Error in batch neighbors" );
+    }
+
     const geode::Point3D p0{ { 0.1, 2.9, 5.4 } };
     const geode::Point3D p1{ { 2.4, 8.1, 7.6 } };
     const geode::Point3D p2{ { 8.1, 4.2, 3.8 } };
@@ -63,6 +153,9 @@ void test()
     const std::vector< geode::Point3D > points_answer{ p0, p1, p2, p3 };
     OPENGEODE_EXCEPTION( colocated_info.unique_points == points_answer,
         "[Test] Error in unique points" );
+
+    test_colocated_index_mapping();
+    test_grid_hashing_overflow();
 }
 
 OPENGEODE_TEST( "nnsearch" )
\ No newline at end of file
@@ -27,9 +27,12 @@
  * Applications (ASGA)
  */
 
+#include <chrono>
+
 #include <geode/basic/logger.h>
 
 #include <geode/mesh/builder/triangulated_surface_builder.h>
+#include <geode/mesh/core/detail/mesh_points.h>
 #include <geode/mesh/core/triangulated_surface.h>
 #include <geode/mesh/helpers/aabb_surface_helpers.h>
 
@@ -145,11 +148,112 @@ void test_SurfaceAABB()
     check_surface_tree< dimension >( aabb_tree, distance_action, size );
 }
 
+template < geode::index_t dimension >
+void test_SurfaceAABB_refit()
+{
+    geode::Logger::info(
+        "TEST", " TriangulatedSurface AABB Helper refit", dimension, "D" );
+
+    auto t_surf = geode::TriangulatedSurface< dimension >::create();
+    auto t_surf_builder =
+        geode::TriangulatedSurfaceBuilder< dimension >::create( *t_surf );
+
+    geode::index_t size{ 10 };
+    add_vertices( *t_surf_builder, size );
+    add_triangles( *t_surf_builder, size );
+    auto aabb_tree = create_aabb_tree( *t_surf );
+
+    // Deform the surface by shearing and stretching it
+    for( const auto v : geode::Range{ t_surf->nb_vertices() } )
+    {
+        const auto& point = t_surf->point( v );
+        t_surf_builder->set_point(
+            v, create_vertex< dimension >(
+                   3 * point.value( 0 ) + point.value( 1 ), point.value( 1 ) ) );
+    }
+    geode::refit_aabb_tree( aabb_tree, *t_surf );
+    const auto rebuilt_tree = create_aabb_tree( *t_surf );
+    geode::DistanceToTriangle< dimension > distance_action( *t_surf );
+    for( const auto v : geode::Range{ t_surf->nb_vertices() } )
+    {
+        const auto query = t_surf->point( v )
+                           + create_vertex< dimension >( 0.1, 0.3 );
+        double refit_distance, rebuilt_distance;
+        std::tie( std::ignore, std::ignore, refit_distance ) =
+            aabb_tree.closest_element_box( query, distance_action );
+        std::tie( std::ignore, std::ignore, rebuilt_distance ) =
+            rebuilt_tree.closest_element_box( query, distance_action );
+        OPENGEODE_EXCEPTION( std::fabs( refit_distance - rebuilt_distance )
+                                 < geode::global_epsilon,
+            "[TEST] Wrong distance found after refit" );
+    }
+}
+
+template < geode::index_t dimension, typename Points >
+double sum_triangle_coordinates(
+    const geode::TriangulatedSurface< dimension >& mesh, const Points& points )
+{
+    double sum{ 0 };
+    for( const auto t : geode::Range{ mesh.nb_polygons() } )
+    {
+        for( const auto v : geode::LRange{ 3 } )
+        {
+            sum += points.point( mesh.polygon_vertex( { t, v } ) ).value( 0 );
+        }
+    }
+    return sum;
+}
+
+template < geode::index_t dimension >
+void test_mesh_points( geode::index_t size )
+{
+    auto t_surf = geode::TriangulatedSurface< dimension >::create();
+    auto t_surf_builder =
+        geode::TriangulatedSurfaceBuilder< dimension >::create( *t_surf );
+    add_vertices( *t_surf_builder, size );
+    add_triangles( *t_surf_builder, size );
+
+    const geode::detail::MeshPoints< dimension > points{ *t_surf };
+    OPENGEODE_EXCEPTION( points.is_contiguous(),
+        "[TEST] Points of the attribute CRS should be contiguous" );
+    for( const auto v : geode::Range{ t_surf->nb_vertices() } )
+    {
+        OPENGEODE_EXCEPTION( &points.point( v ) == &t_surf->point( v ),
+            "[TEST] Wrong point from the contiguous point storage" );
+    }
+
+    const auto crs_start = std::chrono::steady_clock::now();
+    const auto crs_sum = sum_triangle_coordinates( *t_surf, *t_surf );
+    const std::chrono::duration< double > crs_time =
+        std::chrono::steady_clock::now() - crs_start;
+    const auto span_start = std::chrono::steady_clock::now();
+    const auto span_sum = sum_triangle_coordinates( *t_surf, points );
+    const std::chrono::duration< double > span_time =
+        std::chrono::steady_clock::now() - span_start;
+    OPENGEODE_EXCEPTION(
+        crs_sum == span_sum, "[TEST] Wrong sum of triangle coordinates" );
+    const auto tree_start = std::chrono::steady_clock::now();
+    const auto tree = geode::create_aabb_tree( *t_surf );
+    const std::chrono::duration< double > tree_time =
+        std::chrono::steady_clock::now() - tree_start;
+    geode::Logger::info( "Triangle vertices ", dimension, "D (",
+        t_surf->nb_polygons(), " triangles): CRS ", crs_time.count(),
+        "s, contiguous points ", span_time.count(), "s, AABB tree ",
+        tree_time.count(), "s" );
+}
+
 void test()
 {
     geode::OpenGeodeMeshLibrary::initialize();
     test_SurfaceAABB< 2 >();
     test_SurfaceAABB< 3 >();
+    test_SurfaceAABB_refit< 2 >();
+    test_SurfaceAABB_refit< 3 >();
+#ifdef OPENGEODE_BENCHMARK
+    test_mesh_points< 3 >( 2000 );
+#else
+    test_mesh_points< 3 >( 100 );
+#endif
 }
 
 OPENGEODE_TEST( "aabb-triangulated-surfacce-helpers" )
@@ -30,6 +30,8 @@
 
 #include <geode/mesh/builder/tetrahedral_solid_builder.h>
 #include <geode/mesh/builder/triangulated_surface_builder.h>
+#include <geode/mesh/core/geode/geode_tetrahedral_solid_view.h>
+#include <geode/mesh/core/geode/geode_triangulated_surface_view.h>
 #include <geode/mesh/core/tetrahedral_solid.h>
 #include <geode/mesh/core/triangulated_surface.h>
 
@@ -103,9 +105,16 @@ void test()
     geode::Logger::info( "Test Surface" );
     const auto surface = create_surface();
     test_accessor( *surface );
+    geode::Logger::info( "Test Surface view" );
+    test_accessor( geode::TriangulatedSurfaceView2D{
+        dynamic_cast< const geode::OpenGeodeTriangulatedSurface2D& >(
+            *surface ) } );
     geode::Logger::info( "Test Solid" );
     const auto solid = create_solid();
     test_accessor( *solid );
+    geode::Logger::info( "Test Solid view" );
+    test_accessor( geode::TetrahedralSolidView3D{
+        dynamic_cast< const geode::OpenGeodeTetrahedralSolid3D& >( *solid ) } );
 }
 
 OPENGEODE_TEST( "generic-mesh-accessor" )
\ No newline at end of file
@@ -25,6 +25,7 @@
 
 #include <geode/basic/assert.h>
 #include <geode/basic/logger.h>
+#include <geode/basic/timer.h>
 
 #include <geode/geometry/point.h>
 
@@ -32,9 +33,8 @@
 #include <geode/mesh/core/surface_mesh.h>
 #include <geode/mesh/helpers/convert_surface_mesh.h>
 
-void test()
+void test_merge()
 {
-    geode::OpenGeodeMeshLibrary::initialize();
     std::vector< geode::Point2D > points{ { { 0, 0 } }, { { 0, 1 } },
         { { 0, 2 } }, { { 1, 0 } }, { { 1, 1 } }, { { 1, 2 } } };
 
@@ -107,6 +107,88 @@ void test()
         "[Test] Wrong adjacency for { 3, 1 }" );
     OPENGEODE_EXCEPTION( !merged->polygon_adjacent( { 3, 2 } ),
         "[Test] Wrong adjacency for { 3, 2 }" );
+
+    const auto grid_merged = geode::merge_surface_meshes< 2 >(
+        meshes, geode::ColocationMethod::grid_hashing );
+    OPENGEODE_EXCEPTION( grid_merged->nb_vertices() == 6,
+        "[Test] Wrong number of vertices with grid hashing" );
+    OPENGEODE_EXCEPTION( grid_merged->nb_polygons() == 4,
+        "[Test] Wrong number of polygons with grid hashing" );
+}
+
+std::unique_ptr< geode::SurfaceMesh2D > create_patch(
+    geode::index_t patch_i, geode::index_t patch_j, geode::index_t nb_cells )
+{
+    auto mesh = geode::SurfaceMesh2D::create();
+    auto builder = geode::SurfaceMeshBuilder2D::create( *mesh );
+    for( const auto i : geode::Range{ nb_cells + 1 } )
+    {
+        for( const auto j : geode::Range{ nb_cells + 1 } )
+        {
+            builder->create_point( { { 1. * ( patch_i * nb_cells + i ),
+                1. * ( patch_j * nb_cells + j ) } } );
+        }
+    }
+    for( const auto i : geode::Range{ nb_cells } )
+    {
+        for( const auto j : geode::Range{ nb_cells } )
+        {
+            const auto v0 = i * ( nb_cells + 1 ) + j;
+            const auto v1 = v0 + nb_cells + 1;
+            builder->create_polygon( { v0, v1, v1 + 1 } );
+            builder->create_polygon( { v0, v1 + 1, v0 + 1 } );
+        }
+    }
+    builder->compute_polygon_adjacencies();
+    return mesh;
+}
+
+void test_merge_patches( geode::index_t nb_patches, geode::index_t nb_cells )
+{
+    std::vector< std::unique_ptr< geode::SurfaceMesh2D > > patches;
+    std::vector< std::reference_wrapper< const geode::SurfaceMesh2D > >
+        meshes;
+    for( const auto i : geode::Range{ nb_patches } )
+    {
+        for( const auto j : geode::Range{ nb_patches } )
+        {
+            patches.emplace_back( create_patch( i, j, nb_cells ) );
+            meshes.emplace_back( *patches.back() );
+        }
+    }
+    const auto nb_vertices =
+        ( nb_patches * nb_cells + 1 ) * ( nb_patches * nb_cells + 1 );
+    const auto nb_polygons =
+        2 * nb_patches * nb_patches * nb_cells * nb_cells;
+
+    geode::Timer timer;
+    const auto nn_merged = geode::merge_surface_meshes< 2 >(
+        meshes, geode::ColocationMethod::nn_search );
+    geode::Logger::info( "Merge ", meshes.size(),
+        " patches with NNSearch: ", timer.duration() );
+    timer.reset();
+    const auto grid_merged = geode::merge_surface_meshes< 2 >(
+        meshes, geode::ColocationMethod::grid_hashing );
+    geode::Logger::info( "Merge ", meshes.size(),
+        " patches with grid hashing: ", timer.duration() );
+
+    OPENGEODE_EXCEPTION( nn_merged->nb_vertices() == nb_vertices
+                             && grid_merged->nb_vertices() == nb_vertices,
+        "[Test] Wrong number of vertices in merged patches" );
+    OPENGEODE_EXCEPTION( nn_merged->nb_polygons() == nb_polygons
+                             && grid_merged->nb_polygons() == nb_polygons,
+        "[Test] Wrong number of polygons in merged patches" );
+}
+
+void test()
+{
+    geode::OpenGeodeMeshLibrary::initialize();
+    test_merge();
+#ifdef OPENGEODE_BENCHMARK
+    test_merge_patches( 40, 50 );
+#else
+    test_merge_patches( 4, 10 );
+#endif
 }
 
 OPENGEODE_TEST( "merge-surface" )
\ No newline at end of file
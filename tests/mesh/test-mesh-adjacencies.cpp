@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2019 - 2023 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/tests/common.h>
+
+#include <geode/basic/assert.h>
+#include <geode/basic/logger.h>
+#include <geode/basic/timer.h>
+
+#include <geode/geometry/point.h>
+
+#include <geode/mesh/builder/tetrahedral_solid_builder.h>
+#include <geode/mesh/builder/triangulated_surface_builder.h>
+#include <geode/mesh/core/tetrahedral_solid.h>
+#include <geode/mesh/core/triangulated_surface.h>
+
+void test_grid_adjacencies( geode::index_t size )
+{
+    auto surface = geode::TriangulatedSurface3D::create();
+    auto builder = geode::TriangulatedSurfaceBuilder3D::create( *surface );
+    builder->create_vertices( ( size + 1 ) * ( size + 1 ) );
+    builder->reserve_triangles( 2 * size * size );
+    for( const auto i : geode::Range{ size } )
+    {
+        for( const auto j : geode::Range{ size } )
+        {
+            const auto v0 = i * ( size + 1 ) + j;
+            const auto v1 = v0 + size + 1;
+            builder->create_triangle( { v0, v1, v1 + 1 } );
+            builder->create_triangle( { v0, v1 + 1, v0 + 1 } );
+        }
+    }
+    geode::Timer timer;
+    builder->compute_polygon_adjacencies();
+    geode::Logger::info( "Adjacencies of ", surface->nb_polygons(),
+        " triangles computed in ", timer.duration() );
+
+    geode::index_t nb_borders{ 0 };
+    for( const auto t : geode::Range{ surface->nb_polygons() } )
+    {
+        for( const auto e : geode::LRange{ 3 } )
+        {
+            const geode::PolygonEdge edge{ t, e };
+            const auto adjacent = surface->polygon_adjacent_edge( edge );
+            if( !adjacent )
+            {
+                nb_borders++;
+                continue;
+            }
+            OPENGEODE_EXCEPTION(
+                surface->polygon_adjacent( adjacent.value() ) == t,
+                "[Test] Wrong adjacency of triangle ", t );
+        }
+    }
+    OPENGEODE_EXCEPTION( nb_borders == 4 * size,
+        "[Test] Wrong number of border edges" );
+}
+
+void test_non_manifold_surface()
+{
+    auto surface = geode::TriangulatedSurface3D::create();
+    auto builder = geode::TriangulatedSurfaceBuilder3D::create( *surface );
+    builder->create_vertices( 6 );
+    builder->create_triangle( { 0, 1, 2 } );
+    builder->create_triangle( { 0, 2, 3 } );
+    builder->create_triangle( { 0, 2, 4 } );
+    builder->create_triangle( { 1, 5, 2 } );
+    builder->compute_polygon_adjacencies();
+
+    OPENGEODE_EXCEPTION( surface->polygon_adjacent( { 0, 1 } ) == 3
+                             && surface->polygon_adjacent( { 3, 2 } ) == 0,
+        "[Test] Manifold edge should be connected" );
+    OPENGEODE_EXCEPTION( surface->is_edge_on_border( { 0, 2 } )
+                             && surface->is_edge_on_border( { 1, 0 } )
+                             && surface->is_edge_on_border( { 2, 0 } ),
+        "[Test] Non-manifold edge should stay on border" );
+
+    auto subset = geode::TriangulatedSurface3D::create();
+    auto subset_builder =
+        geode::TriangulatedSurfaceBuilder3D::create( *subset );
+    subset_builder->create_vertices( 4 );
+    subset_builder->create_triangle( { 0, 1, 2 } );
+    subset_builder->create_triangle( { 0, 2, 3 } );
+    subset_builder->create_triangle( { 1, 3, 2 } );
+    const std::array< geode::index_t, 2 > polygons{ 0, 2 };
+    subset_builder->compute_polygon_adjacencies( polygons );
+    OPENGEODE_EXCEPTION( subset->polygon_adjacent( { 0, 1 } ) == 2
+                             && subset->polygon_adjacent( { 2, 2 } ) == 0,
+        "[Test] Wrong adjacency between given triangles" );
+    OPENGEODE_EXCEPTION( subset->is_edge_on_border( { 0, 2 } )
+                             && subset->is_edge_on_border( { 1, 0 } )
+                             && subset->is_edge_on_border( { 2, 1 } ),
+        "[Test] Triangle not given should stay disconnected" );
+}
+
+void test_solid_adjacencies()
+{
+    auto solid = geode::TetrahedralSolid3D::create();
+    auto builder = geode::TetrahedralSolidBuilder3D::create( *solid );
+    builder->create_vertices( 7 );
+    builder->create_tetrahedron( { 0, 1, 2, 3 } );
+    builder->create_tetrahedron( { 1, 2, 3, 4 } );
+    builder->create_tetrahedron( { 1, 2, 3, 5 } );
+    builder->create_tetrahedron( { 1, 4, 3, 6 } );
+    builder->compute_polyhedron_adjacencies();
+
+    OPENGEODE_EXCEPTION( solid->polyhedron_adjacent( { 0, 0 } ) == 1
+                             && solid->polyhedron_adjacent( { 1, 3 } ) == 0,
+        "[Test] First tetrahedra sharing a facet should be connected" );
+    OPENGEODE_EXCEPTION( solid->is_polyhedron_facet_on_border( { 2, 3 } ),
+        "[Test] Third tetrahedron sharing a facet should stay on border" );
+    OPENGEODE_EXCEPTION( solid->polyhedron_adjacent( { 1, 1 } ) == 3
+                             && solid->polyhedron_adjacent( { 3, 3 } ) == 1,
+        "[Test] Wrong adjacency between tetrahedra 1 and 3" );
+    geode::index_t nb_borders{ 0 };
+    for( const auto t : geode::Range{ solid->nb_polyhedra() } )
+    {
+        for( const auto f : geode::LRange{ 4 } )
+        {
+            if( solid->is_polyhedron_facet_on_border( { t, f } ) )
+            {
+                nb_borders++;
+            }
+        }
+    }
+    OPENGEODE_EXCEPTION(
+        nb_borders == 12, "[Test] Wrong number of border facets" );
+}
+
+void test()
+{
+    geode::OpenGeodeMeshLibrary::initialize();
+#ifdef OPENGEODE_BENCHMARK
+    test_grid_adjacencies( 2237 );
+#else
+    test_grid_adjacencies( 100 );
+#endif
+    test_non_manifold_surface();
+    test_solid_adjacencies();
+}
+
+OPENGEODE_TEST( "mesh-adjacencies" )
@@ -21,8 +21,11 @@
  *
  */
 
+#include <chrono>
+
 #include <geode/basic/assert.h>
 #include <geode/basic/logger.h>
+#include <geode/basic/range.h>
 
 #include <geode/geometry/aabb.h>
 
@@ -111,12 +114,114 @@ void test_ray_parallel()
         result->distance == 1, "[Test] Ray edge wrong distance" );
 }
 
+std::unique_ptr< geode::SurfaceMesh3D > create_grid_planes(
+    geode::index_t size )
+{
+    auto mesh = geode::SurfaceMesh3D::create();
+    auto builder = geode::SurfaceMeshBuilder3D::create( *mesh );
+    for( const auto plane : geode::Range{ 2 } )
+    {
+        const auto offset = mesh->nb_vertices();
+        for( const auto j : geode::Range{ size + 1 } )
+        {
+            for( const auto i : geode::Range{ size + 1 } )
+            {
+                builder->create_point(
+                    { { static_cast< double >( i ), static_cast< double >( j ),
+                        1. + plane + 0.01 * i } } );
+            }
+        }
+        for( const auto j : geode::Range{ size } )
+        {
+            for( const auto i : geode::Range{ size } )
+            {
+                const auto v0 = offset + j * ( size + 1 ) + i;
+                const auto v1 = v0 + 1;
+                const auto v2 = v0 + size + 1;
+                const auto v3 = v2 + 1;
+                builder->create_polygon( { v0, v1, v3 } );
+                builder->create_polygon( { v0, v3, v2 } );
+            }
+        }
+    }
+    return mesh;
+}
+
+void test_ray_packet()
+{
+#ifdef OPENGEODE_BENCHMARK
+    const geode::index_t size{ 300 };
+#else
+    const geode::index_t size{ 20 };
+#endif
+    const auto mesh = create_grid_planes( size );
+    const auto aabb = geode::create_aabb_tree( *mesh );
+    std::vector< geode::Point3D > origins;
+    std::vector< geode::Ray3D > rays;
+    origins.reserve( size * size );
+    rays.reserve( size * size );
+    for( const auto j : geode::Range{ size } )
+    {
+        for( const auto i : geode::Range{ size } )
+        {
+            origins.emplace_back( geode::Point3D{ { i + 0.31, j + 0.27, 0 } } );
+        }
+    }
+    for( const auto r : geode::Indices{ origins } )
+    {
+        const geode::Vector3D direction{ { 0.05, 0.02, r % 7 == 0 ? -1 : 1 } };
+        rays.emplace_back( direction, origins[r] );
+    }
+
+    const geode::RayPacketTracing3D packet_tracing{ *mesh, aabb };
+    const auto packet_start = std::chrono::steady_clock::now();
+    const auto result = packet_tracing.closest_polygons( rays );
+    const std::chrono::duration< double > packet_time =
+        std::chrono::steady_clock::now() - packet_start;
+
+    std::vector< absl::optional< geode::RayTracing3D::PolygonDistance > >
+        closests;
+    closests.reserve( rays.size() );
+    const auto single_start = std::chrono::steady_clock::now();
+    for( const auto& ray : rays )
+    {
+        geode::RayTracing3D tracing{ *mesh, ray };
+        aabb.compute_ray_element_bbox_intersections( ray, tracing );
+        closests.emplace_back( tracing.closest_polygon() );
+    }
+    const std::chrono::duration< double > single_time =
+        std::chrono::steady_clock::now() - single_start;
+
+    for( const auto r : geode::Indices{ rays } )
+    {
+        const auto& closest = closests[r];
+        if( !closest )
+        {
+            OPENGEODE_EXCEPTION( result.polygons[r] == geode::NO_ID,
+                "[Test] Ray packet should not find an intersection" );
+            continue;
+        }
+        OPENGEODE_EXCEPTION( result.polygons[r] == closest->polygon,
+            "[Test] Ray packet wrong polygon" );
+        OPENGEODE_EXCEPTION(
+            std::fabs( result.distances[r] - closest->distance )
+                < geode::global_epsilon,
+            "[Test] Ray packet wrong distance" );
+        OPENGEODE_EXCEPTION(
+            result.points[r].inexact_equal( closest->point ),
+            "[Test] Ray packet wrong point" );
+    }
+    geode::Logger::info( "Traced ", rays.size(), " rays: packets ",
+        packet_time.count(), "s, one by one ", single_time.count(), "s" );
+}
+
 void test()
 {
     geode::OpenGeodeMeshLibrary::initialize();
     test_ray_inside();
     test_ray_edge();
     test_ray_parallel();
+    test_ray_packet();
 }
 
 OPENGEODE_TEST( "ray-tracing" )
\ No newline at end of file
@@ -21,6 +21,10 @@
  *
  */
 
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+
 #include <geode/basic/attribute_manager.h>
 #include <geode/basic/logger.h>
 
@@ -34,6 +38,7 @@
 #include <geode/mesh/core/geode/geode_tetrahedral_solid.h>
 #include <geode/mesh/core/solid_edges.h>
 #include <geode/mesh/core/solid_facets.h>
+#include <geode/mesh/io/geode/geode_tetrahedral_solid_input.h>
 #include <geode/mesh/io/tetrahedral_solid_input.h>
 #include <geode/mesh/io/tetrahedral_solid_output.h>
 
@@ -339,6 +344,121 @@ void test_delete_all( const geode::TetrahedralSolid3D& solid,
         "[Test] TetrahedralSolid should have 0 vertex" );
 }
 
+double load_throughput( geode::TetrahedralSolid3D& solid,
+    const std::string& filename,
+    bool mapped )
+{
+    auto& native = dynamic_cast< geode::OpenGeodeTetrahedralSolid3D& >( solid );
+    const auto start = std::chrono::steady_clock::now();
+    if( mapped )
+    {
+        geode::detail::read_native_mesh_file( native, filename );
+    }
+    else
+    {
+        std::ifstream file{ filename, std::ifstream::binary };
+        geode::detail::read_native_mesh( native, file, filename );
+    }
+    const std::chrono::duration< double > duration =
+        std::chrono::steady_clock::now() - start;
+    std::ifstream file{ filename, std::ifstream::binary | std::ifstream::ate };
+    return static_cast< double >( file.tellg() ) / duration.count() / 1e9;
+}
+
+void test_load_throughput( geode::index_t size )
+{
+    auto solid = geode::TetrahedralSolid3D::create(
+        geode::OpenGeodeTetrahedralSolid3D::impl_name_static() );
+    auto builder = geode::TetrahedralSolidBuilder3D::create( *solid );
+    const auto nb_vertices_per_side = size + 1;
+    builder->create_vertices(
+        nb_vertices_per_side * nb_vertices_per_side * nb_vertices_per_side );
+    for( const auto v : geode::Range{ solid->nb_vertices() } )
+    {
+        builder->set_point( v,
+            geode::Point3D{
+                { static_cast< double >( v % nb_vertices_per_side ),
+                    static_cast< double >(
+                        ( v / nb_vertices_per_side ) % nb_vertices_per_side ),
+                    static_cast< double >( v / nb_vertices_per_side
+                                           / nb_vertices_per_side ) } } );
+    }
+    // Kuhn subdivision of each cube in 6 tetrahedra
+    static constexpr std::array< std::array< geode::index_t, 4 >, 6 > kuhn{ {
+        { 0, 1, 3, 7 },
+        { 0, 5, 1, 7 },
+        { 0, 3, 2, 7 },
+        { 0, 2, 6, 7 },
+        { 0, 4, 5, 7 },
+        { 0, 6, 4, 7 },
+    } };
+    builder->reserve_tetrahedra( 6 * size * size * size );
+    for( const auto k : geode::Range{ size } )
+    {
+        for( const auto j : geode::Range{ size } )
+        {
+            for( const auto i : geode::Range{ size } )
+            {
+                std::array< geode::index_t, 8 > cube;
+                for( const auto c : geode::LRange{ 8 } )
+                {
+                    cube[c] = ( i + ( c & 1 ) )
+                              + ( j + ( ( c >> 1 ) & 1 ) )
+                                    * nb_vertices_per_side
+                              + ( k + ( ( c >> 2 ) & 1 ) )
+                                    * nb_vertices_per_side
+                                    * nb_vertices_per_side;
+                }
+                for( const auto& tetrahedron : kuhn )
+                {
+                    builder->create_tetrahedron(
+                        { cube[tetrahedron[0]], cube[tetrahedron[1]],
+                            cube[tetrahedron[2]], cube[tetrahedron[3]] } );
+                }
+            }
+        }
+    }
+    builder->compute_polyhedron_adjacencies();
+    const auto filename =
+        absl::StrCat( "throughput.", solid->native_extension() );
+    geode::save_tetrahedral_solid( *solid, filename );
+
+    auto stream_solid = geode::TetrahedralSolid3D::create(
+        geode::OpenGeodeTetrahedralSolid3D::impl_name_static() );
+    const auto stream_speed = load_throughput( *stream_solid, filename, false );
+    auto mapped_solid = geode::TetrahedralSolid3D::create(
+        geode::OpenGeodeTetrahedralSolid3D::impl_name_static() );
+    const auto mapped_speed = load_throughput( *mapped_solid, filename, true );
+    geode::Logger::info( "Load ", solid->nb_polyhedra(),
+        " tetrahedra: stream ", stream_speed, " GB/s, mapped ", mapped_speed,
+        " GB/s" );
+    std::remove( filename.c_str() );
+
+    OPENGEODE_EXCEPTION(
+        mapped_solid->nb_vertices() == stream_solid->nb_vertices()
+            && mapped_solid->nb_polyhedra() == stream_solid->nb_polyhedra(),
+        "[Test] Mapped and stream loadings should give the same mesh" );
+    for( const auto t : geode::Range{ solid->nb_polyhedra() } )
+    {
+        for( const auto f : geode::LRange{ 4 } )
+        {
+            const geode::PolyhedronFacet facet{ t, f };
+            OPENGEODE_EXCEPTION( mapped_solid->polyhedron_adjacent( facet )
+                                     == solid->polyhedron_adjacent( facet ),
+                "[Test] Wrong mapped polyhedron adjacent ", t );
+            OPENGEODE_EXCEPTION( mapped_solid->polyhedron_vertex( { t, f } )
+                                     == solid->polyhedron_vertex( { t, f } ),
+                "[Test] Wrong mapped polyhedron vertex ", t );
+        }
+    }
+    for( const auto v : geode::Range{ solid->nb_vertices() } )
+    {
+        OPENGEODE_EXCEPTION(
+            mapped_solid->point( v ).inexact_equal( solid->point( v ) ),
+            "[Test] Wrong mapped point ", v );
+    }
+}
+
 void test()
 {
     geode::OpenGeodeMeshLibrary::initialize();
@@ -357,6 +477,11 @@ void test()
     test_delete_polyhedron( *solid, *builder );
     test_clone( *solid );
     test_delete_all( *solid, *builder );
+#ifdef OPENGEODE_BENCHMARK
+    test_load_throughput( 150 );
+#else
+    test_load_throughput( 10 );
+#endif
 }
 
 OPENGEODE_TEST( "tetrahedral-solid" )
\ No newline at end of file
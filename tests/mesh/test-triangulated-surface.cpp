@@ -21,6 +21,10 @@
  *
  */
 
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+
 #include <geode/basic/attribute_manager.h>
 #include <geode/basic/logger.h>
 
@@ -30,6 +34,7 @@
 #include <geode/mesh/builder/surface_edges_builder.h>
 #include <geode/mesh/core/geode/geode_triangulated_surface.h>
 #include <geode/mesh/core/surface_edges.h>
+#include <geode/mesh/io/geode/geode_triangulated_surface_input.h>
 #include <geode/mesh/io/triangulated_surface_input.h>
 #include <geode/mesh/io/triangulated_surface_output.h>
 
@@ -197,6 +202,145 @@ void test_io(
     }
 }
 
+void test_attribute_filter(
+    const geode::TriangulatedSurface3D& surface, absl::string_view filename )
+{
+    auto& manager = surface.vertex_attribute_manager();
+    manager.find_or_create_attribute< geode::VariableAttribute, double >(
+        "kept", 1 );
+    manager.find_or_create_attribute< geode::VariableAttribute, double >(
+        "skipped", 2 );
+    geode::OutputOptions options;
+    options.attribute_layout = geode::AttributeSerializationLayout::columnar;
+    geode::save_triangulated_surface( surface, filename, options );
+
+    const std::vector< std::string > names{ "kept" };
+    const auto only = geode::load_triangulated_surface< 3 >(
+        filename, geode::AttributeFilter::load_only( names ) );
+    OPENGEODE_EXCEPTION(
+        only->vertex_attribute_manager().attribute_exists( "kept" )
+            && !only->vertex_attribute_manager().attribute_exists( "skipped" ),
+        "[Test] Wrong attributes loaded with a load_only filter" );
+    OPENGEODE_EXCEPTION( only->nb_polygons() == surface.nb_polygons()
+                             && only->nb_vertices() == surface.nb_vertices(),
+        "[Test] Wrong mesh loaded with a load_only filter" );
+    for( const auto vertex_id : geode::Range{ surface.nb_vertices() } )
+    {
+        OPENGEODE_EXCEPTION( surface.point( vertex_id )
+                                 .inexact_equal( only->point( vertex_id ) ),
+            "[Test] Wrong mesh points loaded with a load_only filter" );
+    }
+    OPENGEODE_EXCEPTION(
+        only->polygon_attribute_manager().is_attribute_structural(
+            "triangle_vertices" )
+            && !only->vertex_attribute_manager().is_attribute_structural(
+                "kept" ),
+        "[Test] Wrong structural attributes" );
+
+    const auto skip = geode::load_triangulated_surface< 3 >(
+        filename, geode::AttributeFilter::skip( names ) );
+    OPENGEODE_EXCEPTION(
+        !skip->vertex_attribute_manager().attribute_exists( "kept" )
+            && skip->vertex_attribute_manager().attribute_exists( "skipped" ),
+        "[Test] Wrong attributes loaded with a skip filter" );
+    OPENGEODE_EXCEPTION( skip->nb_polygons() == surface.nb_polygons(),
+        "[Test] Wrong mesh loaded with a skip filter" );
+
+    manager.delete_attribute( "kept" );
+    manager.delete_attribute( "skipped" );
+}
+
+double load_throughput( geode::TriangulatedSurface3D& surface,
+    const std::string& filename,
+    bool mapped )
+{
+    auto& native =
+        dynamic_cast< geode::OpenGeodeTriangulatedSurface3D& >( surface );
+    const auto start = std::chrono::steady_clock::now();
+    if( mapped )
+    {
+        geode::detail::read_native_mesh_file( native, filename );
+    }
+    else
+    {
+        std::ifstream file{ filename, std::ifstream::binary };
+        geode::detail::read_native_mesh( native, file, filename );
+    }
+    const std::chrono::duration< double > duration =
+        std::chrono::steady_clock::now() - start;
+    std::ifstream file{ filename, std::ifstream::binary | std::ifstream::ate };
+    return static_cast< double >( file.tellg() ) / duration.count() / 1e9;
+}
+
+void test_load_throughput( geode::index_t size )
+{
+    auto surface = geode::TriangulatedSurface3D::create(
+        geode::OpenGeodeTriangulatedSurface3D::impl_name_static() );
+    auto builder = geode::TriangulatedSurfaceBuilder3D::create( *surface );
+    builder->create_vertices( ( size + 1 ) * ( size + 1 ) );
+    builder->reserve_triangles( 2 * size * size );
+    for( const auto i : geode::Range{ size + 1 } )
+    {
+        for( const auto j : geode::Range{ size + 1 } )
+        {
+            builder->set_point( i * ( size + 1 ) + j,
+                geode::Point3D{ { static_cast< double >( i ),
+                    static_cast< double >( j ), 0. } } );
+        }
+    }
+    for( const auto i : geode::Range{ size } )
+    {
+        for( const auto j : geode::Range{ size } )
+        {
+            const auto v0 = i * ( size + 1 ) + j;
+            const auto v1 = v0 + size + 1;
+            builder->create_triangle( { v0, v1, v1 + 1 } );
+            builder->create_triangle( { v0, v1 + 1, v0 + 1 } );
+        }
+    }
+    builder->compute_polygon_adjacencies();
+    const auto filename =
+        absl::StrCat( "throughput.", surface->native_extension() );
+    geode::save_triangulated_surface( *surface, filename );
+
+    auto stream_surface = geode::TriangulatedSurface3D::create(
+        geode::OpenGeodeTriangulatedSurface3D::impl_name_static() );
+    const auto stream_speed =
+        load_throughput( *stream_surface, filename, false );
+    auto mapped_surface = geode::TriangulatedSurface3D::create(
+        geode::OpenGeodeTriangulatedSurface3D::impl_name_static() );
+    const auto mapped_speed =
+        load_throughput( *mapped_surface, filename, true );
+    geode::Logger::info( "Load ", surface->nb_polygons(),
+        " triangles: stream ", stream_speed, " GB/s, mapped ", mapped_speed,
+        " GB/s" );
+    std::remove( filename.c_str() );
+
+    OPENGEODE_EXCEPTION(
+        mapped_surface->nb_vertices() == stream_surface->nb_vertices()
+            && mapped_surface->nb_polygons() == stream_surface->nb_polygons(),
+        "[Test] Mapped and stream loadings should give the same mesh" );
+    for( const auto t : geode::Range{ surface->nb_polygons() } )
+    {
+        for( const auto e : geode::LRange{ 3 } )
+        {
+            const geode::PolygonEdge edge{ t, e };
+            OPENGEODE_EXCEPTION( mapped_surface->polygon_vertex( edge )
+                                     == surface->polygon_vertex( edge ),
+                "[Test] Wrong mapped polygon vertex ", t );
+            OPENGEODE_EXCEPTION( mapped_surface->polygon_adjacent( edge )
+                                     == surface->polygon_adjacent( edge ),
+                "[Test] Wrong mapped polygon adjacent ", t );
+        }
+    }
+    for( const auto v : geode::Range{ surface->nb_vertices() } )
+    {
+        OPENGEODE_EXCEPTION(
+            mapped_surface->point( v ).inexact_equal( surface->point( v ) ),
+            "[Test] Wrong mapped point ", v );
+    }
+}
+
 void test_clone( const geode::TriangulatedSurface3D& surface )
 {
     auto attr_from = surface.edges()
@@ -267,10 +411,17 @@ void test()
     test_create_polygons( *surface, *builder );
     test_polygon_adjacencies( *surface, *builder );
     test_io( *surface, absl::StrCat( "test.", surface->native_extension() ) );
+    test_attribute_filter( *surface,
+        absl::StrCat( "filter.", surface->native_extension() ) );
 
     test_permutation( *surface, *builder );
     test_delete_polygon( *surface, *builder );
     test_clone( *surface );
+#ifdef OPENGEODE_BENCHMARK
+    test_load_throughput( 2000 );
+#else
+    test_load_throughput( 50 );
+#endif
 }
 
 OPENGEODE_TEST( "triangulated-surface" )
\ No newline at end of file
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2019 - 2023 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/tests/common.h>
+
+#include <geode/basic/assert.h>
+#include <geode/basic/logger.h>
+#include <geode/basic/timer.h>
+
+#include <geode/geometry/point.h>
+
+#include <geode/mesh/builder/tetrahedral_solid_builder.h>
+#include <geode/mesh/builder/triangulated_surface_builder.h>
+#include <geode/mesh/core/tetrahedral_solid.h>
+#include <geode/mesh/core/triangulated_surface.h>
+#include <geode/mesh/helpers/vertex_incidence.h>
+
+#include <absl/algorithm/container.h>
+
+std::unique_ptr< geode::TriangulatedSurface3D > create_surface(
+    geode::index_t size )
+{
+    auto surface = geode::TriangulatedSurface3D::create();
+    auto builder = geode::TriangulatedSurfaceBuilder3D::create( *surface );
+    builder->create_vertices( ( size + 1 ) * ( size + 1 ) );
+    for( const auto i : geode::Range{ size + 1 } )
+    {
+        for( const auto j : geode::Range{ size + 1 } )
+        {
+            builder->set_point(
+                i * ( size + 1 ) + j, { { 1. * i, 1. * j, 0 } } );
+        }
+    }
+    builder->reserve_triangles( 2 * size * size );
+    for( const auto i : geode::Range{ size } )
+    {
+        for( const auto j : geode::Range{ size } )
+        {
+            const auto v0 = i * ( size + 1 ) + j;
+            const auto v1 = v0 + size + 1;
+            builder->create_triangle( { v0, v1, v1 + 1 } );
+            builder->create_triangle( { v0, v1 + 1, v0 + 1 } );
+        }
+    }
+    builder->compute_polygon_adjacencies();
+    return surface;
+}
+
+void test_surface_incidence( geode::index_t size )
+{
+    const auto surface = create_surface( size );
+    geode::Logger::info(
+        "Surface with ", surface->nb_polygons(), " triangles" );
+
+    geode::Timer timer;
+    const geode::SurfaceVertexIncidence3D incidence{ *surface };
+    geode::Logger::info( "CSR incidence built in ", timer.duration(), " (",
+        ( ( incidence.nb_vertices() + 1 ) * sizeof( geode::index_t )
+            + 3 * surface->nb_polygons() * sizeof( geode::PolygonVertex ) )
+            / 1024 / 1024,
+        " MB)" );
+
+    timer.reset();
+    geode::index_t nb_incidences{ 0 };
+    // Cached polygons are stored by value in a vertex attribute, they only
+    // allocate when they exceed the inlined capacity
+    std::size_t cache_bytes{ surface->nb_vertices()
+                             * sizeof( geode::PolygonsAroundVertex ) };
+    const auto inlined_capacity = geode::PolygonsAroundVertex{}.capacity();
+    for( const auto v : geode::Range{ surface->nb_vertices() } )
+    {
+        const auto& polygons = surface->polygons_around_vertex( v );
+        nb_incidences += polygons.size();
+        if( polygons.capacity() > inlined_capacity )
+        {
+            cache_bytes +=
+                polygons.capacity() * sizeof( geode::PolygonVertex );
+        }
+    }
+    geode::Logger::info( "Around vertex cache computed in ", timer.duration(),
+        " (", cache_bytes / 1024 / 1024, " MB)" );
+    OPENGEODE_EXCEPTION( nb_incidences == 3 * surface->nb_polygons(),
+        "[Test] Wrong number of polygons around vertices" );
+
+    OPENGEODE_EXCEPTION( incidence.nb_vertices() == surface->nb_vertices(),
+        "[Test] Wrong number of vertices in incidence" );
+    for( const auto v : geode::Range{ surface->nb_vertices() } )
+    {
+        auto expected = surface->polygons_around_vertex( v );
+        absl::c_sort( expected );
+        const auto polygons = incidence.polygons_around_vertex( v );
+        OPENGEODE_EXCEPTION( absl::c_equal( polygons, expected ),
+            "[Test] Wrong polygons around vertex ", v );
+    }
+}
+
+void test_solid_incidence()
+{
+    auto solid = geode::TetrahedralSolid3D::create();
+    auto builder = geode::TetrahedralSolidBuilder3D::create( *solid );
+    builder->create_point( { { 0.1, 0.2, 0.3 } } );
+    builder->create_point( { { 2.1, 9.4, 6.7 } } );
+    builder->create_point( { { 7.5, 5.2, 6.3 } } );
+    builder->create_point( { { 8.1, 1.4, 4.7 } } );
+    builder->create_point( { { 4.7, 2.1, 1.3 } } );
+    builder->create_point( { { 1.6, 8.7, 6.1 } } );
+    builder->create_tetrahedron( { 0, 1, 2, 3 } );
+    builder->create_tetrahedron( { 1, 2, 3, 4 } );
+    builder->create_tetrahedron( { 1, 4, 3, 5 } );
+    builder->compute_polyhedron_adjacencies();
+
+    const geode::SolidVertexIncidence3D incidence{ *solid };
+    OPENGEODE_EXCEPTION( incidence.nb_vertices() == solid->nb_vertices(),
+        "[Test] Wrong number of vertices in incidence" );
+    for( const auto v : geode::Range{ solid->nb_vertices() } )
+    {
+        auto expected = solid->polyhedra_around_vertex( v );
+        absl::c_sort( expected );
+        const auto polyhedra = incidence.polyhedra_around_vertex( v );
+        OPENGEODE_EXCEPTION( absl::c_equal( polyhedra, expected ),
+            "[Test] Wrong polyhedra around vertex ", v );
+    }
+}
+
+void test()
+{
+    geode::OpenGeodeMeshLibrary::initialize();
+#ifdef OPENGEODE_BENCHMARK
+    test_surface_incidence( 2237 );
+#else
+    test_surface_incidence( 30 );
+#endif
+    test_solid_incidence();
+}
+
+OPENGEODE_TEST( "vertex-incidence" )
@@ -0,0 +1,263 @@
+/*
+ * Copyright (c) 2019 - 2023 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <chrono>
+
+#include <geode/basic/assert.h>
+#include <geode/basic/logger.h>
+#include <geode/basic/range.h>
+
+#include <geode/geometry/bounding_box.h>
+#include <geode/geometry/point.h>
+#include <geode/geometry/vector.h>
+
+#include <geode/mesh/builder/tetrahedral_solid_builder.h>
+#include <geode/mesh/builder/triangulated_surface_builder.h>
+#include <geode/mesh/core/geode/geode_tetrahedral_solid.h>
+#include <geode/mesh/core/geode/geode_triangulated_surface.h>
+#include <geode/mesh/core/surface_mesh.h>
+#include <geode/mesh/core/triangulated_surface.h>
+
+#include <geode/model/helpers/brep_block_classifier.h>
+#include <geode/model/mixin/core/block.h>
+#include <geode/model/mixin/core/surface.h>
+#include <geode/model/representation/builder/brep_builder.h>
+#include <geode/model/representation/core/brep.h>
+#include <geode/model/representation/io/brep_input.h>
+
+#include <geode/tests/common.h>
+
+void check_batch( const geode::BRepBlockClassifier& classifier,
+    absl::Span< const geode::Point3D > points )
+{
+    const auto indices = classifier.block_indices( points );
+    OPENGEODE_EXCEPTION( indices.size() == points.size(),
+        "[Test] Wrong number of block indices" );
+    for( const auto p : geode::Indices{ points } )
+    {
+        OPENGEODE_EXCEPTION(
+            indices[p] == classifier.block_index( points[p] ),
+            "[Test] Batch and single queries should give the same Block" );
+    }
+}
+
+void test_tetrahedral_blocks()
+{
+    geode::BRep brep;
+    geode::BRepBuilder builder{ brep };
+    std::array< geode::uuid, 2 > block_ids;
+    for( const auto b : geode::Range{ 2 } )
+    {
+        const auto& block_id = builder.add_block(
+            geode::OpenGeodeTetrahedralSolid3D::impl_name_static() );
+        auto mesh_builder =
+            builder.block_mesh_builder< geode::TetrahedralSolid3D >( block_id );
+        const double offset = b;
+        mesh_builder->create_point( { { offset, 0, 0 } } );
+        mesh_builder->create_point( { { offset + 1, 0, 0 } } );
+        mesh_builder->create_point( { { offset, 1, 0 } } );
+        mesh_builder->create_point( { { offset, 0, 1 } } );
+        mesh_builder->create_tetrahedron( { 0, 1, 2, 3 } );
+        block_ids[b] = block_id;
+    }
+    const geode::BRepBlockClassifier classifier{ brep };
+    OPENGEODE_EXCEPTION(
+        classifier.nb_blocks() == 2, "[Test] Wrong number of Blocks" );
+    const std::array< geode::Point3D, 4 > points{ { { { 0.1, 0.1, 0.1 } },
+        { { 1.1, 0.1, 0.1 } }, { { 0.9, 0.9, 0.9 } },
+        { { 5, 5, 5 } } } };
+    for( const auto b : geode::Range{ 2 } )
+    {
+        const auto index = classifier.block_index( points[b] );
+        OPENGEODE_EXCEPTION( index != geode::NO_ID,
+            "[Test] Point ", points[b].string(), " should be in a Block" );
+        OPENGEODE_EXCEPTION( classifier.block_id( index ) == block_ids[b],
+            "[Test] Wrong Block for point ", points[b].string() );
+    }
+    for( const auto p : geode::Range{ 2, 4 } )
+    {
+        OPENGEODE_EXCEPTION(
+            classifier.block_index( points[p] ) == geode::NO_ID,
+            "[Test] Point ", points[p].string(), " should not be in a Block" );
+    }
+    check_batch( classifier, points );
+}
+
+void add_unit_cube_boundaries(
+    geode::BRep& brep, geode::BRepBuilder& builder, const geode::uuid& block )
+{
+    for( const auto axis : geode::LRange{ 3 } )
+    {
+        const auto other_axis = ( axis + 1 ) % 3;
+        const auto last_axis = ( axis + 2 ) % 3;
+        for( const auto side : geode::Range{ 2 } )
+        {
+            const auto& surface_id = builder.add_surface(
+                geode::OpenGeodeTriangulatedSurface3D::impl_name_static() );
+            auto mesh_builder =
+                builder.surface_mesh_builder< geode::TriangulatedSurface3D >(
+                    surface_id );
+            for( const auto corner : geode::Range{ 4 } )
+            {
+                geode::Point3D point;
+                point.set_value( axis, side );
+                point.set_value( other_axis, corner % 2 );
+                point.set_value( last_axis, corner / 2 );
+                mesh_builder->create_point( point );
+            }
+            mesh_builder->create_triangle( { 0, 1, 3 } );
+            mesh_builder->create_triangle( { 0, 3, 2 } );
+            builder.add_surface_block_boundary_relationship(
+                brep.surface( surface_id ), brep.block( block ) );
+        }
+    }
+}
+
+void test_mixed_blocks()
+{
+    geode::BRep brep;
+    geode::BRepBuilder builder{ brep };
+    const auto cube_id = builder.add_block();
+    add_unit_cube_boundaries( brep, builder, cube_id );
+    const auto tetrahedral_id = builder.add_block(
+        geode::OpenGeodeTetrahedralSolid3D::impl_name_static() );
+    auto mesh_builder =
+        builder.block_mesh_builder< geode::TetrahedralSolid3D >(
+            tetrahedral_id );
+    mesh_builder->create_point( { { 2, 0, 0 } } );
+    mesh_builder->create_point( { { 3, 0, 0 } } );
+    mesh_builder->create_point( { { 2, 1, 0 } } );
+    mesh_builder->create_point( { { 2, 0, 1 } } );
+    mesh_builder->create_tetrahedron( { 0, 1, 2, 3 } );
+    const geode::BRepBlockClassifier classifier{ brep };
+    const std::array< geode::Point3D, 5 > points{ { { { 0.3, 0.6, 0.2 } },
+        { { 2.1, 0.1, 0.1 } }, { { 1.5, 0.5, 0.5 } }, { { 2.9, 0.9, 0.9 } },
+        { { -1, -1, -1 } } } };
+    const std::array< geode::uuid, 2 > block_ids{ { cube_id,
+        tetrahedral_id } };
+    for( const auto b : geode::Range{ 2 } )
+    {
+        const auto index = classifier.block_index( points[b] );
+        OPENGEODE_EXCEPTION( index != geode::NO_ID,
+            "[Test] Point ", points[b].string(), " should be in a Block" );
+        OPENGEODE_EXCEPTION( classifier.block_id( index ) == block_ids[b],
+            "[Test] Wrong Block for point ", points[b].string() );
+    }
+    for( const auto p : geode::Range{ 2, 5 } )
+    {
+        OPENGEODE_EXCEPTION(
+            classifier.block_index( points[p] ) == geode::NO_ID,
+            "[Test] Point ", points[p].string(), " should not be in a Block" );
+    }
+    check_batch( classifier, points );
+}
+
+void test_layers()
+{
+    const auto brep =
+        geode::load_brep( absl::StrCat( geode::data_path, "layers.og_brep" ) );
+    const geode::BRepBlockClassifier classifier{ brep };
+    OPENGEODE_EXCEPTION( classifier.nb_blocks() == brep.nb_blocks(),
+        "[Test] Wrong number of Blocks" );
+
+    geode::BoundingBox3D box;
+    for( const auto& surface : brep.surfaces() )
+    {
+        box.add_box( surface.mesh().bounding_box() );
+    }
+#ifdef OPENGEODE_BENCHMARK
+    const geode::index_t size{ 100 };
+#else
+    const geode::index_t size{ 10 };
+#endif
+    const auto diagonal = box.diagonal();
+    std::vector< geode::Point3D > points;
+    points.reserve( size * size * size );
+    for( const auto i : geode::Range{ size } )
+    {
+        for( const auto j : geode::Range{ size } )
+        {
+            for( const auto k : geode::Range{ size } )
+            {
+                const std::array< geode::index_t, 3 > cell{ { i, j, k } };
+                geode::Point3D point;
+                for( const auto c : geode::LRange{ 3 } )
+                {
+                    point.set_value( c, box.min().value( c )
+                                            + ( cell[c] + 0.5 ) / size
+                                                  * diagonal.value( c ) );
+                }
+                points.push_back( std::move( point ) );
+            }
+        }
+    }
+    const auto start = std::chrono::steady_clock::now();
+    const auto indices = classifier.block_indices( points );
+    const std::chrono::duration< double > time =
+        std::chrono::steady_clock::now() - start;
+    geode::index_t nb_classified{ 0 };
+    for( const auto index : indices )
+    {
+        if( index != geode::NO_ID )
+        {
+            OPENGEODE_EXCEPTION( index < classifier.nb_blocks(),
+                "[Test] Wrong Block index" );
+            nb_classified++;
+        }
+    }
+    geode::Logger::info( "Classified ", nb_classified, " / ", points.size(),
+        " points in ", time.count(), "s" );
+    OPENGEODE_EXCEPTION( nb_classified == points.size(),
+        "[Test] Points should be inside Blocks" );
+    const std::array< std::pair< geode::Point3D, geode::uuid >, 3 > expected{
+        { { { { 37.5, 37.5, 0.5 } },
+              geode::uuid{ "00000000-e8d7-45cc-8000-0000bbad2355" } },
+            { { { 37.5, 37.5, 1.25 } },
+                geode::uuid{ "00000000-b3c6-4d57-8000-00005ca65e02" } },
+            { { { 37.5, 37.5, 1.85 } },
+                geode::uuid{ "00000000-8a55-4a2d-8000-00000db8724a" } } }
+    };
+    for( const auto& point : expected )
+    {
+        const auto index = classifier.block_index( point.first );
+        OPENGEODE_EXCEPTION( index != geode::NO_ID,
+            "[Test] Point ", point.first.string(), " should be in a Block" );
+        OPENGEODE_EXCEPTION( classifier.block_id( index ) == point.second,
+            "[Test] Wrong Block for point ", point.first.string() );
+    }
+    OPENGEODE_EXCEPTION(
+        classifier.block_index( box.max() + diagonal ) == geode::NO_ID,
+        "[Test] Point outside the BRep should not be in a Block" );
+    check_batch( classifier,
+        absl::MakeConstSpan( points ).subspan( 0, size * size ) );
+}
+
+void test()
+{
+    geode::OpenGeodeModelLibrary::initialize();
+    test_tetrahedral_blocks();
+    test_mixed_blocks();
+    test_layers();
+}
+
+OPENGEODE_TEST( "brep-block-classifier" )
@@ -21,10 +21,20 @@
  *
  */
 
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+
+#include <async++.h>
+
+#include <absl/algorithm/container.h>
+#include <absl/container/flat_hash_set.h>
+
 #include <geode/basic/assert.h>
 #include <geode/basic/logger.h>
 #include <geode/basic/range.h>
 #include <geode/basic/uuid.h>
+#include <geode/basic/zip_file.h>
 
 #include <geode/geometry/point.h>
 
@@ -49,6 +59,7 @@
 #include <geode/model/representation/core/brep.h>
 #include <geode/model/representation/io/brep_input.h>
 #include <geode/model/representation/io/brep_output.h>
+#include <geode/model/representation/io/geode/geode_brep_input.h>
 
 #include <geode/tests/common.h>
 
@@ -900,6 +911,80 @@ void test_clone( const geode::BRep& brep )
     }
 }
 
+void test_lazy_io( const geode::BRep& model, absl::string_view file_io )
+{
+    geode::OpenGeodeBRepInput input{ file_io };
+    const auto lazy_model = input.read_lazily();
+    test_compare_brep( model, lazy_model );
+
+    const auto budget_model = input.read_lazily( 1 );
+    for( const auto& surface : model.surfaces() )
+    {
+        const auto& lazy_surface = budget_model.surface( surface.id() );
+        OPENGEODE_EXCEPTION( lazy_surface.id() == lazy_surface.mesh().id(),
+            "[Test] Lazy surface should have the same uuid as its mesh." );
+        OPENGEODE_EXCEPTION( lazy_surface.mesh().nb_vertices()
+                                 == surface.mesh().nb_vertices(),
+            "[Test] Wrong number of vertices in lazy surface mesh." );
+        for( const auto v : geode::Range{ surface.mesh().nb_vertices() } )
+        {
+            OPENGEODE_EXCEPTION(
+                budget_model.unique_vertex( { lazy_surface.component_id(), v } )
+                    == model.unique_vertex( { surface.component_id(), v } ),
+                "[Test] Wrong unique vertex in lazy surface." );
+        }
+    }
+
+    // A mesh accessed since the previous release is kept in memory
+    const auto& first_surface = *budget_model.surfaces().begin();
+    const auto& first_mesh = first_surface.mesh();
+    const auto nb_vertices = first_mesh.nb_vertices();
+    input.release_untouched_meshes();
+    OPENGEODE_EXCEPTION( &first_surface.mesh() == &first_mesh
+                             && first_mesh.nb_vertices() == nb_vertices,
+        "[Test] Accessed lazy surface mesh has been released." );
+    input.release_untouched_meshes();
+    input.release_untouched_meshes();
+    for( const auto& surface : model.surfaces() )
+    {
+        OPENGEODE_EXCEPTION( budget_model.surface( surface.id() )
+                                     .mesh()
+                                     .nb_vertices()
+                                 == surface.mesh().nb_vertices(),
+            "[Test] Wrong number of vertices in released lazy surface "
+            "mesh." );
+    }
+}
+
+void test_lazy_concurrent_access(
+    const geode::BRep& model, absl::string_view file_io )
+{
+    geode::OpenGeodeBRepInput input{ file_io };
+    const auto budget_model = input.read_lazily( 1 );
+    std::vector< geode::uuid > surface_ids;
+    for( const auto& surface : model.surfaces() )
+    {
+        surface_ids.push_back( surface.id() );
+    }
+    async::parallel_for( async::irange( size_t{ 0 }, surface_ids.size() ),
+        [&model, &budget_model, &surface_ids]( size_t s ) {
+            const auto& surface = budget_model.surface( surface_ids[s] );
+            const auto pinned_mesh = surface.pinned_mesh();
+            for( const auto& other : budget_model.surfaces() )
+            {
+                other.mesh().nb_vertices();
+            }
+            OPENGEODE_EXCEPTION(
+                pinned_mesh->nb_vertices()
+                    == model.surface( surface_ids[s] ).mesh().nb_vertices(),
+                "[Test] Pinned lazy surface mesh has been evicted." );
+        } );
+    const auto budget_file =
+        absl::StrCat( "budget.", budget_model.native_extension() );
+    geode::save_brep( budget_model, budget_file );
+    test_compare_brep( model, geode::load_brep( budget_file ) );
+}
+
 void test_backward_io()
 {
     const auto brep = geode::load_brep(
@@ -928,6 +1013,89 @@ void test_backward_io()
     }
 }
 
+void test_compression( absl::string_view data_file )
+{
+    const auto model = geode::load_brep( absl::StrCat( geode::data_path,
+        data_file, ".", geode::BRep::native_extension_static() ) );
+    const std::array< std::pair< geode::ZipFile::Compression, const char* >,
+        3 >
+        compressions{ { { geode::ZipFile::Compression::store, "store" },
+            { geode::ZipFile::Compression::deflate, "deflate" },
+            { geode::ZipFile::Compression::zstd, "zstd" } } };
+    for( const auto& compression : compressions )
+    {
+        OPENGEODE_EXCEPTION(
+            geode::ZipFile::is_compression_available( compression.first ),
+            "[Test] Compression ", compression.second, " is not available" );
+        geode::OutputOptions options;
+        options.compression = compression.first;
+        const auto file_io = absl::StrCat(
+            "compression.", geode::BRep::native_extension_static() );
+        const auto write_start = std::chrono::steady_clock::now();
+        geode::save_brep( model, file_io, options );
+        const std::chrono::duration< double > write_time =
+            std::chrono::steady_clock::now() - write_start;
+        const auto read_start = std::chrono::steady_clock::now();
+        const auto reload = geode::load_brep( file_io );
+        const std::chrono::duration< double > read_time =
+            std::chrono::steady_clock::now() - read_start;
+        std::ifstream file{ file_io,
+            std::ifstream::binary | std::ifstream::ate };
+        geode::Logger::info( data_file, " ", compression.second, ": ",
+            static_cast< int64_t >( file.tellg() ), " bytes, write ",
+            write_time.count(), "s, read ", read_time.count(), "s" );
+        file.close();
+        std::remove( file_io.c_str() );
+        test_compare_brep( model, reload );
+    }
+}
+
+void test_component_mesh_vertices( absl::string_view data_file )
+{
+    const auto model = geode::load_brep( absl::StrCat( geode::data_path,
+        data_file, ".", geode::BRep::native_extension_static() ) );
+    geode::index_t nb_component_vertices{ 0 };
+    absl::flat_hash_set< geode::uuid > components;
+    for( const auto v : geode::Range{ model.nb_unique_vertices() } )
+    {
+        const auto vertices = model.component_mesh_vertices( v );
+        geode::index_t nb_vertices{ 0 };
+        for( const auto& cmv : vertices )
+        {
+            OPENGEODE_EXCEPTION( model.unique_vertex( cmv ) == v,
+                "[Test] Wrong unique vertex of a component vertex" );
+            OPENGEODE_EXCEPTION(
+                absl::c_linear_search( model.component_mesh_vertices(
+                                           v, cmv.component_id.id() ),
+                    cmv.vertex ),
+                "[Test] Wrong component vertices of a component" );
+            components.insert( cmv.component_id.id() );
+            nb_vertices++;
+        }
+        OPENGEODE_EXCEPTION( nb_vertices == vertices.size()
+                                 && vertices.to_vector().size() == nb_vertices,
+            "[Test] Wrong number of component vertices" );
+        nb_component_vertices += nb_vertices;
+    }
+    const auto per_vector_bytes =
+        model.nb_unique_vertices()
+            * sizeof( std::vector< geode::ComponentMeshVertex > )
+        + nb_component_vertices * sizeof( geode::ComponentMeshVertex );
+    const auto compact_bytes =
+        ( model.nb_unique_vertices() + 1 ) * sizeof( geode::index_t )
+        + nb_component_vertices
+              * sizeof( geode::ComponentMeshVerticesView::CompactVertex )
+        + components.size()
+              * ( sizeof( geode::ComponentID ) + sizeof( geode::uuid )
+                  + sizeof( geode::index_t ) );
+    geode::Logger::info( data_file, " unique vertices: ",
+        model.nb_unique_vertices(), ", component vertices: ",
+        nb_component_vertices, ", per vector storage: ", per_vector_bytes,
+        " bytes, compact storage: ", compact_bytes, " bytes" );
+    OPENGEODE_EXCEPTION( compact_bytes < per_vector_bytes,
+        "[Test] Compact unique vertex storage should be smaller" );
+}
+
 void test()
 {
     geode::OpenGeodeModelLibrary::initialize();
@@ -977,8 +1145,24 @@ void test()
 
     geode::BRep model3{ std::move( model2 ) };
     test_compare_brep( model, model3 );
+    test_lazy_io( model, file_io );
+    test_lazy_concurrent_access( model, file_io );
 
     test_backward_io();
+    for( const auto data_file :
+        { "dangling", "layers", "prism_curve", "random_dfn", "test_mesh3" } )
+    {
+        test_component_mesh_vertices( data_file );
+    }
+#ifdef OPENGEODE_BENCHMARK
+    for( const auto data_file :
+        { "dangling", "layers", "prism_curve", "random_dfn", "test_mesh3" } )
+    {
+        test_compression( data_file );
+    }
+#else
+    test_compression( "layers" );
+#endif
 }
 
 OPENGEODE_TEST( "brep" )
\ No newline at end of file
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2019 - 2023 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/basic/assert.h>
+#include <geode/basic/logger.h>
+#include <geode/basic/range.h>
+
+#include <geode/geometry/bounding_box.h>
+#include <geode/geometry/point.h>
+
+#include <geode/mesh/core/surface_mesh.h>
+
+#include <geode/model/helpers/ray_tracing.h>
+#include <geode/model/mixin/core/block.h>
+#include <geode/model/mixin/core/surface.h>
+#include <geode/model/representation/core/brep.h>
+#include <geode/model/representation/io/brep_input.h>
+
+#include <geode/tests/common.h>
+
+geode::index_t nb_intersections(
+    const geode::BoundarySurfaceIntersections& intersections )
+{
+    geode::index_t result{ 0 };
+    for( const auto& surface_intersections : intersections )
+    {
+        result += surface_intersections.second.size();
+    }
+    return result;
+}
+
+void check_same_intersections(
+    const geode::BoundarySurfaceIntersections& intersections,
+    const geode::BoundarySurfaceIntersections& expected )
+{
+    OPENGEODE_EXCEPTION( intersections.size() == expected.size(),
+        "[Test] Wrong number of intersected boundary Surfaces" );
+    for( const auto& surface_intersections : expected )
+    {
+        const auto it = intersections.find( surface_intersections.first );
+        OPENGEODE_EXCEPTION( it != intersections.end(),
+            "[Test] Missing boundary Surface intersections" );
+        OPENGEODE_EXCEPTION(
+            it->second.size() == surface_intersections.second.size(),
+            "[Test] Wrong number of boundary Surface intersections" );
+    }
+}
+
+geode::Point3D block_center(
+    const geode::BRep& brep, const geode::Block3D& block )
+{
+    geode::BoundingBox3D box;
+    for( const auto& surface : brep.boundaries( block ) )
+    {
+        box.add_box( surface.mesh().bounding_box() );
+    }
+    return box.center();
+}
+
+void test_block( const geode::BRepRayTracer& tracer,
+    const geode::BRep& brep,
+    const geode::Block3D& block )
+{
+    const auto center = block_center( brep, block );
+    const std::array< geode::Vector3D, 4 > directions{ { { { 1, 0, 0 } },
+        { { 0, 1, 0 } }, { { 0, 0, 1 } }, { { 1, 2, 3 } } } };
+    std::vector< geode::InfiniteLine3D > lines;
+    std::vector< geode::Ray3D > rays;
+    for( const auto& direction : directions )
+    {
+        lines.emplace_back( direction, center );
+        rays.emplace_back( direction, center );
+    }
+    const auto lines_intersections =
+        tracer.find_intersections_with_boundaries( lines, block );
+    const auto rays_intersections =
+        tracer.find_intersections_with_boundaries( rays, block );
+    OPENGEODE_EXCEPTION( lines_intersections.size() == lines.size(),
+        "[Test] Wrong number of line results" );
+    OPENGEODE_EXCEPTION( rays_intersections.size() == rays.size(),
+        "[Test] Wrong number of ray results" );
+    for( const auto l : geode::Indices{ lines } )
+    {
+        const auto expected =
+            geode::find_intersections_with_boundaries( lines[l], brep, block );
+        check_same_intersections( lines_intersections[l], expected );
+        check_same_intersections(
+            tracer.find_intersections_with_boundaries( lines[l], block ),
+            expected );
+        check_same_intersections(
+            tracer.find_intersections_with_boundaries( rays[l], block ),
+            rays_intersections[l] );
+        OPENGEODE_EXCEPTION( nb_intersections( rays_intersections[l] )
+                                 <= nb_intersections( expected ),
+            "[Test] Ray should not have more intersections than its line" );
+        OPENGEODE_EXCEPTION( nb_intersections( expected ) != 0,
+            "[Test] Line through Block should intersect its boundaries" );
+    }
+}
+
+void test()
+{
+    geode::OpenGeodeModelLibrary::initialize();
+    const auto brep =
+        geode::load_brep( absl::StrCat( geode::data_path, "layers.og_brep" ) );
+    const geode::BRepRayTracer tracer{ brep };
+    for( const auto& block : brep.blocks() )
+    {
+        test_block( tracer, brep, block );
+    }
+}
+
+OPENGEODE_TEST( "ray-tracing-model" )
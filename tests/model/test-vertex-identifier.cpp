@@ -21,6 +21,10 @@
  *
  */
 
+#include <algorithm>
+
+#include <absl/algorithm/container.h>
+
 #include <geode/basic/assert.h>
 #include <geode/basic/logger.h>
 #include <geode/geometry/point.h>
@@ -246,6 +250,92 @@ void test_update_unique_vertices()
     }
 }
 
+void test_unregister_component()
+{
+    CornerProvider provider;
+    CornerProviderBuilder builder( provider );
+    std::vector< geode::uuid > corners;
+    for( const auto unused : geode::Range{ 3 } )
+    {
+        geode_unused( unused );
+        corners.push_back( builder.add_corner() );
+        builder.corner_mesh_builder( corners.back() )
+            ->create_point( geode::Point2D{ { 0, 0 } } );
+    }
+    geode::VertexIdentifier vertex_identifier;
+    geode::VertexIdentifierBuilder vertex_id_builder{ vertex_identifier };
+    vertex_id_builder.create_unique_vertices( 3 );
+    for( const auto c : geode::Indices{ corners } )
+    {
+        const auto& corner = provider.corner( corners[c] );
+        vertex_id_builder.register_mesh_component( corner );
+        vertex_id_builder.set_unique_vertex( { corner.component_id(), 0 }, c );
+    }
+    vertex_id_builder.unregister_mesh_component(
+        provider.corner( corners[0] ) );
+    OPENGEODE_EXCEPTION( vertex_identifier.component_mesh_vertices( 0 ).empty(),
+        "[Test] Unregistered component vertices should be removed" );
+    for( const auto c : geode::Range{ 1, 3 } )
+    {
+        const auto vertices = vertex_identifier.component_mesh_vertices( c );
+        OPENGEODE_EXCEPTION( vertices.size() == 1
+                                 && vertices.front().component_id.id()
+                                        == corners[c]
+                                 && vertices.front().vertex == 0,
+            "[Test] Wrong component vertices after unregistering a "
+            "component" );
+    }
+}
+
+void test_component_mesh_vertices_iterator()
+{
+    CornerProvider provider;
+    CornerProviderBuilder builder( provider );
+    std::vector< geode::uuid > corners;
+    geode::VertexIdentifier vertex_identifier;
+    geode::VertexIdentifierBuilder vertex_id_builder{ vertex_identifier };
+    vertex_id_builder.create_unique_vertices( 1 );
+    for( const auto unused : geode::Range{ 3 } )
+    {
+        geode_unused( unused );
+        corners.push_back( builder.add_corner() );
+        builder.corner_mesh_builder( corners.back() )
+            ->create_point( geode::Point2D{ { 0, 0 } } );
+        const auto& corner = provider.corner( corners.back() );
+        vertex_id_builder.register_mesh_component( corner );
+        vertex_id_builder.set_unique_vertex( { corner.component_id(), 0 }, 0 );
+    }
+    const auto vertices = vertex_identifier.component_mesh_vertices( 0 );
+    const std::vector< geode::ComponentMeshVertex > copy(
+        vertices.begin(), vertices.end() );
+    OPENGEODE_EXCEPTION( copy == vertices.to_vector(),
+        "[Test] Wrong component vertices built from iterators" );
+    const geode::ComponentMeshVertex target{
+        provider.corner( corners[1] ).component_id(), 0
+    };
+    const auto found = absl::c_find( vertices, target );
+    OPENGEODE_EXCEPTION( found != vertices.end()
+                             && found->component_id.id() == corners[1]
+                             && *found == target,
+        "[Test] Wrong component vertex found" );
+    const auto nb_corner_vertices = std::count_if(
+        vertices.begin(), vertices.end(),
+        []( const geode::ComponentMeshVertex& vertex ) {
+            return vertex.component_id.type()
+                   == geode::Corner2D::component_type_static();
+        } );
+    OPENGEODE_EXCEPTION( nb_corner_vertices == 3
+                             && std::distance( vertices.begin(), vertices.end() )
+                                    == 3,
+        "[Test] Wrong number of component vertices from iterators" );
+    auto it = vertices.begin();
+    OPENGEODE_EXCEPTION( ( it++ )->component_id.id() == corners[0]
+                             && it->component_id.id() == corners[1]
+                             && ++it != vertices.end()
+                             && ++it == vertices.end(),
+        "[Test] Wrong component vertices iteration" );
+}
+
 void test()
 {
     geode::OpenGeodeModelLibrary::initialize();
@@ -281,6 +371,8 @@ void test()
     test_save_and_load_unique_vertices( vertex_identifier );
 
     test_update_unique_vertices();
+    test_unregister_component();
+    test_component_mesh_vertices_iterator();
 
     builder.unregister_mesh_component( provider.corner( corner2_id ) );
     builder.register_mesh_component( provider.corner( corner2_id ) );